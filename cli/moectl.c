@@ -11,10 +11,17 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <stdarg.h>
+#include <endian.h>
+#include <poll.h>
+#include <time.h>
 #include "../include/utils/lang.h"
 #include "../include/utils/string_ids.h"
+#include "../include/data/stats.h"
+#include "../include/data/live.h"
+#include "../include/data/selftest.h"
 
 /* Initialize language system */
 static void init_language() {
@@ -30,10 +37,41 @@ typedef enum {
     CMD_HELP,
     CMD_STATUS,
     CMD_RECLAIM,
+    CMD_RECLAIM_NODE,
+    CMD_COMPACT,
     CMD_SET_THRESHOLD,
     CMD_SET_INTERVAL,
     CMD_SET_AUTORECLAIM,
+    CMD_SET_HYSTERESIS,
+    CMD_SET_DWELL,
+    CMD_SET_COOLDOWN,
+    CMD_SET_NODE_THRESHOLD,
+    CMD_SET_RATE,
+    CMD_SET_HORIZON,
+    CMD_SET_MIN_RECLAIM,
+    CMD_SET_WMARK,
+    CMD_SET_STALL,
+    CMD_SET_THRASH,
+    CMD_SET_FRAG,
+    CMD_SET_POLICY,
+    CMD_SET_MEMCG,
+    CMD_SET_MEMCG_THRESHOLD,
+    CMD_SET_RSS,
+    CMD_SET_WSS,
+    CMD_SET_WSS_TARGET,
+    CMD_SET_PROACTIVE,
+    CMD_SET_PROACTIVE_PARAM,
+    CMD_SET_PROACTIVE_TARGET,
+    CMD_SAMPLE_BURST,
+    CMD_SAMPLE_STOP,
+    CMD_SAMPLE_DUMP,
+    CMD_TOP,
+    CMD_STATS,
+    CMD_LIVE,
+    CMD_BATCH,
+    CMD_EVENTS,
     CMD_SELFTEST,     /* 新增: 自检命令 */
+    CMD_SELFTEST_HISTORY,
     CMD_LOG           /* 新增: 日志查看命令 */
 } moeai_cmd_type;
 
@@ -41,7 +79,9 @@ typedef enum {
 struct moeai_cmd {
     moeai_cmd_type type;
     int value;
+    int value2;
     const char *str_value;
+    const char *str_value2;
 };
 
 /* procfs 路径 */
@@ -49,6 +89,17 @@ struct moeai_cmd {
 #define MOEAI_PROCFS_CONTROL "/proc/moeai/control"
 #define MOEAI_PROCFS_LOG     "/proc/moeai/log"
 #define MOEAI_PROCFS_SELFTEST "/proc/moeai/selftest"  /* 新增: 自检接口 */
+#define MOEAI_PROCFS_SELFTEST_BIN "/proc/moeai/selftest.bin"
+#define MOEAI_PROCFS_BURST   "/proc/moeai/burst"
+#define MOEAI_PROCFS_TOP_MEM "/proc/moeai/top_mem"
+#define MOEAI_PROCFS_STATS_BIN "/proc/moeai/stats.bin"
+#define MOEAI_PROCFS_EVENTS  "/proc/moeai/events"
+
+/* 一次写入控制文件的命令批大小上限，与内核的 MOEAI_CTL_MAX_BATCH 一致 */
+#define MOEAI_CTL_MAX_BATCH  4096
+
+/* 等待自检完成的最长时间 (毫秒) */
+#define SELFTEST_TIMEOUT_MS  30000
 
 /**
  * Show help information
@@ -60,10 +111,41 @@ static void show_help(void)
     printf("\n%s\n", lang_get(LANG_CLI_HELP_AVAIL_CMDS));
     printf("%s\n", lang_get(LANG_CLI_CMD_STATUS));
     printf("%s\n", lang_get(LANG_CLI_CMD_RECLAIM));
+    printf("%s\n", lang_get(LANG_CLI_CMD_RECLAIM_NODE));
+    printf("%s\n", lang_get(LANG_CLI_CMD_COMPACT));
     printf("%s\n", lang_get(LANG_CLI_CMD_SET_THRESHOLD));
     printf("%s\n", lang_get(LANG_CLI_CMD_SET_INTERVAL));
     printf("%s\n", lang_get(LANG_CLI_CMD_SET_AUTORECLAIM));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_HYSTERESIS));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_DWELL));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_COOLDOWN));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_NODE_THRESHOLD));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_RATE));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_HORIZON));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_MIN_RECLAIM));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_WMARK));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_STALL));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_THRASH));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_FRAG));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_POLICY));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_MEMCG));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_MEMCG_THRESHOLD));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_RSS));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_WSS));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_WSS_TARGET));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_PROACTIVE));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_PROACTIVE_PARAM));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SET_PROACTIVE_TARGET));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SAMPLE_BURST));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SAMPLE_STOP));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SAMPLE_DUMP));
+    printf("%s\n", lang_get(LANG_CLI_CMD_TOP));
+    printf("%s\n", lang_get(LANG_CLI_CMD_STATS));
+    printf("%s\n", lang_get(LANG_CLI_CMD_LIVE));
+    printf("%s\n", lang_get(LANG_CLI_CMD_BATCH));
+    printf("%s\n", lang_get(LANG_CLI_CMD_EVENTS));
     printf("%s\n", lang_get(LANG_CLI_CMD_SELFTEST));
+    printf("%s\n", lang_get(LANG_CLI_CMD_SELFTEST_HISTORY));
     printf("%s\n", lang_get(LANG_CLI_CMD_LOG));
     printf("%s\n", lang_get(LANG_CLI_CMD_HELP));
 }
@@ -87,7 +169,20 @@ static int parse_args(int argc, char *argv[], struct moeai_cmd *cmd)
         cmd->type = CMD_STATUS;
     }
     else if (strcmp(argv[1], "reclaim") == 0) {
-        cmd->type = CMD_RECLAIM;
+        if (argc >= 3 && strcmp(argv[2], "node") == 0) {
+            if (argc < 4) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            cmd->type = CMD_RECLAIM_NODE;
+            cmd->value = atoi(argv[3]);
+        } else {
+            cmd->type = CMD_RECLAIM;
+        }
+    }
+    else if (strcmp(argv[1], "compact") == 0) {
+        cmd->type = CMD_COMPACT;
+        cmd->value = (argc >= 3) ? atoi(argv[2]) : -1;
     }
     else if (strcmp(argv[1], "set") == 0) {
         if (argc < 4) {
@@ -107,6 +202,277 @@ static int parse_args(int argc, char *argv[], struct moeai_cmd *cmd)
             cmd->type = CMD_SET_AUTORECLAIM;
             cmd->str_value = argv[3];
         }
+        else if (strcmp(argv[2], "hysteresis") == 0) {
+            cmd->type = CMD_SET_HYSTERESIS;
+            cmd->value = atoi(argv[3]);
+        }
+        else if (strcmp(argv[2], "dwell") == 0) {
+            cmd->type = CMD_SET_DWELL;
+            cmd->value = atoi(argv[3]);
+        }
+        else if (strcmp(argv[2], "cooldown") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "gentle") != 0 && strcmp(argv[3], "moderate") != 0 &&
+                strcmp(argv[3], "aggressive") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_POLICY, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_COOLDOWN;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "nodethreshold") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            cmd->type = CMD_SET_NODE_THRESHOLD;
+            cmd->value = atoi(argv[3]);
+            cmd->value2 = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "horizon") == 0) {
+            cmd->type = CMD_SET_HORIZON;
+            cmd->value = atoi(argv[3]);
+        }
+        else if (strcmp(argv[2], "minreclaim") == 0) {
+            cmd->type = CMD_SET_MIN_RECLAIM;
+            cmd->value = atoi(argv[3]);
+        }
+        else if (strcmp(argv[2], "wmark") == 0) {
+            cmd->type = CMD_SET_WMARK;
+            cmd->str_value = argv[3];
+        }
+        else if (strcmp(argv[2], "frag") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "order") != 0 && strcmp(argv[3], "percent") != 0 &&
+                strcmp(argv[3], "index") != 0 && strcmp(argv[3], "cooldown") != 0 &&
+                strcmp(argv[3], "zones") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_FRAG, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_FRAG;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "policy") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "adaptive") != 0 && strcmp(argv[3], "target") != 0 &&
+                strcmp(argv[3], "explore") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_POLICY_PARAM, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_POLICY;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "memcg") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "interval") != 0 && strcmp(argv[3], "batch") != 0 &&
+                strcmp(argv[3], "top") != 0 && strcmp(argv[3], "warn") != 0 &&
+                strcmp(argv[3], "critical") != 0 && strcmp(argv[3], "psi") != 0 &&
+                strcmp(argv[3], "max") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_MEMCG, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_MEMCG;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "rss") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "interval") != 0 && strcmp(argv[3], "batch") != 0 &&
+                strcmp(argv[3], "top") != 0 && strcmp(argv[3], "max") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_RSS, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_RSS;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "wss") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "interval") != 0 && strcmp(argv[3], "batch") != 0 &&
+                strcmp(argv[3], "age") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_WSS, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_WSS;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "wsstarget") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[4], "on") != 0 && strcmp(argv[4], "off") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_SWITCH, argv[4]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_WSS_TARGET;
+            cmd->str_value = argv[3];
+            cmd->str_value2 = argv[4];
+        }
+        else if (strcmp(argv[2], "proactive") == 0) {
+            if (argc < 4) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "on") != 0 && strcmp(argv[3], "off") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_SWITCH, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_PROACTIVE;
+            cmd->str_value = argv[3];
+        }
+        else if (strcmp(argv[2], "proactiveparam") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "interval") != 0 && strcmp(argv[3], "step") != 0 &&
+                strcmp(argv[3], "cost") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_PROACTIVE, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_PROACTIVE_PARAM;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "proactivetarget") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[4], "on") != 0 && strcmp(argv[4], "off") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_SWITCH, argv[4]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_PROACTIVE_TARGET;
+            cmd->str_value = argv[3];
+            cmd->str_value2 = argv[4];
+        }
+        else if (strcmp(argv[2], "memcgthreshold") == 0) {
+            if (argc < 6) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            cmd->type = CMD_SET_MEMCG_THRESHOLD;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+            cmd->value2 = atoi(argv[5]);
+        }
+        else if (strcmp(argv[2], "thrash") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "swap") != 0 && strcmp(argv[3], "refault") != 0 &&
+                strcmp(argv[3], "activate") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_THRASH, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_THRASH;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "rate") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "direct_scan") != 0 && strcmp(argv[3], "allocstall") != 0 &&
+                strcmp(argv[3], "refault") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_RATE, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_RATE;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
+        else if (strcmp(argv[2], "stall") == 0) {
+            if (argc < 5) {
+                fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+                return -1;
+            }
+            if (strcmp(argv[3], "warn") != 0 && strcmp(argv[3], "critical") != 0) {
+                char *msg = lang_getf(LANG_CLI_ERR_INVALID_STALL, argv[3]);
+                if (msg) {
+                    fprintf(stderr, "%s", msg);
+                    free(msg);
+                }
+                return -1;
+            }
+            cmd->type = CMD_SET_STALL;
+            cmd->str_value = argv[3];
+            cmd->value = atoi(argv[4]);
+        }
         else {
             char *msg = lang_getf(LANG_CLI_ERR_UNKNOWN_SET_CMD, argv[2]);
             if (msg) {
@@ -116,11 +482,49 @@ static int parse_args(int argc, char *argv[], struct moeai_cmd *cmd)
             return -1;
         }
     }
+    else if (strcmp(argv[1], "sample") == 0) {
+        if (argc >= 3 && strcmp(argv[2], "stop") == 0) {
+            cmd->type = CMD_SAMPLE_STOP;
+        } else if (argc >= 5 && strcmp(argv[2], "burst") == 0) {
+            cmd->type = CMD_SAMPLE_BURST;
+            cmd->str_value = argv[3];
+            cmd->str_value2 = argv[4];
+        } else if (argc >= 4 && strcmp(argv[2], "dump") == 0) {
+            cmd->type = CMD_SAMPLE_DUMP;
+            cmd->str_value = argv[3];
+        } else {
+            fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+            return -1;
+        }
+    }
+    else if (strcmp(argv[1], "top") == 0) {
+        cmd->type = CMD_TOP;
+    }
+    else if (strcmp(argv[1], "stats") == 0) {
+        cmd->type = CMD_STATS;
+    }
+    else if (strcmp(argv[1], "live") == 0) {
+        cmd->type = CMD_LIVE;
+    }
+    else if (strcmp(argv[1], "batch") == 0) {
+        if (argc < 3) {
+            fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_INSUFFICIENT_ARGS));
+            return -1;
+        }
+        cmd->type = CMD_BATCH;
+        cmd->str_value = argv[2];
+    }
+    else if (strcmp(argv[1], "events") == 0) {
+        cmd->type = CMD_EVENTS;
+    }
     else if (strcmp(argv[1], "help") == 0) {
         cmd->type = CMD_HELP;
     }
     else if (strcmp(argv[1], "selftest") == 0) {
-        cmd->type = CMD_SELFTEST;
+        if (argc >= 3 && strcmp(argv[2], "history") == 0)
+            cmd->type = CMD_SELFTEST_HISTORY;
+        else
+            cmd->type = CMD_SELFTEST;
     }
     else if (strcmp(argv[1], "log") == 0) {
         cmd->type = CMD_LOG;
@@ -163,6 +567,281 @@ static int read_status(void)
     return 0;
 }
 
+/**
+ * 将突发采样的二进制结果保存到文件
+ * @path: 输出文件路径
+ * @return: 成功返回0，失败返回负值
+ */
+static int dump_burst(const char *path)
+{
+    FILE *in, *out;
+    char buffer[4096];
+    size_t n;
+    long total = 0;
+    int ret = 0;
+    
+    in = fopen(MOEAI_PROCFS_BURST, "rb");
+    if (!in) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_BURST), strerror(errno));
+        return -1;
+    }
+    
+    out = fopen(path, "wb");
+    if (!out) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_WRITE_FILE), strerror(errno));
+        fclose(in);
+        return -1;
+    }
+    
+    while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+        if (fwrite(buffer, 1, n, out) != n) {
+            ret = -1;
+            break;
+        }
+        total += n;
+    }
+    if (ferror(in))
+        ret = -1;
+    
+    fclose(in);
+    if (fclose(out) != 0)
+        ret = -1;
+    
+    if (ret) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_WRITE_FILE), strerror(errno));
+        return ret;
+    }
+    
+    {
+        char *msg = lang_getf(LANG_CLI_MSG_SAMPLE_DUMP, total, path);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+    }
+    return 0;
+}
+
+/**
+ * 读取进程内存排行
+ * @return: 成功返回0，失败返回负值
+ */
+static int read_top_mem(void)
+{
+    FILE *fp;
+    char buffer[4096];
+    size_t bytes_read;
+    
+    fp = fopen(MOEAI_PROCFS_TOP_MEM, "r");
+    if (!fp) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_TOP_MEM), strerror(errno));
+        return -1;
+    }
+    
+    /* 排行最多两张64行的表，分块读取直到结束 */
+    while ((bytes_read = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        fwrite(buffer, 1, bytes_read, stdout);
+    
+    fclose(fp);
+    return 0;
+}
+
+/* 按 "名称 值" 的格式输出一个字段，便于脚本解析 */
+#define STATS_PRINT32(name, field) \
+    printf("%-32s %u\n", name, (unsigned int)le32toh(field))
+#define STATS_PRINT64(name, field) \
+    printf("%-32s %llu\n", name, (unsigned long long)le64toh(field))
+
+/**
+ * 读取并解码二进制统计
+ * @return: 成功返回0，失败返回负值
+ */
+static int read_stats_bin(void)
+{
+    static const char * const states[MOEAI_STATS_NR_STATES] = {
+        "normal", "warning", "critical", "emergency", "thrashing"
+    };
+    static const char * const policies[MOEAI_STATS_NR_POLICIES] = {
+        "gentle", "moderate", "aggressive"
+    };
+    struct moeai_stats_blob blob;
+    const struct moeai_stats_mem *m = &blob.mem;
+    const struct moeai_stats_rates *r = &blob.rates;
+    const struct moeai_stats_config *c = &blob.config;
+    const struct moeai_stats_counters *n = &blob.counters;
+    char buffer[4096];
+    char name[64];
+    size_t len;
+    FILE *fp;
+    int ret, i;
+    
+    fp = fopen(MOEAI_PROCFS_STATS_BIN, "rb");
+    if (!fp) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_STATS), strerror(errno));
+        return -1;
+    }
+    len = fread(buffer, 1, sizeof(buffer), fp);
+    fclose(fp);
+    
+    ret = moeai_stats_decode(buffer, len, &blob);
+    if (ret) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_STATS_FORMAT), strerror(-ret));
+        return -1;
+    }
+    
+    printf("%-32s %u\n", "version", (unsigned int)le16toh(blob.header.version));
+    STATS_PRINT32("flags", blob.header.flags);
+    STATS_PRINT64("timestamp_ns", blob.header.timestamp_ns);
+    
+    STATS_PRINT64("mem.sample_ns", m->sample_ns);
+    STATS_PRINT64("mem.total_kb", m->total_kb);
+    STATS_PRINT64("mem.free_kb", m->free_kb);
+    STATS_PRINT64("mem.available_kb", m->available_kb);
+    STATS_PRINT64("mem.cached_kb", m->cached_kb);
+    STATS_PRINT64("mem.swap_total_kb", m->swap_total_kb);
+    STATS_PRINT64("mem.swap_free_kb", m->swap_free_kb);
+    STATS_PRINT32("mem.usage_percent", m->mem_usage_percent);
+    STATS_PRINT32("mem.swap_usage_percent", m->swap_usage_percent);
+    STATS_PRINT32("mem.state", m->state);
+    STATS_PRINT32("mem.state_ms", m->state_ms);
+    
+    STATS_PRINT32("rate.interval_ms", r->interval_ms);
+    STATS_PRINT64("rate.pgfault", r->pgfault);
+    STATS_PRINT64("rate.pgmajfault", r->pgmajfault);
+    STATS_PRINT64("rate.pgscan_kswapd", r->pgscan_kswapd);
+    STATS_PRINT64("rate.pgscan_direct", r->pgscan_direct);
+    STATS_PRINT64("rate.pgsteal_kswapd", r->pgsteal_kswapd);
+    STATS_PRINT64("rate.pgsteal_direct", r->pgsteal_direct);
+    STATS_PRINT64("rate.allocstall", r->allocstall);
+    STATS_PRINT64("rate.refault", r->refault);
+    STATS_PRINT64("rate.pswpin", r->pswpin);
+    STATS_PRINT64("rate.pswpout", r->pswpout);
+    STATS_PRINT64("rate.activate", r->activate);
+    STATS_PRINT64("rate.kswapd_run", r->kswapd_run);
+    STATS_PRINT64("rate.kswapd_quick", r->kswapd_quick);
+    
+    STATS_PRINT32("config.check_interval_ms", c->check_interval_ms);
+    STATS_PRINT32("config.warn_threshold", c->warn_threshold);
+    STATS_PRINT32("config.critical_threshold", c->critical_threshold);
+    STATS_PRINT32("config.emergency_threshold", c->emergency_threshold);
+    STATS_PRINT32("config.warn_exit_threshold", c->warn_exit_threshold);
+    STATS_PRINT32("config.critical_exit_threshold", c->critical_exit_threshold);
+    STATS_PRINT32("config.emergency_exit_threshold", c->emergency_exit_threshold);
+    STATS_PRINT32("config.min_dwell_ms", c->min_dwell_ms);
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++) {
+        snprintf(name, sizeof(name), "config.cooldown_ms.%s", policies[i]);
+        STATS_PRINT32(name, c->reclaim_cooldown_ms[i]);
+    }
+    STATS_PRINT32("config.node_warn_threshold", c->node_warn_threshold);
+    STATS_PRINT32("config.node_critical_threshold", c->node_critical_threshold);
+    STATS_PRINT32("config.node_reclaim_kb", c->node_reclaim_kb);
+    STATS_PRINT32("config.forecast_horizon_ms", c->forecast_horizon_ms);
+    STATS_PRINT32("config.thrash_activate_percent", c->thrash_activate_percent);
+    STATS_PRINT32("config.stall_warn_us", c->stall_warn_us);
+    STATS_PRINT32("config.stall_critical_us", c->stall_critical_us);
+    STATS_PRINT64("config.direct_scan_rate", c->direct_scan_rate_threshold);
+    STATS_PRINT64("config.allocstall_rate", c->allocstall_rate_threshold);
+    STATS_PRINT64("config.refault_rate", c->refault_rate_threshold);
+    STATS_PRINT64("config.thrash_swap", c->thrash_swap_threshold);
+    STATS_PRINT64("config.thrash_refault", c->thrash_refault_threshold);
+    STATS_PRINT64("config.min_reclaimable_kb", c->min_reclaimable_kb);
+    
+    STATS_PRINT64("count.transitions", n->transitions);
+    for (i = 0; i < MOEAI_STATS_NR_STATES; i++) {
+        snprintf(name, sizeof(name), "count.entries.%s", states[i]);
+        STATS_PRINT64(name, n->state_entries[i]);
+    }
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++) {
+        snprintf(name, sizeof(name), "count.reclaim.%s", policies[i]);
+        STATS_PRINT64(name, n->reclaim_runs[i]);
+        snprintf(name, sizeof(name), "count.suppressed.%s", policies[i]);
+        STATS_PRINT64(name, n->reclaim_suppressed[i]);
+    }
+    STATS_PRINT64("count.thrash_suppressed", n->thrash_suppressed);
+    STATS_PRINT64("count.reclaim_futile", n->reclaim_futile);
+    STATS_PRINT64("count.wmark_low", n->wmark_low_events);
+    STATS_PRINT64("count.forecast_predictions", n->forecast_predictions);
+    STATS_PRINT64("count.forecast_hits", n->forecast_hits);
+    STATS_PRINT64("count.forecast_false_alarms", n->forecast_false_alarms);
+    STATS_PRINT64("count.forecast_misses", n->forecast_misses);
+    STATS_PRINT64("count.forecast_triggers", n->forecast_triggers);
+    STATS_PRINT64("count.stall", n->stall_count);
+    STATS_PRINT64("count.stall_total_us", n->stall_total_us);
+    STATS_PRINT64("count.stall_max_us", n->stall_max_us);
+    STATS_PRINT64("count.stall_untracked", n->stall_untracked);
+    return 0;
+}
+
+/**
+ * 映射实时页并读取一次快照，与 stats 的输出字段一致
+ * @return: 成功返回0，失败返回负值
+ */
+static int read_live(void)
+{
+    static const char * const states[MOEAI_STATS_NR_STATES] = {
+        "normal", "warning", "critical", "emergency", "thrashing"
+    };
+    static const char * const policies[MOEAI_STATS_NR_POLICIES] = {
+        "gentle", "moderate", "aggressive"
+    };
+    struct moeai_live_page live;
+    const struct moeai_stats_mem *m = &live.mem;
+    const struct moeai_live_counters *n = &live.counters;
+    const void *page;
+    char name[64];
+    int ret, i;
+    
+    page = moeai_live_map();
+    if (!page) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_MAP_LIVE), strerror(errno));
+        return -1;
+    }
+    ret = moeai_live_read(page, &live);
+    moeai_live_unmap(page);
+    if (ret) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_LIVE_READ), strerror(-ret));
+        return -1;
+    }
+    
+    printf("%-32s %u\n", "version", (unsigned int)le16toh(live.header.version));
+    STATS_PRINT32("seq", live.header.seq);
+    STATS_PRINT32("flags", live.header.flags);
+    STATS_PRINT64("update_ns", live.header.update_ns);
+    
+    STATS_PRINT64("mem.sample_ns", m->sample_ns);
+    STATS_PRINT64("mem.total_kb", m->total_kb);
+    STATS_PRINT64("mem.free_kb", m->free_kb);
+    STATS_PRINT64("mem.available_kb", m->available_kb);
+    STATS_PRINT64("mem.cached_kb", m->cached_kb);
+    STATS_PRINT64("mem.swap_total_kb", m->swap_total_kb);
+    STATS_PRINT64("mem.swap_free_kb", m->swap_free_kb);
+    STATS_PRINT32("mem.usage_percent", m->mem_usage_percent);
+    STATS_PRINT32("mem.swap_usage_percent", m->swap_usage_percent);
+    STATS_PRINT32("mem.state", m->state);
+    STATS_PRINT32("mem.state_ms", m->state_ms);
+    
+    STATS_PRINT32("rate.interval_ms", live.rates.interval_ms);
+    STATS_PRINT64("rate.pgscan_direct", live.rates.pgscan_direct);
+    STATS_PRINT64("rate.allocstall", live.rates.allocstall);
+    STATS_PRINT64("rate.refault", live.rates.refault);
+    
+    STATS_PRINT64("count.transitions", n->transitions);
+    for (i = 0; i < MOEAI_STATS_NR_STATES; i++) {
+        snprintf(name, sizeof(name), "count.entries.%s", states[i]);
+        STATS_PRINT64(name, n->state_entries[i]);
+    }
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++) {
+        snprintf(name, sizeof(name), "count.reclaim.%s", policies[i]);
+        STATS_PRINT64(name, n->reclaim_runs[i]);
+        snprintf(name, sizeof(name), "count.suppressed.%s", policies[i]);
+        STATS_PRINT64(name, n->reclaim_suppressed[i]);
+    }
+    STATS_PRINT64("count.thrash_suppressed", n->thrash_suppressed);
+    STATS_PRINT64("count.reclaim_futile", n->reclaim_futile);
+    STATS_PRINT64("count.wmark_low", n->wmark_low_events);
+    return 0;
+}
+
 /**
  * 读取日志信息
  * @return: 成功返回0，失败返回负值
@@ -196,20 +875,118 @@ static int read_log(void)
  */
 static int send_command(const char *cmd)
 {
-    FILE *fp;
+    char result[8192];
+    ssize_t n;
+    int fd, ret = 0;
     
-    /* 打开控制文件 */
-    fp = fopen(MOEAI_PROCFS_CONTROL, "w");
-    if (!fp) {
+    /* 以读写方式打开，写入失败时可以读回内核给出的逐条结果 */
+    fd = open(MOEAI_PROCFS_CONTROL, O_RDWR);
+    if (fd < 0) {
         perror(lang_get(LANG_CLI_ERR_OPEN_CONTROL));
         return -1;
     }
     
-    /* 写入命令 */
-    fprintf(fp, "%s", cmd);
+    if (write(fd, cmd, strlen(cmd)) < 0) {
+        int err = errno;
+        
+        ret = -1;
+        n = read(fd, result, sizeof(result) - 1);
+        if (n > 0) {
+            result[n] = '\0';
+            fputs(result, stderr);
+        } else {
+            fprintf(stderr, "Error: %s\n", strerror(err));
+        }
+    }
     
-    fclose(fp);
-    return 0;
+    close(fd);
+    return ret;
+}
+
+/**
+ * 将命令文件作为一批写入控制文件，并输出逐条结果
+ * @path: 命令文件路径，"-" 表示标准输入
+ * @return: 全部成功返回0，失败返回负值
+ */
+static int run_batch(const char *path)
+{
+    char batch[MOEAI_CTL_MAX_BATCH + 1];
+    char result[8192];
+    FILE *in;
+    size_t len;
+    ssize_t n;
+    int fd, ret = 0;
+    
+    in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_READ_FILE), strerror(errno));
+        return -1;
+    }
+    len = fread(batch, 1, sizeof(batch), in);
+    if (in != stdin)
+        fclose(in);
+    
+    /* 整批在一次写入中提交，超过上限时不拆分，否则就不再是一个事务 */
+    if (len > MOEAI_CTL_MAX_BATCH) {
+        char *msg = lang_getf(LANG_CLI_ERR_BATCH_TOO_LONG, MOEAI_CTL_MAX_BATCH);
+        if (msg) {
+            fprintf(stderr, "%s", msg);
+            free(msg);
+        }
+        return -1;
+    }
+    
+    fd = open(MOEAI_PROCFS_CONTROL, O_RDWR);
+    if (fd < 0) {
+        perror(lang_get(LANG_CLI_ERR_OPEN_CONTROL));
+        return -1;
+    }
+    
+    if (write(fd, batch, len) < 0)
+        ret = -1;
+    n = read(fd, result, sizeof(result) - 1);
+    if (n > 0) {
+        result[n] = '\0';
+        fputs(result, ret ? stderr : stdout);
+    } else if (ret) {
+        fprintf(stderr, "Error: %s\n", strerror(errno));
+    }
+    
+    close(fd);
+    return ret;
+}
+
+/**
+ * 持续输出内核事件，直到被中断
+ * 读取在没有新事件时阻塞，等待期间不占用CPU
+ * @return: 成功返回0，失败返回负值
+ */
+static int follow_events(void)
+{
+    char buffer[4096];
+    ssize_t n;
+    int fd;
+    
+    fd = open(MOEAI_PROCFS_EVENTS, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_EVENTS), strerror(errno));
+        return -1;
+    }
+    
+    for (;;) {
+        n = read(fd, buffer, sizeof(buffer));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        fwrite(buffer, 1, n, stdout);
+        fflush(stdout);
+    }
+    
+    if (n < 0)
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_EVENTS), strerror(errno));
+    close(fd);
+    return n < 0 ? -1 : 0;
 }
 
 /**
@@ -219,36 +996,189 @@ static int send_command(const char *cmd)
 static int read_selftest(void)
 {
     FILE *fp;
-    char buffer[8192];  /* 使用更大的缓冲区，自检结果可能较长 */
+    struct pollfd pfd;
+    char buffer[4096];
     size_t bytes_read;
+    int ret;
+    
+    /* 先打开结果文件，打开之后完成的自检才会唤醒 poll */
+    fp = fopen(MOEAI_PROCFS_SELFTEST, "r");
+    if (!fp) {
+        perror(lang_get(LANG_CLI_ERR_OPEN_SELFTEST));
+        return -1;
+    }
     
-    /* 先触发自检程序 */
+    /* 触发自检，内核在工作队列中异步运行 */
     if (send_command("selftest") != 0) {
         fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_TRIGGER_SELFTEST));
+        fclose(fp);
         return -1;
     }
     
-    /* 等待一小段时间，确保自检完成 */
-    usleep(500000);  /* 等待500毫秒 */
-    
-    /* 打开自检结果文件 */
-    fp = fopen(MOEAI_PROCFS_SELFTEST, "r");
-    if (!fp) {
-        perror(lang_get(LANG_CLI_ERR_OPEN_SELFTEST));
+    /* 等待自检完成 */
+    pfd.fd = fileno(fp);
+    pfd.events = POLLIN;
+    do {
+        ret = poll(&pfd, 1, SELFTEST_TIMEOUT_MS);
+    } while (ret < 0 && errno == EINTR);
+    if (ret <= 0) {
+        fprintf(stderr, "%s\n", lang_get(LANG_CLI_ERR_SELFTEST_TIMEOUT));
+        fclose(fp);
         return -1;
     }
     
-    /* 读取并显示内容 */
+    /* 逐块读取并显示内容，结果长度不受缓冲区大小限制 */
     printf("%s\n", lang_get(LANG_CLI_MSG_SELFTEST_RESULT));
-    bytes_read = fread(buffer, 1, sizeof(buffer) - 1, fp);
-    buffer[bytes_read] = '\0';
-    printf("%s", buffer);
+    while ((bytes_read = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        fwrite(buffer, 1, bytes_read, stdout);
     printf("================================\n");
     
     fclose(fp);
     return 0;
 }
 
+/* 读取整个文件，返回的缓冲区由调用者释放 */
+static char *read_whole_file(const char *path, size_t *len)
+{
+    char *buf = NULL, *p;
+    size_t cap = 0, n;
+    FILE *fp;
+    
+    *len = 0;
+    fp = fopen(path, "rb");
+    if (!fp)
+        return NULL;
+    for (;;) {
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 65536;
+            p = realloc(buf, cap);
+            if (!p) {
+                free(buf);
+                fclose(fp);
+                errno = ENOMEM;
+                return NULL;
+            }
+            buf = p;
+        }
+        n = fread(buf + *len, 1, cap - *len, fp);
+        if (n == 0)
+            break;
+        *len += n;
+    }
+    fclose(fp);
+    return buf;
+}
+
+/* 在一次运行中查找同一测试、同类型、同参数、同名的记录 */
+static int selftest_find_record(const struct moeai_selftest_bin_run *run, const void *records,
+                                const struct moeai_selftest_bin_record *key,
+                                struct moeai_selftest_bin_record *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i < le32toh(run->nr_records); i++) {
+        moeai_selftest_decode_record(records, run, i, out);
+        if (out->test == key->test && out->type == key->type && out->arg == key->arg &&
+            strcmp(out->name, key->name) == 0)
+            return 0;
+    }
+    return -1;
+}
+
+/**
+ * 对比保留的历次自检: 每次运行一行摘要，之后按最近一次运行的基准测试列出各次的结果
+ * 基准测试取中位数 (纳秒)，可扩展性测试取 ops/s
+ * @return: 成功返回0，失败返回负值
+ */
+static int read_selftest_history(void)
+{
+    struct moeai_selftest_bin_run runs[MOEAI_SELFTEST_HISTORY];
+    const void *records[MOEAI_SELFTEST_HISTORY];
+    struct moeai_selftest_bin_record rec, other;
+    unsigned int count[4];
+    char name[64], when[32];
+    size_t len, off = 0;
+    const struct moeai_selftest_bin_run *last;
+    uint64_t ns, value;
+    time_t sec;
+    long used;
+    char *buf;
+    int nr = 0, i, j;
+    uint32_t k;
+    
+    buf = read_whole_file(MOEAI_PROCFS_SELFTEST_BIN, &len);
+    if (!buf) {
+        fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_OPEN_SELFTEST), strerror(errno));
+        return -1;
+    }
+    
+    /* 文件中的运行从旧到新排列 */
+    while (off < len && nr < MOEAI_SELFTEST_HISTORY) {
+        used = moeai_selftest_decode_run(buf + off, len - off, &runs[nr], &records[nr]);
+        if (used < 0) {
+            fprintf(stderr, "Error: %s (%s)\n", lang_get(LANG_CLI_ERR_SELFTEST_FORMAT),
+                    strerror((int)-used));
+            free(buf);
+            return -1;
+        }
+        off += used;
+        nr++;
+    }
+    if (nr == 0) {
+        printf("%s\n", lang_get(LANG_CLI_MSG_SELFTEST_NO_HISTORY));
+        free(buf);
+        return 0;
+    }
+    
+    printf("%-6s %-19s %4s %4s %4s %4s %12s  %s\n",
+           "run", "start", "pass", "warn", "fail", "skip", "ms", "kernel");
+    for (i = 0; i < nr; i++) {
+        memset(count, 0, sizeof(count));
+        for (j = 0; j < runs[i].nr_tests; j++) {
+            if (runs[i].status[j] < 4)
+                count[runs[i].status[j]]++;
+        }
+        sec = (time_t)(le64toh(runs[i].start_ns) / 1000000000ULL);
+        strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", localtime(&sec));
+        ns = le64toh(runs[i].duration_ns);
+        printf("%-6llu %-19s %4u %4u %4u %4u %8llu.%03llu  %s\n",
+               (unsigned long long)le64toh(runs[i].gen), when,
+               count[0], count[1], count[2], count[3],
+               (unsigned long long)(ns / 1000000), (unsigned long long)(ns / 1000 % 1000),
+               runs[i].release);
+    }
+    
+    /* 以最近一次运行的记录为行，各次运行为列 */
+    last = &runs[nr - 1];
+    printf("\n%-32s", "median_ns | ops/s");
+    for (i = 0; i < nr; i++)
+        printf(" %12llu", (unsigned long long)le64toh(runs[i].gen));
+    printf("\n");
+    for (k = 0; k < le32toh(last->nr_records); k++) {
+        moeai_selftest_decode_record(records[nr - 1], last, k, &rec);
+        if (rec.type == MOEAI_SELFTEST_REC_BENCH)
+            snprintf(name, sizeof(name), "%s", rec.name);
+        else if (rec.type == MOEAI_SELFTEST_REC_SCALE)
+            snprintf(name, sizeof(name), "%s/cpus=%u", rec.name, (unsigned int)le16toh(rec.arg));
+        else
+            continue;
+        
+        printf("%-32s", name);
+        for (i = 0; i < nr; i++) {
+            if (selftest_find_record(&runs[i], records[i], &rec, &other)) {
+                printf(" %12s", "-");
+                continue;
+            }
+            value = rec.type == MOEAI_SELFTEST_REC_BENCH ? le64toh(other.v[1]) : le64toh(other.v[0]);
+            printf(" %12llu", (unsigned long long)value);
+        }
+        printf("\n");
+    }
+    
+    free(buf);
+    return 0;
+}
+
 /**
  * 主函数
  */
@@ -284,6 +1214,19 @@ int main(int argc, char *argv[])
         printf("%s\n", lang_get(LANG_CLI_MSG_RECLAIM_COMPLETE));
         return (read_status() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
         
+    case CMD_RECLAIM_NODE: {
+        char *msg = lang_getf(LANG_CLI_MSG_NODE_RECLAIM, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "reclaim node %d", cmd.value);
+        if (send_command(cmd_buf) != 0)
+            return EXIT_FAILURE;
+        printf("%s\n", lang_get(LANG_CLI_MSG_RECLAIM_COMPLETE));
+        return (read_status() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
     case CMD_SET_THRESHOLD: {
         char *msg = lang_getf(LANG_CLI_MSG_SET_THRESHOLD, cmd.value);
         if (msg) {
@@ -314,8 +1257,252 @@ int main(int argc, char *argv[])
         return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
     }
         
+    case CMD_SET_HYSTERESIS: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_HYSTERESIS, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set hysteresis %d", cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_DWELL: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_DWELL, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set dwell %d", cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_COOLDOWN: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_COOLDOWN, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set cooldown %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_NODE_THRESHOLD: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_NODE_THRESHOLD, cmd.value, cmd.value2);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set node_threshold %d %d", cmd.value, cmd.value2);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_HORIZON: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_HORIZON, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set horizon %d", cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_MIN_RECLAIM: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_MIN_RECLAIM, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set minreclaim %d", cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_WMARK: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_WMARK, cmd.str_value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set wmark %s", cmd.str_value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_COMPACT:
+        printf("%s\n", lang_get(LANG_CLI_MSG_COMPACT));
+        if (cmd.value >= 0)
+            snprintf(cmd_buf, sizeof(cmd_buf), "compact node %d", cmd.value);
+        else
+            snprintf(cmd_buf, sizeof(cmd_buf), "compact");
+        if (send_command(cmd_buf) != 0)
+            return EXIT_FAILURE;
+        return (read_status() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_SET_FRAG: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_FRAG, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set frag %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_POLICY: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_POLICY, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set policy %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_MEMCG: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_MEMCG, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set memcg %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_RSS: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_RSS, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set rss %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_WSS: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_WSS, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set wss %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_WSS_TARGET: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_WSS_TARGET, cmd.str_value, cmd.str_value2);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set wsstarget %s %s", cmd.str_value, cmd.str_value2);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_PROACTIVE: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_PROACTIVE, cmd.str_value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set proactive %s", cmd.str_value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_PROACTIVE_PARAM: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_PROACTIVE_PARAM, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set proactiveparam %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_PROACTIVE_TARGET: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_PROACTIVE_TARGET, cmd.str_value, cmd.str_value2);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set proactivetarget %s %s", cmd.str_value, cmd.str_value2);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_MEMCG_THRESHOLD: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_MEMCG_THRESHOLD, cmd.str_value, cmd.value, cmd.value2);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set memcgthreshold %s %d %d",
+                 cmd.str_value, cmd.value, cmd.value2);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_THRASH: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_THRASH, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set thrash %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_RATE: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_RATE, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set rate %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SET_STALL: {
+        char *msg = lang_getf(LANG_CLI_MSG_SET_STALL, cmd.str_value, cmd.value);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "set stall %s %d", cmd.str_value, cmd.value);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SAMPLE_BURST: {
+        char *msg = lang_getf(LANG_CLI_MSG_SAMPLE_BURST, cmd.str_value, cmd.str_value2);
+        if (msg) {
+            printf("%s\n", msg);
+            free(msg);
+        }
+        snprintf(cmd_buf, sizeof(cmd_buf), "sample burst %s %s", cmd.str_value, cmd.str_value2);
+        return (send_command(cmd_buf) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+        
+    case CMD_SAMPLE_STOP:
+        return (send_command("sample stop") == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_SAMPLE_DUMP:
+        return (dump_burst(cmd.str_value) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_TOP:
+        return (read_top_mem() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_STATS:
+        return (read_stats_bin() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_LIVE:
+        return (read_live() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_BATCH:
+        return (run_batch(cmd.str_value) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
+    case CMD_EVENTS:
+        return (follow_events() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        
     case CMD_SELFTEST:
         return (read_selftest() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;  /* 新增: 执行自检 */
+    case CMD_SELFTEST_HISTORY:
+        return (read_selftest_history() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
         
     case CMD_LOG:
         return (read_log() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
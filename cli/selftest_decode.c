@@ -0,0 +1,57 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: cli/selftest_decode.c
+ * 描述: /proc/moeai/selftest.bin 的解码，供 moectl 和其他用户态程序使用
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <endian.h>
+#include "../include/data/selftest.h"
+
+long moeai_selftest_decode_run(const void *buf, size_t len, struct moeai_selftest_bin_run *run,
+                               const void **records)
+{
+    struct moeai_selftest_bin_run header;
+    size_t size, record_size, total;
+
+    if (!buf || !run || !records || len < sizeof(header))
+        return -EINVAL;
+
+    memcpy(&header, buf, sizeof(header));
+    if (le32toh(header.magic) != MOEAI_SELFTEST_MAGIC)
+        return -EINVAL;
+    if (le16toh(header.version) != MOEAI_SELFTEST_VERSION)
+        return -EPROTO;
+
+    /* 以运行头声明的长度为准，兼容追加了字段的新内核和字段较少的旧内核 */
+    size = le16toh(header.size);
+    record_size = le16toh(header.record_size);
+    if (size < offsetof(struct moeai_selftest_bin_run, status) || size > len || !record_size)
+        return -EINVAL;
+    total = size + (size_t)le32toh(header.nr_records) * record_size;
+    if (total > len)
+        return -EINVAL;
+
+    memset(run, 0, sizeof(*run));
+    memcpy(run, buf, size < sizeof(*run) ? size : sizeof(*run));
+    if (run->nr_tests > MOEAI_SELFTEST_MAX_TESTS)
+        run->nr_tests = MOEAI_SELFTEST_MAX_TESTS;
+    run->release[MOEAI_SELFTEST_RELEASE_LEN - 1] = '\0';
+    *records = (const char *)buf + size;
+    return (long)total;
+}
+
+void moeai_selftest_decode_record(const void *records, const struct moeai_selftest_bin_run *run,
+                                  unsigned int i, struct moeai_selftest_bin_record *rec)
+{
+    size_t record_size = le16toh(run->record_size);
+
+    memset(rec, 0, sizeof(*rec));
+    memcpy(rec, (const char *)records + i * record_size,
+           record_size < sizeof(*rec) ? record_size : sizeof(*rec));
+    rec->name[MOEAI_SELFTEST_NAME_LEN - 1] = '\0';
+}
@@ -0,0 +1,39 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: cli/stats_decode.c
+ * 描述: /proc/moeai/stats.bin 的解码，供 moectl 和其他用户态程序使用
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <endian.h>
+#include "../include/data/stats.h"
+
+int moeai_stats_decode(const void *buf, size_t len, struct moeai_stats_blob *blob)
+{
+    struct moeai_stats_header header;
+    size_t size;
+
+    if (!buf || !blob || len < sizeof(header))
+        return -EINVAL;
+
+    memcpy(&header, buf, sizeof(header));
+    if (le32toh(header.magic) != MOEAI_STATS_MAGIC)
+        return -EINVAL;
+    if (le16toh(header.version) != MOEAI_STATS_VERSION)
+        return -EPROTO;
+
+    /* 以文件头声明的长度为准，兼容追加了字段的新内核和字段较少的旧内核 */
+    size = le16toh(header.size);
+    if (size < sizeof(header) || size > len)
+        return -EINVAL;
+    if (size > sizeof(*blob))
+        size = sizeof(*blob);
+
+    memset(blob, 0, sizeof(*blob));
+    memcpy(blob, buf, size);
+    return 0;
+}
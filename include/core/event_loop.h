@@ -0,0 +1,113 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/core/event_loop.h
+ * 描述: 事件中心，各模块发布事件，用户态通过 /proc/moeai/events 等待
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_EVENT_LOOP_H
+#define _MOEAI_EVENT_LOOP_H
+
+#include <linux/types.h>
+#include <linux/fs.h>
+#include <linux/poll.h>
+
+/* 保留的最近事件数，读者落后超过此数时丢失最旧的事件 */
+#define MOEAI_EVENT_HUB_SIZE 64
+
+/* 同时登记的 eventfd 数上限 */
+#define MOEAI_EVENT_HUB_MAX_NOTIFY 32
+
+/* 事件类型，取值也是订阅掩码中的位号 */
+enum moeai_hub_event_type {
+    MOEAI_HUB_STATE_CHANGE = 0,     /* 内存压力状态变化: from/to 为状态，value 为使用率 */
+    MOEAI_HUB_RECLAIM_DONE,         /* 回收完成: from 为策略，value 为释放量 (KB) */
+    MOEAI_HUB_NODE_RECLAIM_DONE,    /* 节点定向回收完成: from 为节点，value 为释放量 (KB) */
+    MOEAI_HUB_LOG_WARN,             /* 记录了警告及以上级别的日志: from 为级别 */
+    MOEAI_HUB_EVENT_MAX
+};
+
+#define MOEAI_HUB_MASK(type) (1U << (type))
+#define MOEAI_HUB_MASK_ALL   (MOEAI_HUB_MASK(MOEAI_HUB_EVENT_MAX) - 1)
+
+/* 一条事件 */
+struct moeai_hub_event {
+    u64 seq;                        /* 事件代数，从1开始连续递增 */
+    u64 time_ns;                    /* 发布时间 (单调时钟) */
+    u32 type;                       /* enum moeai_hub_event_type */
+    s32 from;
+    s32 to;
+    s64 value;
+};
+
+/**
+ * 发布一条事件，唤醒等待的读者并通知订阅了该类型的 eventfd，可在任意上下文调用
+ */
+void moeai_event_hub_publish(enum moeai_hub_event_type type, int from, int to, s64 value);
+
+/**
+ * 获取最新的事件代数，0表示尚无事件
+ */
+u64 moeai_event_hub_seq(void);
+
+/**
+ * 读取代数大于 after 的事件
+ * @param after 读者已看到的最后代数
+ * @param out 输出，按代数递增
+ * @param max out 的容量
+ * @param lost 输出因读者落后而被覆盖的事件数
+ * @return 读到的事件数
+ */
+int moeai_event_hub_read(u64 after, struct moeai_hub_event *out, int max, u64 *lost);
+
+/**
+ * 睡眠直到有代数大于 seen 的事件或事件中心关闭，可被信号打断
+ * @return 有新事件或已关闭返回0，被打断返回 -ERESTARTSYS
+ */
+int moeai_event_hub_wait(u64 seen);
+
+/**
+ * 供 poll 使用: 有代数大于 seen 的事件时返回可读，事件中心关闭后返回 EPOLLHUP
+ */
+__poll_t moeai_event_hub_poll(struct file *file, poll_table *wait, u64 seen);
+
+/**
+ * 关闭事件中心并唤醒全部等待者，须在删除读取事件的 proc 条目之前调用，
+ * 否则阻塞的读者会让删除一直等待
+ */
+void moeai_event_hub_shutdown(void);
+
+/**
+ * 事件中心是否已关闭
+ */
+bool moeai_event_hub_is_shutdown(void);
+
+/*
+ * eventfd 订阅: 进程通过控制文件登记自己的 eventfd 和事件掩码，之后每发布一条
+ * 掩码内的事件，eventfd 的计数加一，可直接放进 epoll 等待；具体事件仍从
+ * /proc/moeai/events 或日志读取。登记属于发出命令的控制文件，文件关闭时自动注销。
+ */
+
+/**
+ * 登记或更新一个 eventfd，须在登记进程的上下文中调用，可能睡眠
+ * @param owner 登记者，通常是打开的控制文件
+ * @param fd 当前进程中的 eventfd 描述符
+ * @param mask MOEAI_HUB_MASK() 的组合，同一登记者重复登记同一 eventfd 时替换掩码
+ * @return 成功返回0，fd 不是 eventfd 返回错误码，登记数已满返回 -ENOSPC
+ */
+int moeai_event_hub_notify_add(const void *owner, int fd, u32 mask);
+
+/**
+ * 注销一个 eventfd，须在登记进程的上下文中调用，可能睡眠
+ * @return 成功返回0，未登记返回 -ENOENT
+ */
+int moeai_event_hub_notify_del(const void *owner, int fd);
+
+/**
+ * 注销登记者的全部 eventfd，可能睡眠
+ */
+void moeai_event_hub_notify_release(const void *owner);
+
+#endif /* _MOEAI_EVENT_LOOP_H */
@@ -19,7 +19,9 @@ enum moeai_system_state {
     MOEAI_STATE_NORMAL = 0,    /* 正常状态 */
     MOEAI_STATE_WARNING,       /* 警告状态 */
     MOEAI_STATE_CRITICAL,      /* 临界状态 */
-    MOEAI_STATE_EMERGENCY      /* 紧急状态 */
+    MOEAI_STATE_EMERGENCY,     /* 紧急状态 */
+    MOEAI_STATE_THRASHING,     /* 抖动状态：工作集反复换出换入，应停止回收 */
+    MOEAI_STATE_MAX            /* 边界检查 */
 };
 
 /* 资源类型 */
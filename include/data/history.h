@@ -0,0 +1,81 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/data/history.h
+ * 描述: 采样历史与定点趋势预测接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef MOEAI_HISTORY_H
+#define MOEAI_HISTORY_H
+
+#include <linux/types.h>
+
+/* 历史环形缓冲长度 */
+#define MOEAI_HISTORY_LEN 32
+
+/* 定点数格式: Q16，内核中不能使用浮点运算 */
+#define MOEAI_FP_SHIFT 16
+#define MOEAI_FP_ONE   (1LL << MOEAI_FP_SHIFT)
+#define MOEAI_FP(x)    ((s64)(x) << MOEAI_FP_SHIFT)
+
+/* 采样历史与 Holt 双指数平滑状态 */
+struct moeai_history {
+    s64 samples[MOEAI_HISTORY_LEN]; /* 原始采样值 (定点) */
+    unsigned int head;              /* 下一个写入位置 */
+    unsigned int count;             /* 有效采样数 */
+    s64 level;                      /* 平滑后的水平值 (定点) */
+    s64 trend;                      /* 平滑后的斜率 (定点，每秒变化量) */
+    u32 alpha;                      /* 水平平滑系数 (定点，0~MOEAI_FP_ONE) */
+    u32 beta;                       /* 斜率平滑系数 (定点，0~MOEAI_FP_ONE) */
+};
+
+/**
+ * 初始化采样历史
+ * @param h 历史结构体
+ * @param alpha 水平平滑系数 (定点)
+ * @param beta 斜率平滑系数 (定点)
+ */
+void moeai_history_init(struct moeai_history *h, u32 alpha, u32 beta);
+
+/**
+ * 清空采样历史，保留平滑系数
+ * @param h 历史结构体
+ */
+void moeai_history_reset(struct moeai_history *h);
+
+/**
+ * 加入一个新采样并更新水平值和斜率
+ * @param h 历史结构体
+ * @param value 采样值 (定点)
+ * @param dt_ms 距上一个采样的时间 (毫秒)
+ */
+void moeai_history_add(struct moeai_history *h, s64 value, unsigned int dt_ms);
+
+/**
+ * 获取第 idx 个最近的采样，0 为最新
+ * @param h 历史结构体
+ * @param idx 采样序号
+ * @return 采样值 (定点)，超出范围时返回0
+ */
+s64 moeai_history_get(const struct moeai_history *h, unsigned int idx);
+
+/**
+ * 预测 ahead_ms 毫秒后的值
+ * @param h 历史结构体
+ * @param ahead_ms 预测时长 (毫秒)
+ * @return 预测值 (定点)
+ */
+s64 moeai_history_forecast(const struct moeai_history *h, unsigned int ahead_ms);
+
+/**
+ * 估算到达阈值所需的时间
+ * @param h 历史结构体
+ * @param threshold 阈值 (定点)
+ * @param ms 输出：预计到达时间 (毫秒)，已超过阈值时为0
+ * @return 成功返回0；采样不足或趋势不在上升时返回-ERANGE
+ */
+int moeai_history_time_to(const struct moeai_history *h, s64 threshold, unsigned int *ms);
+
+#endif /* MOEAI_HISTORY_H */
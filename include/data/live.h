@@ -0,0 +1,186 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/data/live.h
+ * 描述: /proc/moeai/live 只读共享页的布局及用户态读取函数
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef MOEAI_LIVE_H
+#define MOEAI_LIVE_H
+
+#include "stats.h"
+
+/*
+ * 实时页: 内存监控每次检查后把最新结果写入一个共享页，用户态用 mmap 映射
+ * /proc/moeai/live 后直接读取，无需系统调用。字段编码与 stats.bin 相同 (小端、无填充)。
+ *
+ * 刷新频率: 容量类字段 (mem 中的内存与交换空间用量) 和 header.update_ns 每
+ * MOEAI_LIVE_REFRESH_MS 毫秒刷新一次；速率、状态机与计数随每次检查
+ * (check_interval_ms，默认60秒) 更新，两次检查之间保持不变。监控停止后页面不再更新。
+ *
+ * 一致性由 header.seq 保证: 内核更新前后各把 seq 加一，seq 为奇数表示正在更新；
+ * 读者在两次读到相同的偶数 seq 之间复制的内容是一致的快照，见 moeai_live_read()。
+ * 兼容规则同 stats.bin: 新字段只追加并增大 header.size，页中超出 size 的部分恒为0。
+ */
+#define MOEAI_LIVE_MAGIC   0x564c4f4dU /* 小端字节序为 "MOLV" */
+#define MOEAI_LIVE_VERSION 1
+
+/* 容量类字段的刷新间隔 (毫秒) */
+#define MOEAI_LIVE_REFRESH_MS 1000
+
+/* 页头 */
+struct moeai_live_header {
+    __le32 magic;
+    __le16 version;
+    __le16 size;            /* 页头与数据的总字节数 */
+    __le32 seq;             /* 更新序号，奇数表示正在更新 */
+    __le32 flags;           /* MOEAI_STATS_F_AUTO_RECLAIM、MOEAI_STATS_F_WMARK_TRIGGER */
+    __le64 update_ns;       /* 最近一次更新时间 (CLOCK_MONOTONIC) */
+} __attribute__((packed));
+
+/* 状态机的累计计数，含义同 struct moeai_stats_counters 的同名字段 */
+struct moeai_live_counters {
+    __le64 transitions;
+    __le64 state_entries[MOEAI_STATS_NR_STATES];
+    __le64 reclaim_runs[MOEAI_STATS_NR_POLICIES];
+    __le64 reclaim_suppressed[MOEAI_STATS_NR_POLICIES];
+    __le64 thrash_suppressed;
+    __le64 reclaim_futile;
+    __le64 wmark_low_events;
+} __attribute__((packed));
+
+/* 实时页的完整内容 */
+struct moeai_live_page {
+    struct moeai_live_header header;
+    struct moeai_stats_mem mem;
+    struct moeai_stats_rates rates;
+    struct moeai_live_counters counters;
+} __attribute__((packed));
+
+#ifdef __KERNEL__
+
+struct vm_area_struct;
+struct moeai_mem_stats;
+struct moeai_mem_state_info;
+
+/**
+ * 分配并初始化实时页，须在内存监控启动前调用
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_live_init(void);
+
+/**
+ * 释放实时页，须在内存监控停止后调用；仍被映射的页在最后一个映射解除后才真正释放
+ */
+void moeai_live_exit(void);
+
+/**
+ * 更新实时页，可在软中断上下文调用，调用者须保证同一时刻只有一个写者
+ * @param stats 最新内存统计与速率
+ * @param info 状态机信息与累计计数
+ * @param flags MOEAI_STATS_F_*
+ */
+void moeai_live_update(const struct moeai_mem_stats *stats,
+                       const struct moeai_mem_state_info *info, u32 flags);
+
+/**
+ * 把实时页只读映射到用户地址空间
+ * @param vma 映射区域，偏移须为0且长度不超过一页
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_live_mmap(struct vm_area_struct *vma);
+
+#else /* !__KERNEL__ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <endian.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define MOEAI_LIVE_PATH "/proc/moeai/live"
+
+/* 放弃前重试的次数，内核的一次更新只持续几微秒 */
+#define MOEAI_LIVE_RETRIES 1000
+
+/**
+ * 只读映射实时页
+ * @return 成功返回映射地址，失败返回 NULL 并设置 errno
+ */
+static inline const void *moeai_live_map(void)
+{
+    void *page;
+    int fd;
+
+    fd = open(MOEAI_LIVE_PATH, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    page = mmap(NULL, sizeof(struct moeai_live_page), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return page == MAP_FAILED ? NULL : page;
+}
+
+/**
+ * 解除实时页的映射
+ * @param page moeai_live_map() 的返回值
+ */
+static inline void moeai_live_unmap(const void *page)
+{
+    if (page)
+        munmap((void *)page, sizeof(struct moeai_live_page));
+}
+
+/* 读取页头的更新序号 */
+static inline uint32_t moeai_live_seq(const void *page)
+{
+    const volatile uint32_t *seq = (const volatile uint32_t *)
+        ((const char *)page + offsetof(struct moeai_live_header, seq));
+
+    return le32toh(*seq);
+}
+
+/**
+ * 复制实时页的一致快照，不进入内核
+ * 结果仍为小端，字段用 le16toh/le32toh/le64toh 读取；旧内核不提供的字段读出为0
+ * @param page moeai_live_map() 的返回值
+ * @param out 输出
+ * @return 成功返回0，内核持续更新导致重试耗尽返回 -EAGAIN，
+ *         magic 不符返回 -EINVAL，版本不支持返回 -EPROTO
+ */
+static inline int moeai_live_read(const void *page, struct moeai_live_page *out)
+{
+    uint32_t begin, end;
+    int i;
+
+    if (!page || !out)
+        return -EINVAL;
+
+    for (i = 0; i < MOEAI_LIVE_RETRIES; i++) {
+        begin = moeai_live_seq(page);
+        if (begin & 1)
+            continue;
+        /* 先读 seq 再读数据，读完数据再确认 seq，与内核的写屏障配对 */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        memcpy(out, page, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = moeai_live_seq(page);
+        if (begin != end)
+            continue;
+
+        if (le32toh(out->header.magic) != MOEAI_LIVE_MAGIC)
+            return -EINVAL;
+        if (le16toh(out->header.version) != MOEAI_LIVE_VERSION)
+            return -EPROTO;
+        return 0;
+    }
+    return -EAGAIN;
+}
+
+#endif /* __KERNEL__ */
+
+#endif /* MOEAI_LIVE_H */
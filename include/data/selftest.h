@@ -0,0 +1,224 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/data/selftest.h
+ * 描述: 自检的结构化结果、历史记录及 /proc/moeai/selftest.bin 的二进制格式
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef MOEAI_SELFTEST_H
+#define MOEAI_SELFTEST_H
+
+#include <linux/types.h>
+
+/*
+ * 每次自检运行记录各测试的结果和一组定长记录 (数值、错误、基准测试、可扩展性)，
+ * 保留最近 MOEAI_SELFTEST_HISTORY 次运行，文本和二进制输出都由记录渲染。
+ *
+ * selftest.bin 依次输出保留的各次运行，从旧到新；每次运行是一个运行头后接
+ * nr_records 条记录。所有字段均为小端、无填充。兼容规则同 stats.bin:
+ * 新字段只追加在运行头或记录末尾并增大 size / record_size，读者按这两个长度跳过；
+ * 删除或改变已有字段时才增加 version。
+ */
+#define MOEAI_SELFTEST_MAGIC   0x54534f4dU /* 小端字节序为 "MOST" */
+#define MOEAI_SELFTEST_VERSION 1
+
+/* 保留的运行次数 */
+#define MOEAI_SELFTEST_HISTORY 8
+
+/* 格式中的长度 */
+#define MOEAI_SELFTEST_MAX_TESTS   16
+#define MOEAI_SELFTEST_NAME_LEN    32
+#define MOEAI_SELFTEST_NR_VALUES   5
+#define MOEAI_SELFTEST_RELEASE_LEN 64
+
+/* 测试编号，取值固定在格式中，只能追加 */
+enum moeai_selftest_id {
+    MOEAI_SELFTEST_SYSINFO = 0,
+    MOEAI_SELFTEST_MEMORY,
+    MOEAI_SELFTEST_NET_GUARD,
+    MOEAI_SELFTEST_FS_LOGGER,
+    MOEAI_SELFTEST_RING_BUFFER,
+    MOEAI_SELFTEST_LOGGER,
+    MOEAI_SELFTEST_PROCFS,
+    MOEAI_SELFTEST_PERFORMANCE,
+    MOEAI_SELFTEST_SCALABILITY,
+    MOEAI_SELFTEST_NR_TESTS
+};
+
+/* 记录类型，决定 arg 和 v[] 的含义 */
+enum moeai_selftest_rec_type {
+    MOEAI_SELFTEST_REC_VALUE = 0,   /* v[0] 为数值 */
+    MOEAI_SELFTEST_REC_ERROR,       /* err 为失败的错误码，arg 为线程数 (可为0) */
+    MOEAI_SELFTEST_REC_BENCH,       /* v 为 min/median/p99/max (纳秒) 和迭代次数 */
+    MOEAI_SELFTEST_REC_SCALE,       /* arg 为线程数，v 为 ops/s、相对单线程倍数 (x100)、
+                                     * 等待锁的次数和总操作数 */
+};
+
+/* 运行头 */
+struct moeai_selftest_bin_run {
+    __le32 magic;
+    __le16 version;
+    __le16 size;            /* 运行头字节数 */
+    __le16 record_size;     /* 每条记录的字节数 */
+    __u8 nr_tests;          /* status 中有效的项数 */
+    __u8 reserved0;
+    __le32 nr_records;
+    __le64 gen;             /* 运行代数 */
+    __le64 start_ns;        /* 开始时间 (CLOCK_REALTIME) */
+    __le64 duration_ns;
+    __le32 dropped;         /* 内存不足未能保存的记录数 */
+    __le32 reserved;
+    __u8 status[MOEAI_SELFTEST_MAX_TESTS]; /* 按测试编号的结果，取值同 moeai_selftest_result_t */
+    char release[MOEAI_SELFTEST_RELEASE_LEN]; /* 内核版本，以 NUL 结尾 */
+} __attribute__((packed));
+
+/* 一条记录 */
+struct moeai_selftest_bin_record {
+    __u8 test;              /* enum moeai_selftest_id */
+    __u8 type;              /* enum moeai_selftest_rec_type */
+    __le16 arg;
+    __le32 err;             /* 负的错误码按补码保存 */
+    char name[MOEAI_SELFTEST_NAME_LEN]; /* 以 NUL 结尾 */
+    __le64 v[MOEAI_SELFTEST_NR_VALUES];
+} __attribute__((packed));
+
+#ifdef __KERNEL__
+
+#include <linux/kref.h>
+#include <linux/list.h>
+
+struct seq_file;
+struct moeai_bench_result;
+
+/* 内存中的一条记录，字段含义同 struct moeai_selftest_bin_record */
+struct moeai_selftest_record {
+    u8 test;
+    u8 type;
+    u16 arg;
+    s32 err;
+    char name[MOEAI_SELFTEST_NAME_LEN];
+    u64 v[MOEAI_SELFTEST_NR_VALUES];
+};
+
+/*
+ * 一次运行。运行期间只由自检工作写入，发布到历史记录后不再修改，
+ * 读者持有引用即可无锁访问
+ */
+struct moeai_selftest_run {
+    struct kref ref;
+    struct list_head node;          /* 在历史记录中的位置 */
+    u64 gen;
+    u64 start_ns;                   /* CLOCK_REALTIME */
+    u64 start_mono_ns;
+    u64 duration_ns;
+    u8 status[MOEAI_SELFTEST_NR_TESTS];
+    char release[MOEAI_SELFTEST_RELEASE_LEN];
+    unsigned int cur_test;          /* 新记录归属的测试 */
+    unsigned int nr_records;
+    unsigned int max_records;       /* records 的容量，写满时翻倍 */
+    unsigned int dropped;
+    struct moeai_selftest_record *records;
+};
+
+/**
+ * 分配一次运行，可能睡眠
+ * @param gen 运行代数
+ * @return 持有一个引用的运行，失败返回 NULL
+ */
+struct moeai_selftest_run *moeai_selftest_run_alloc(u64 gen);
+
+void moeai_selftest_run_get(struct moeai_selftest_run *run);
+void moeai_selftest_run_put(struct moeai_selftest_run *run);
+
+/**
+ * 开始一项测试，之后添加的记录都归属于它
+ */
+void moeai_selftest_begin(struct moeai_selftest_run *run, enum moeai_selftest_id test);
+
+/**
+ * 记录一项测试的结果
+ */
+void moeai_selftest_end(struct moeai_selftest_run *run, enum moeai_selftest_id test, u8 status);
+
+/**
+ * 结束运行，记录总耗时
+ */
+void moeai_selftest_finish(struct moeai_selftest_run *run);
+
+/* 添加记录，可能睡眠；记录数组无法增长时只计入 dropped */
+void moeai_selftest_value(struct moeai_selftest_run *run, const char *name, u64 value);
+void moeai_selftest_error(struct moeai_selftest_run *run, const char *name,
+                          unsigned int threads, int err);
+void moeai_selftest_bench(struct moeai_selftest_run *run, const char *name,
+                          const struct moeai_bench_result *res);
+void moeai_selftest_scale(struct moeai_selftest_run *run, const char *name,
+                          unsigned int threads, u64 ops_per_sec, u64 speedup_x100,
+                          u64 contended, u64 ops);
+
+/**
+ * 在另一次运行中查找同一测试、同类型、同参数、同名的记录，用于对比
+ * @return 找到的记录，没有返回 NULL
+ */
+const struct moeai_selftest_record *moeai_selftest_find(const struct moeai_selftest_run *run,
+                                                        const struct moeai_selftest_record *rec);
+
+/**
+ * 把完成的运行加入历史记录，接管调用者的引用，超出保留次数时丢弃最旧的运行
+ */
+void moeai_selftest_publish(struct moeai_selftest_run *run);
+
+/**
+ * 获取最近一次完成的运行及其前一次运行，各持有一个引用
+ * @param prev 输出前一次运行，没有时为 NULL，可为 NULL
+ * @return 最近一次运行，尚未运行过返回 NULL
+ */
+struct moeai_selftest_run *moeai_selftest_latest(struct moeai_selftest_run **prev);
+
+/**
+ * 获取保留的全部运行，从旧到新，各持有一个引用
+ * @param runs 输出
+ * @param max runs 的容量
+ * @return 运行数
+ */
+int moeai_selftest_history(struct moeai_selftest_run **runs, int max);
+
+/**
+ * 清空历史记录
+ */
+void moeai_selftest_clear_history(void);
+
+/**
+ * 按二进制格式输出一次运行
+ */
+void moeai_selftest_encode(struct seq_file *m, const struct moeai_selftest_run *run);
+
+#else /* !__KERNEL__ */
+
+#include <stddef.h>
+
+/**
+ * 校验并解码 selftest.bin 中的一次运行，结果仍为小端，字段用 le16toh/le32toh/le64toh 读取
+ * @param buf 从该次运行开头起的数据
+ * @param len 数据长度
+ * @param run 输出运行头，旧内核不提供的字段读出为0
+ * @param records 输出第一条记录的位置，用 moeai_selftest_decode_record() 读取
+ * @return 成功返回该次运行占用的字节数，数据不完整或 magic 不符返回 -EINVAL，版本不支持返回 -EPROTO
+ */
+long moeai_selftest_decode_run(const void *buf, size_t len, struct moeai_selftest_bin_run *run,
+                               const void **records);
+
+/**
+ * 读取一次运行中的第 i 条记录，旧内核不提供的字段读出为0
+ * @param records moeai_selftest_decode_run() 输出的记录位置
+ * @param run 该次运行的运行头
+ * @param i 记录序号，须小于 nr_records
+ * @param rec 输出
+ */
+void moeai_selftest_decode_record(const void *records, const struct moeai_selftest_bin_run *run,
+                                  unsigned int i, struct moeai_selftest_bin_record *rec);
+
+#endif /* __KERNEL__ */
+
+#endif /* MOEAI_SELFTEST_H */
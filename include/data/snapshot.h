@@ -0,0 +1,115 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/data/snapshot.h
+ * 描述: 内存状态快照缓冲区及其二进制导出格式
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef MOEAI_SNAPSHOT_H
+#define MOEAI_SNAPSHOT_H
+
+#include <linux/types.h>
+
+/*
+ * 二进制导出格式: 一个文件头后接 count 条定长记录，均为小端、无填充，
+ * 字段宽度固定，与内核的 unsigned long 宽度无关，便于离线分析。
+ */
+#define MOEAI_SNAPSHOT_MAGIC   0x42454f4dU /* 小端字节序为 "MOEB" */
+#define MOEAI_SNAPSHOT_VERSION 1
+
+/* 单次突发采样的最大记录数 */
+#define MOEAI_SNAPSHOT_MAX_RECORDS 32768
+
+/* 导出文件头 */
+struct moeai_snapshot_header {
+    __u32 magic;
+    __u16 version;
+    __u16 record_size;      /* 单条记录字节数 */
+    __u32 count;            /* 记录数 */
+    __u32 flags;            /* MOEAI_SNAPSHOT_F_* */
+    __u64 interval_ns;      /* 采样间隔 */
+    __u64 start_ns;         /* 开始时间 (CLOCK_REALTIME) */
+} __attribute__((packed));
+
+#define MOEAI_SNAPSHOT_F_RUNNING  0x1 /* 采样尚未结束 */
+#define MOEAI_SNAPSHOT_F_TRUNCATED 0x2 /* 缓冲区已满，提前结束 */
+
+/* 单条快照记录，对应一次 struct moeai_mem_stats */
+struct moeai_snapshot_record {
+    __u64 timestamp_ns;     /* 采样时间 (CLOCK_REALTIME) */
+    __u64 total_kb;
+    __u64 free_kb;
+    __u64 available_kb;
+    __u64 cached_kb;
+    __u64 swap_total_kb;
+    __u64 swap_free_kb;
+    __u32 mem_usage_percent;
+    __u32 swap_usage_percent;
+    __u32 rate_interval_us; /* 以下速率的计算间隔 */
+    __u32 reserved;
+    __u64 pgfault;          /* 以下均为每秒速率 */
+    __u64 pgmajfault;
+    __u64 pgscan_kswapd;
+    __u64 pgscan_direct;
+    __u64 pgsteal_kswapd;
+    __u64 pgsteal_direct;
+    __u64 allocstall;
+    __u64 refault;
+    __u64 pswpin;
+    __u64 pswpout;
+    __u64 activate;
+} __attribute__((packed));
+
+#ifdef __KERNEL__
+
+/* 预分配的快照缓冲区 */
+struct moeai_snapshot_buffer {
+    struct moeai_snapshot_header header; /* count 字段仅在导出时填写 */
+    struct moeai_snapshot_record *records;
+    unsigned int capacity;
+    unsigned int count;             /* 已提交的记录数 */
+};
+
+/**
+ * 分配快照缓冲区，可能睡眠
+ * @param buf 缓冲区
+ * @param capacity 记录容量，不超过 MOEAI_SNAPSHOT_MAX_RECORDS
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_snapshot_alloc(struct moeai_snapshot_buffer *buf, unsigned int capacity);
+
+/**
+ * 释放快照缓冲区
+ * @param buf 缓冲区
+ */
+void moeai_snapshot_free(struct moeai_snapshot_buffer *buf);
+
+/**
+ * 获取下一条可写记录，可在原子上下文调用
+ * @param buf 缓冲区
+ * @return 记录指针，缓冲区已满时返回NULL
+ */
+struct moeai_snapshot_record *moeai_snapshot_next(struct moeai_snapshot_buffer *buf);
+
+/**
+ * 提交通过 moeai_snapshot_next 获取的记录，使读者可见
+ * @param buf 缓冲区
+ */
+void moeai_snapshot_commit(struct moeai_snapshot_buffer *buf);
+
+/**
+ * 将文件头和已提交的记录按二进制格式复制到用户空间
+ * @param buf 缓冲区
+ * @param ubuf 用户缓冲区
+ * @param count 用户缓冲区大小
+ * @param ppos 文件偏移
+ * @return 复制的字节数，负值表示错误
+ */
+ssize_t moeai_snapshot_read(struct moeai_snapshot_buffer *buf, char __user *ubuf,
+                            size_t count, loff_t *ppos);
+
+#endif /* __KERNEL__ */
+
+#endif /* MOEAI_SNAPSHOT_H */
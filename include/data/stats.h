@@ -0,0 +1,168 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/data/stats.h
+ * 描述: /proc/moeai/stats.bin 的二进制统计格式
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef MOEAI_STATS_H
+#define MOEAI_STATS_H
+
+#include <linux/types.h>
+
+/*
+ * 二进制统计格式: 一个文件头后接定长的统计数据，所有字段均为小端、无填充，
+ * 字段宽度固定，与内核的 unsigned long 宽度和主机字节序无关。
+ * 兼容规则: 新字段只追加在末尾并增大 header.size，旧解码器按自己认识的长度读取；
+ * 删除或改变已有字段时才增加 version。
+ */
+#define MOEAI_STATS_MAGIC   0x53454f4dU /* 小端字节序为 "MOES" */
+#define MOEAI_STATS_VERSION 1
+
+/* 数组长度固定在格式中，内核枚举增长时必须增加 version */
+#define MOEAI_STATS_NR_STATES   5 /* 正常/警告/临界/紧急/抖动 */
+#define MOEAI_STATS_NR_POLICIES 3 /* 温和/中等/积极 */
+
+/* 文件头 */
+struct moeai_stats_header {
+    __le32 magic;
+    __le16 version;
+    __le16 size;            /* 文件头与数据的总字节数 */
+    __le32 flags;           /* MOEAI_STATS_F_* */
+    __le32 reserved;
+    __le64 timestamp_ns;    /* 生成时间 (CLOCK_REALTIME) */
+} __attribute__((packed));
+
+#define MOEAI_STATS_F_AUTO_RECLAIM 0x1 /* 自动回收已开启 */
+#define MOEAI_STATS_F_WMARK_TRIGGER 0x2 /* 水位触发已开启 */
+#define MOEAI_STATS_F_STALL_ATTACHED 0x4 /* 停顿统计已挂接到跟踪点 */
+
+/* 最近一次检查的内存统计 */
+struct moeai_stats_mem {
+    __le64 sample_ns;       /* 采样时间 (CLOCK_REALTIME) */
+    __le64 total_kb;
+    __le64 free_kb;
+    __le64 available_kb;
+    __le64 cached_kb;
+    __le64 swap_total_kb;
+    __le64 swap_free_kb;
+    __le32 mem_usage_percent;
+    __le32 swap_usage_percent;
+    __le32 state;           /* 压力状态，取值同 enum moeai_system_state */
+    __le32 state_ms;        /* 已处于当前状态的时间 (毫秒) */
+} __attribute__((packed));
+
+/* 最近一次检查得到的活动速率 */
+struct moeai_stats_rates {
+    __le32 interval_ms;     /* 计算速率使用的采样间隔，0表示尚无有效速率 */
+    __le32 reserved;
+    __le64 pgfault;         /* 以下均为每秒速率 */
+    __le64 pgmajfault;
+    __le64 pgscan_kswapd;
+    __le64 pgscan_direct;
+    __le64 pgsteal_kswapd;
+    __le64 pgsteal_direct;
+    __le64 allocstall;
+    __le64 refault;
+    __le64 pswpin;
+    __le64 pswpout;
+    __le64 activate;
+    __le64 kswapd_run;
+    __le64 kswapd_quick;
+} __attribute__((packed));
+
+/* 内存监控配置，开关量见文件头的 flags */
+struct moeai_stats_config {
+    __le32 check_interval_ms;
+    __le32 warn_threshold;
+    __le32 critical_threshold;
+    __le32 emergency_threshold;
+    __le32 warn_exit_threshold;
+    __le32 critical_exit_threshold;
+    __le32 emergency_exit_threshold;
+    __le32 min_dwell_ms;
+    __le32 reclaim_cooldown_ms[MOEAI_STATS_NR_POLICIES];
+    __le32 node_warn_threshold;
+    __le32 node_critical_threshold;
+    __le32 node_reclaim_kb;
+    __le32 forecast_horizon_ms;
+    __le32 thrash_activate_percent;
+    __le32 stall_warn_us;
+    __le32 stall_critical_us;
+    __le32 reserved;
+    __le64 direct_scan_rate_threshold;
+    __le64 allocstall_rate_threshold;
+    __le64 refault_rate_threshold;
+    __le64 thrash_swap_threshold;
+    __le64 thrash_refault_threshold;
+    __le64 min_reclaimable_kb;
+} __attribute__((packed));
+
+/* 模块加载以来的累计计数 */
+struct moeai_stats_counters {
+    __le64 transitions;
+    __le64 state_entries[MOEAI_STATS_NR_STATES];
+    __le64 reclaim_runs[MOEAI_STATS_NR_POLICIES];
+    __le64 reclaim_suppressed[MOEAI_STATS_NR_POLICIES];
+    __le64 thrash_suppressed;
+    __le64 reclaim_futile;
+    __le64 wmark_low_events;
+    __le64 forecast_predictions;
+    __le64 forecast_hits;
+    __le64 forecast_false_alarms;
+    __le64 forecast_misses;
+    __le64 forecast_triggers;
+    __le64 stall_count;     /* 直接回收停顿次数 */
+    __le64 stall_total_us;
+    __le64 stall_max_us;
+    __le64 stall_untracked;
+} __attribute__((packed));
+
+/* stats.bin 的完整内容 */
+struct moeai_stats_blob {
+    struct moeai_stats_header header;
+    struct moeai_stats_mem mem;
+    struct moeai_stats_rates rates;
+    struct moeai_stats_config config;
+    struct moeai_stats_counters counters;
+} __attribute__((packed));
+
+#ifdef __KERNEL__
+
+struct moeai_mem_stats;
+
+/**
+ * 按二进制格式编码一次内存统计和速率，不加锁，可在任意上下文调用
+ * @param stats 内存统计
+ * @param m 输出的内存统计，state 与 state_ms 不填写
+ * @param out 输出的速率
+ */
+void moeai_stats_fill_mem(const struct moeai_mem_stats *stats,
+                          struct moeai_stats_mem *m, struct moeai_stats_rates *out);
+
+/**
+ * 采集当前的统计、配置和计数并按二进制格式编码，可能睡眠
+ * @param blob 输出
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_stats_encode(struct moeai_stats_blob *blob);
+
+#else /* !__KERNEL__ */
+
+#include <stddef.h>
+
+/**
+ * 校验并解码 stats.bin 的内容，结果仍为小端，字段用 le16toh/le32toh/le64toh 读取
+ * 旧内核不提供的字段读出为0，新内核追加的未知字段被忽略
+ * @param buf 读到的数据
+ * @param len 数据长度
+ * @param blob 输出
+ * @return 成功返回0，长度不足或 magic 不符返回 -EINVAL，版本不支持返回 -EPROTO
+ */
+int moeai_stats_decode(const void *buf, size_t len, struct moeai_stats_blob *blob);
+
+#endif /* __KERNEL__ */
+
+#endif /* MOEAI_STATS_H */
@@ -0,0 +1,46 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/ipc/control.h
+ * 描述: 控制命令分发接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_CONTROL_H
+#define _MOEAI_CONTROL_H
+
+#include <linux/types.h>
+
+/* 一次写入的命令批大小上限，批内以换行分隔，空行和 # 开头的行被忽略 */
+#define MOEAI_CTL_MAX_BATCH  4096
+
+/* 每个打开的控制文件保存的执行结果大小 */
+#define MOEAI_CTL_RESULT_LEN 8192
+
+/**
+ * 注册内置命令
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_control_init(void);
+
+/**
+ * 注销内置命令
+ */
+void moeai_control_exit(void);
+
+/**
+ * 执行一批命令，可能睡眠，须在写入控制文件的进程上下文中调用
+ * 先解析全部命令，任一条无法识别或参数有误则整批不执行；
+ * 各条 set 命令修改的配置在一个事务中提交，每个模块只提交一次，
+ * 某个模块拒绝新配置时已提交的模块回滚到原配置；
+ * 配置提交后再依次执行回收、采样等动作类命令。
+ * @param batch 以换行分隔的命令，执行时会被修改
+ * @param result 输出每条命令的执行结果，每行一条
+ * @param size 结果缓冲区大小
+ * @param owner 发出命令的控制文件，notify 等登记随它关闭而注销
+ * @return 全部成功返回0，否则返回第一个错误码
+ */
+int moeai_control_run(char *batch, char *result, size_t size, const void *owner);
+
+#endif /* _MOEAI_CONTROL_H */
@@ -0,0 +1,22 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/ipc/metrics.h
+ * 描述: /proc/moeai/metrics 的 Prometheus 文本格式导出
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_METRICS_H
+#define _MOEAI_METRICS_H
+
+#include <linux/proc_fs.h>
+
+/*
+ * 指标命名规则: moeai_<子系统>_<名称>_<单位>，单位使用基本单位 (bytes、seconds)，
+ * 累计计数以 _total 结尾；枚举值 (状态、策略、级别) 放在标签中。
+ * 指标名和帮助文本固定为英文，不随界面语言变化。
+ */
+extern const struct proc_ops moeai_metrics_fops;
+
+#endif /* _MOEAI_METRICS_H */
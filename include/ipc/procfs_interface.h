@@ -18,12 +18,13 @@
 #define MOEAI_PROCFS_CONTROL "control"
 #define MOEAI_PROCFS_LOG     "log"
 #define MOEAI_PROCFS_SELFTEST "selftest"  /* 新增: 自检接口路径 */
-
-/* 命令字符串最大长度 */
-#define MOEAI_MAX_CMD_LEN    256
-
-/* 自检结果存储的最大长度 */
-#define MOEAI_MAX_SELFTEST_LEN  8192
+#define MOEAI_PROCFS_BURST   "burst"     /* 突发采样二进制导出 */
+#define MOEAI_PROCFS_TOP_MEM "top_mem"   /* 进程内存排行 */
+#define MOEAI_PROCFS_STATS_BIN "stats.bin" /* 二进制统计，格式见 data/stats.h */
+#define MOEAI_PROCFS_METRICS "metrics"   /* Prometheus 文本格式指标 */
+#define MOEAI_PROCFS_EVENTS  "events"    /* 状态变化和回收完成事件，支持 poll */
+#define MOEAI_PROCFS_LIVE    "live"      /* 只读共享页，格式见 data/live.h */
+#define MOEAI_PROCFS_SELFTEST_BIN "selftest.bin" /* 二进制自检历史，格式见 data/selftest.h */
 
 /* 自检功能的结果码 */
 typedef enum moeai_selftest_result {
@@ -37,7 +38,13 @@ typedef enum moeai_selftest_result {
 int moeai_procfs_init(void);
 void moeai_procfs_exit(void);
 
-/* 自检功能触发函数 (提供给 control write 使用) */
-int moeai_trigger_selftest(void);
+/**
+ * 触发自检，自检在工作队列中异步运行 (提供给 control write 使用)
+ * 已有自检在运行时不再排队，合并到正在进行的运行
+ * 完成后结果出现在 /proc/moeai/selftest 和 selftest.bin，打开 selftest 的读者可用 poll 等待
+ * @param gen 输出本次请求对应的运行代数，可为 NULL
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_trigger_selftest(u64 *gen);
 
 #endif /* _MOEAI_PROCFS_INTERFACE_H */
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/mem_frag.h
+ * 描述: 内存碎片监控与主动规整接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_MEM_FRAG_H
+#define _MOEAI_MEM_FRAG_H
+
+#include <linux/types.h>
+#include <linux/mmzone.h>
+#include <linux/version.h>
+
+/* 伙伴系统的阶数，MAX_ORDER 的含义在 6.4 变为闭区间，6.8 起改用 NR_PAGE_ORDERS */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+#define MOEAI_FRAG_NR_ORDERS NR_PAGE_ORDERS
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(6, 4, 0)
+#define MOEAI_FRAG_NR_ORDERS (MAX_ORDER + 1)
+#else
+#define MOEAI_FRAG_NR_ORDERS MAX_ORDER
+#endif
+
+/* 支持统计的最大节点数与区域数 */
+#define MOEAI_FRAG_MAX_NODES 16
+#define MOEAI_FRAG_MAX_ZONES (MOEAI_FRAG_MAX_NODES * MAX_NR_ZONES)
+
+/* 区域碎片统计 */
+struct moeai_frag_zone_stats {
+    int nid;                        /* 节点编号 */
+    const char *zone_name;          /* 区域名称 */
+    unsigned long free_pages;       /* 空闲页数 */
+    unsigned long nr_free[MOEAI_FRAG_NR_ORDERS]; /* 各阶空闲块数 (同 /proc/buddyinfo) */
+    int frag_index[MOEAI_FRAG_NR_ORDERS]; /* 各阶碎片化指数 x1000，-1000表示该阶可直接满足 */
+    unsigned int high_order_percent; /* 空闲内存中位于不低于关注阶数的块中的比例 */
+    u64 compact_runs;               /* 针对该区域触发的规整次数 */
+    unsigned long last_before;      /* 最近一次规整前不低于关注阶数的空闲块数 */
+    unsigned long last_after;       /* 最近一次规整后不低于关注阶数的空闲块数 */
+};
+
+/* 碎片监控配置 */
+struct moeai_frag_config {
+    unsigned int order;             /* 关注的高阶分配阶数 */
+    unsigned int min_high_order_percent; /* 高阶可用比例低于此值时考虑规整 (百分比) */
+    int index_threshold;            /* 碎片化指数不低于此值才规整 (x1000)，更低说明是内存不足而非碎片 */
+    unsigned int compact_cooldown_ms; /* 同一区域两次规整的最短间隔 (毫秒) */
+    unsigned int max_zones_per_run; /* 每次检查最多规整的区域数 */
+};
+
+/**
+ * 初始化碎片监控
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_frag_init(void);
+
+/**
+ * 清理碎片监控
+ */
+void moeai_mem_frag_exit(void);
+
+/**
+ * 等待已提交的规整完成
+ */
+void moeai_mem_frag_stop(void);
+
+/**
+ * 采集各区域的空闲块分布，并为碎片最严重的区域调度规整
+ * 可在定时器或进程上下文调用，规整在工作队列中异步执行
+ * @param allow_compact 是否允许自动规整
+ */
+void moeai_mem_frag_check(bool allow_compact);
+
+/**
+ * 获取各区域的碎片统计
+ * @param zones 输出数组
+ * @param max_zones 数组容量
+ * @return 区域数，负值表示错误
+ */
+int moeai_mem_frag_get_stats(struct moeai_frag_zone_stats *zones, int max_zones);
+
+/**
+ * 获取碎片监控配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_frag_get_config(struct moeai_frag_config *config);
+
+/**
+ * 设置碎片监控配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_frag_set_config(const struct moeai_frag_config *config);
+
+/**
+ * 立即规整内存，可能睡眠
+ * @param nid 目标节点，负值表示所有节点
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_frag_compact(int nid);
+
+#endif /* _MOEAI_MEM_FRAG_H */
@@ -14,12 +14,39 @@
 #include <linux/time.h>
 #include <linux/timer.h>
 #include <linux/spinlock.h>
+#include <linux/limits.h>
+#include "../core/state.h"
 
 /* 内存回收策略枚举 */
 enum moeai_mem_reclaim_policy {
     MOEAI_MEM_RECLAIM_GENTLE = 0,    /* 温和回收 - 仅释放文件缓存 */
     MOEAI_MEM_RECLAIM_MODERATE = 1,  /* 中等回收 - 释放所有可回收页面 */
-    MOEAI_MEM_RECLAIM_AGGRESSIVE = 2 /* 积极回收 - 强制内存紧急回收，可能触发OOM */
+    MOEAI_MEM_RECLAIM_AGGRESSIVE = 2, /* 积极回收 - 强制内存紧急回收，可能触发OOM */
+    MOEAI_MEM_RECLAIM_MAX            /* 边界检查 */
+};
+
+/* 预测不会到达阈值时的时间值 */
+#define MOEAI_MEM_FORECAST_NEVER UINT_MAX
+
+/* 每节点统计支持的最大 NUMA 节点数 */
+#define MOEAI_MEM_MAX_NODES 16
+
+/* 内存活动速率 (按相邻两次采样的差值折算为每秒) */
+struct moeai_mem_rates {
+    unsigned int interval_ms;       /* 计算速率使用的采样间隔 (毫秒)，0表示尚无有效速率 */
+    unsigned long pgfault;          /* 缺页次数/秒 */
+    unsigned long pgmajfault;       /* 主缺页次数/秒 */
+    unsigned long pgscan_kswapd;    /* kswapd 扫描页数/秒 */
+    unsigned long pgscan_direct;    /* 直接回收扫描页数/秒 */
+    unsigned long pgsteal_kswapd;   /* kswapd 回收页数/秒 */
+    unsigned long pgsteal_direct;   /* 直接回收页数/秒 */
+    unsigned long allocstall;       /* 分配停顿 (进入直接回收) 次数/秒 */
+    unsigned long refault;          /* 工作集重新缺页 (匿名+文件) 页数/秒 */
+    unsigned long pswpin;           /* 换入页数/秒 */
+    unsigned long pswpout;          /* 换出页数/秒 */
+    unsigned long activate;         /* 重新缺页后直接激活的页数/秒 */
+    unsigned long kswapd_run;       /* kswapd 被唤醒执行回收的次数/秒 */
+    unsigned long kswapd_quick;     /* kswapd 刚睡眠就又跌破水位的次数/秒 */
 };
 
 /* 内存统计结构体 */
@@ -33,6 +60,44 @@ struct moeai_mem_stats {
     unsigned long swap_total;     /* 交换空间总量 (KB) */
     unsigned long swap_free;      /* 空闲交换空间 (KB) */
     unsigned int swap_usage_percent; /* 交换空间使用百分比 */
+    struct moeai_mem_rates rates; /* 最近一次检查得到的活动速率 */
+};
+
+/* NUMA 节点内存统计结构体 */
+struct moeai_mem_node_stats {
+    int nid;                        /* 节点编号 */
+    unsigned long total_ram;        /* 节点受管内存 (KB) */
+    unsigned long free_ram;         /* 节点空闲内存 (KB) */
+    unsigned long available_ram;    /* 节点可用内存估算 (KB) */
+    unsigned long file_ram;         /* 节点文件页 (KB) */
+    unsigned long anon_ram;         /* 节点匿名页 (KB) */
+    unsigned int mem_usage_percent; /* 节点内存使用百分比 */
+    enum moeai_system_state state;  /* 节点压力状态 */
+    u64 reclaim_runs;               /* 节点定向回收次数 */
+    long last_reclaimed_kb;         /* 最近一次节点回收释放的内存 (KB) */
+};
+
+/* 支持统计水位的最大区域数 */
+#define MOEAI_MEM_MAX_ZONES (MOEAI_MEM_MAX_NODES * MAX_NR_ZONES)
+
+/* 区域空闲页相对水位的位置 */
+enum moeai_mem_wmark_level {
+    MOEAI_MEM_WMARK_OK = 0,         /* 高于 high */
+    MOEAI_MEM_WMARK_HIGH,           /* 介于 low 与 high 之间，kswapd 可能仍在回收 */
+    MOEAI_MEM_WMARK_LOW,            /* 低于 low，kswapd 已被唤醒 */
+    MOEAI_MEM_WMARK_MIN,            /* 低于 min，分配进入直接回收 */
+};
+
+/* 区域水位统计 */
+struct moeai_mem_zone_wmark {
+    int nid;                        /* 节点编号 */
+    const char *zone_name;          /* 区域名称 */
+    unsigned long free_kb;          /* 空闲内存 (KB) */
+    unsigned long min_kb;           /* min 水位 (KB) */
+    unsigned long low_kb;           /* low 水位 (KB) */
+    unsigned long high_kb;          /* high 水位 (KB) */
+    enum moeai_mem_wmark_level level; /* 最近一次检查时的位置 */
+    u64 low_events;                 /* 跌破 low 水位的次数 */
 };
 
 /* 内存监控配置结构体 */
@@ -41,9 +106,82 @@ struct moeai_mem_monitor_config {
     unsigned int warn_threshold;    /* 警告阈值 (百分比) */
     unsigned int critical_threshold; /* 临界阈值 (百分比) */
     unsigned int emergency_threshold; /* 紧急阈值 (百分比) */
+    unsigned int warn_exit_threshold;      /* 警告退出阈值 (百分比) */
+    unsigned int critical_exit_threshold;  /* 临界退出阈值 (百分比) */
+    unsigned int emergency_exit_threshold; /* 紧急退出阈值 (百分比) */
+    unsigned int min_dwell_ms;      /* 降级前的最短驻留时间 (毫秒) */
+    unsigned int reclaim_cooldown_ms[MOEAI_MEM_RECLAIM_MAX]; /* 各回收策略冷却时间 (毫秒) */
+    unsigned int node_warn_threshold;     /* 节点警告阈值 (百分比) */
+    unsigned int node_critical_threshold; /* 节点临界阈值 (百分比)，达到后执行节点定向回收 */
+    unsigned int node_reclaim_kb;         /* 单次节点定向回收的目标量 (KB) */
+    unsigned long direct_scan_rate_threshold; /* 直接回收扫描速率阈值 (页/秒)，0表示禁用 */
+    unsigned long allocstall_rate_threshold;  /* 分配停顿速率阈值 (次/秒)，0表示禁用 */
+    unsigned long refault_rate_threshold;     /* 重新缺页速率阈值 (页/秒)，0表示禁用 */
+    unsigned int forecast_horizon_ms; /* 预计在此时间内越过阈值时提前回收 (毫秒)，0表示禁用 */
+    unsigned long thrash_swap_threshold;    /* 抖动判定：换入和换出速率均超过此值 (页/秒)，0表示禁用 */
+    unsigned long thrash_refault_threshold; /* 抖动判定：重新缺页速率阈值 (页/秒)，0表示禁用 */
+    unsigned int thrash_activate_percent;   /* 抖动判定：重新缺页中被激活的比例 (百分比) */
+    unsigned long min_reclaimable_kb; /* 选定策略预计可回收量低于此值时放弃回收并告警 (KB)，0表示不检查 */
+    bool wmark_trigger;             /* 区域跌破 low 水位时至少进入警告状态，跌破 min 时至少进入临界状态 */
+    unsigned int stall_warn_us;     /* 检查间隔内直接回收停顿的99分位达到此值时至少进入警告状态 (微秒)，0表示禁用 */
+    unsigned int stall_critical_us; /* 同上，至少进入临界状态 (微秒)，0表示禁用 */
     bool auto_reclaim;              /* 自动回收标志 */
 };
 
+/* 内存压力状态机信息 */
+struct moeai_mem_state_info {
+    enum moeai_system_state state;  /* 当前状态 */
+    unsigned int state_ms;          /* 已处于当前状态的时间 (毫秒) */
+    u64 transitions;                /* 状态切换总次数 */
+    u64 state_entries[MOEAI_STATE_MAX];         /* 进入各状态的次数 */
+    u64 reclaim_runs[MOEAI_MEM_RECLAIM_MAX];    /* 各策略实际执行次数 */
+    u64 reclaim_suppressed[MOEAI_MEM_RECLAIM_MAX]; /* 各策略因冷却被跳过的次数 */
+    unsigned int thrash_window_ms;  /* 抖动检测滑动窗口覆盖的时间 (毫秒) */
+    struct moeai_mem_rates thrash_rates; /* 滑动窗口内的平均速率 */
+    u64 thrash_suppressed;          /* 抖动期间放弃的回收次数 */
+    u64 reclaim_futile;             /* 因可回收内存不足而放弃的回收次数 */
+    u64 wmark_low_events;           /* 任一区域跌破 low 水位的次数 */
+};
+
+/* 可回收内存估算 (KB) */
+struct moeai_mem_reclaimable {
+    unsigned long inactive_file;    /* 非活跃文件页 */
+    unsigned long active_file;      /* 活跃文件页 */
+    unsigned long dirty;            /* 脏页与回写中的页，回写完成后才能回收 */
+    unsigned long slab_reclaimable; /* 可回收 slab 与其他可回收内核内存 */
+    unsigned long anon;             /* 匿名页，只能换出到交换空间 */
+    unsigned long swap_free;        /* 剩余交换空间 */
+    unsigned long estimate[MOEAI_MEM_RECLAIM_MAX]; /* 各策略最多可释放的内存 */
+};
+
+/* 内存压力预测信息 */
+struct moeai_mem_forecast_info {
+    unsigned int samples;           /* 历史采样数 */
+    unsigned int level_centi;       /* 平滑后的使用率 (0.01%) */
+    int trend_centi_per_min;        /* 使用率变化趋势 (0.01%/分钟) */
+    unsigned int time_to_ms[MOEAI_STATE_MAX]; /* 预计到达各等级进入阈值的时间 (毫秒) */
+    unsigned int mae_centi;         /* 单步预测的平均绝对误差 (0.01%) */
+    u64 predictions;                /* 预测到即将越过阈值的次数 */
+    u64 hits;                       /* 预测窗口内确实越过阈值的次数 */
+    u64 false_alarms;               /* 预测窗口内未越过阈值的次数 (含提前回收生效的情况) */
+    u64 misses;                     /* 越过阈值前没有预测到的次数 */
+    u64 triggers;                   /* 由预测触发的回收次数 */
+};
+
+/* 突发采样的间隔下限与时长上限 */
+#define MOEAI_MEM_BURST_MIN_INTERVAL_US 100
+#define MOEAI_MEM_BURST_MAX_DURATION_MS 600000
+
+/* 突发采样状态 */
+struct moeai_mem_burst_info {
+    bool active;                    /* 是否正在采样 */
+    bool truncated;                 /* 是否因缓冲区已满提前结束 */
+    unsigned int interval_us;       /* 采样间隔 (微秒) */
+    unsigned int duration_ms;       /* 计划采样时长 (毫秒) */
+    unsigned int samples;           /* 已记录的快照数 */
+    unsigned int capacity;          /* 缓冲区容量 */
+};
+
 /* 内存监控模块API */
 int moeai_mem_monitor_init(void);
 void moeai_mem_monitor_exit(void);
@@ -52,6 +190,21 @@ void moeai_mem_monitor_stop(void);
 int moeai_mem_monitor_get_stats(struct moeai_mem_stats *stats);
 int moeai_mem_monitor_get_config(struct moeai_mem_monitor_config *config);
 int moeai_mem_monitor_set_config(const struct moeai_mem_monitor_config *config);
+int moeai_mem_monitor_get_state(struct moeai_mem_state_info *info);
+int moeai_mem_monitor_get_forecast(struct moeai_mem_forecast_info *info);
+int moeai_mem_monitor_get_reclaimable(struct moeai_mem_reclaimable *r);
+const char *moeai_mem_state_name(enum moeai_system_state state);
+const char *moeai_mem_policy_name(enum moeai_mem_reclaim_policy policy);
+const char *moeai_mem_state_key(enum moeai_system_state state);
+const char *moeai_mem_policy_key(enum moeai_mem_reclaim_policy policy);
+int moeai_mem_monitor_get_node_stats(struct moeai_mem_node_stats *nodes, int max_nodes);
+int moeai_mem_monitor_get_wmarks(struct moeai_mem_zone_wmark *zones, int max_zones);
 long moeai_mem_reclaim(enum moeai_mem_reclaim_policy policy);
+long moeai_mem_reclaim_node(int nid, unsigned long target_kb);
+bool moeai_mem_node_reclaim_supported(void);
+int moeai_mem_burst_start(unsigned int interval_us, unsigned int duration_ms);
+void moeai_mem_burst_stop(void);
+int moeai_mem_burst_get_info(struct moeai_mem_burst_info *info);
+ssize_t moeai_mem_burst_read(char __user *buf, size_t count, loff_t *ppos);
 
 #endif /* _MOEAI_MEM_MONITOR_H */
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/mem_policy.h
+ * 描述: 基于实测效果的回收策略选择接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_MEM_POLICY_H
+#define _MOEAI_MEM_POLICY_H
+
+#include <linux/types.h>
+#include "mem_monitor.h"
+
+/* 决策上下文: 触发回收时所处的压力等级 (警告、严重、紧急) */
+#define MOEAI_MEM_POLICY_NR_CTX 3
+
+/* 压力状态对应的决策上下文，非压力状态返回-1 */
+static inline int moeai_mem_policy_ctx(enum moeai_system_state state)
+{
+    if (state < MOEAI_STATE_WARNING || state > MOEAI_STATE_EMERGENCY)
+        return -1;
+    return state - MOEAI_STATE_WARNING;
+}
+
+/* 单个上下文中某策略的效果统计 */
+struct moeai_mem_policy_arm {
+    u64 trials;                     /* 已结算的回收次数 */
+    u64 successes;                  /* 回收后使用率回到退出阈值以下的次数 */
+    unsigned int success_percent;   /* 成功率 */
+    unsigned int lower_percent;     /* 成功率置信下界 */
+    unsigned int upper_percent;     /* 成功率置信上界 */
+};
+
+/* 单个策略的开销统计，覆盖所有回收调用 (含手动回收) */
+struct moeai_mem_policy_stats {
+    u64 runs;                       /* 执行次数 */
+    u64 freed_kb;                   /* 可用内存增加量累计 (KB) */
+    u64 latency_us;                 /* 耗时累计 (微秒) */
+    u64 max_latency_us;             /* 最长一次耗时 (微秒) */
+    struct moeai_mem_policy_arm arms[MOEAI_MEM_POLICY_NR_CTX];
+};
+
+/* 策略选择配置 */
+struct moeai_mem_policy_config {
+    bool adaptive;                  /* 关闭时按压力等级固定映射策略 */
+    unsigned int target_percent;    /* 成功率下界达到此值才视为可靠 */
+    unsigned int explore_interval;  /* 每隔多少次决策尝试一次更便宜的策略，0表示不探索 */
+};
+
+/**
+ * 初始化策略选择
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_policy_init(void);
+
+/**
+ * 清理策略选择
+ */
+void moeai_mem_policy_exit(void);
+
+/**
+ * 为一次自动回收选择策略，可在定时器上下文调用
+ * 选择已被证明可靠的策略中开销最低的一个；没有可靠策略时按置信上界探索。
+ * 没有任何数据时返回默认策略。
+ * @param ctx 决策上下文
+ * @param default_policy 压力等级对应的默认策略
+ * @return 选中的策略
+ */
+int moeai_mem_policy_select(int ctx, int default_policy);
+
+/**
+ * 记录一次回收的开销
+ * @param policy 回收策略
+ * @param freed_kb 可用内存增加量 (KB)
+ * @param latency_ns 耗时 (纳秒，单调时钟)，也是选择策略时比较的开销
+ */
+void moeai_mem_policy_record_run(int policy, unsigned long freed_kb, u64 latency_ns);
+
+/**
+ * 记录一次自动回收的结果，可在定时器上下文调用
+ * @param ctx 决策上下文
+ * @param policy 回收策略
+ * @param success 使用率是否回到触发状态的退出阈值以下
+ */
+void moeai_mem_policy_record_outcome(int ctx, int policy, bool success);
+
+/**
+ * 获取各策略的统计
+ * @param stats 输出数组，长度为 MOEAI_MEM_RECLAIM_MAX
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_policy_get_stats(struct moeai_mem_policy_stats *stats);
+
+/**
+ * 获取策略选择配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_policy_get_config(struct moeai_mem_policy_config *config);
+
+/**
+ * 设置策略选择配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_mem_policy_set_config(const struct moeai_mem_policy_config *config);
+
+#endif /* _MOEAI_MEM_POLICY_H */
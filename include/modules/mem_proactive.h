@@ -0,0 +1,92 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/mem_proactive.h
+ * 描述: 针对选中 cgroup 的主动冷内存回收接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_MEM_PROACTIVE_H
+#define _MOEAI_MEM_PROACTIVE_H
+
+#include <linux/types.h>
+#include "memcg_monitor.h"
+
+/* 主动回收的 cgroup 数上限 */
+#define MOEAI_PROACTIVE_MAX_TARGETS 8
+
+/* 单个 cgroup 的主动回收统计 */
+struct moeai_proactive_stats {
+    char path[MOEAI_MEMCG_PATH_LEN]; /* 相对挂载点的路径 */
+    u64 rounds;                     /* 执行回收的轮数 */
+    u64 reclaimed_bytes;            /* 回收量累计 (以 memory.current 的下降计) */
+    u64 last_reclaimed_bytes;       /* 最近一轮的回收量 */
+    u64 refault_bytes;              /* 开始回收以来的重新缺页量累计 */
+    unsigned int cost_permille;     /* 最近一轮的代价: 随后重新缺页量占回收量的千分比 */
+    unsigned int step_kb;           /* 当前每轮请求的回收量 (KB) */
+    unsigned int skip;              /* 退避中，还要跳过的轮数 */
+    u64 backoffs;                   /* 因代价过高而退避的次数 */
+    u64 short_rounds;               /* 内核未能回收到请求量的轮数 */
+};
+
+/* 主动回收配置 */
+struct moeai_proactive_config {
+    bool enabled;                   /* 是否开启主动回收 */
+    unsigned int interval_ms;       /* 两轮之间的间隔 (毫秒) */
+    unsigned int step_kb;           /* 每个 cgroup 每轮最多请求的回收量 (KB) */
+    unsigned int max_cost_permille; /* 重新缺页量超过回收量的此千分比时退避 */
+};
+
+/**
+ * 初始化主动回收
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_proactive_init(void);
+
+/**
+ * 清理主动回收
+ */
+void moeai_proactive_exit(void);
+
+/**
+ * 开始周期性回收 (仅在配置开启时执行)，可能睡眠
+ */
+void moeai_proactive_start(void);
+
+/**
+ * 停止周期性回收，可能睡眠
+ */
+void moeai_proactive_stop(void);
+
+/**
+ * 选中或取消主动回收的 cgroup
+ * @param path 相对挂载点的路径
+ * @param enable 选中或取消
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_proactive_set_target(const char *path, bool enable);
+
+/**
+ * 获取各 cgroup 的主动回收统计
+ * @param out 输出数组
+ * @param max 数组容量
+ * @return 条目数，负值表示错误
+ */
+int moeai_proactive_get_stats(struct moeai_proactive_stats *out, int max);
+
+/**
+ * 获取主动回收配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_proactive_get_config(struct moeai_proactive_config *config);
+
+/**
+ * 设置主动回收配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_proactive_set_config(const struct moeai_proactive_config *config);
+
+#endif /* _MOEAI_MEM_PROACTIVE_H */
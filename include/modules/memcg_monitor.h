@@ -0,0 +1,161 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/memcg_monitor.h
+ * 描述: 内存 cgroup 压力监控接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_MEMCG_MONITOR_H
+#define _MOEAI_MEMCG_MONITOR_H
+
+#include <linux/types.h>
+#include "../core/state.h"
+
+/* cgroup v2 挂载点 */
+#define MOEAI_MEMCG_ROOT "/sys/fs/cgroup"
+
+/* cgroup 路径的最大长度 (相对挂载点) */
+#define MOEAI_MEMCG_PATH_LEN 256
+
+/* 最接近限制的 cgroup 列表的最大长度 */
+#define MOEAI_MEMCG_MAX_TOP 64
+
+/* 单独设置阈值的 cgroup 数上限 */
+#define MOEAI_MEMCG_MAX_OVERRIDES 32
+
+/* 单个 cgroup 的内存统计 */
+struct moeai_memcg_stats {
+    char path[MOEAI_MEMCG_PATH_LEN]; /* 相对挂载点的路径 */
+    u64 usage_bytes;                /* memory.current */
+    u64 limit_bytes;                /* memory.max，0表示无限制 */
+    unsigned int usage_permyriad;   /* 使用量占限制的比例 (0.01%)，无限制时为0 */
+    unsigned int psi_some_centi;    /* memory.pressure 中 some avg10 (0.01%) */
+    unsigned int psi_full_centi;    /* memory.pressure 中 full avg10 (0.01%) */
+    unsigned int warn_percent;      /* 生效的警告阈值 */
+    unsigned int critical_percent;  /* 生效的严重阈值 */
+    enum moeai_system_state state;  /* NORMAL、WARNING 或 CRITICAL */
+    u64 events;                     /* 状态变化次数 */
+};
+
+/* cgroup 监控配置 */
+struct moeai_memcg_config {
+    unsigned int scan_interval_ms;  /* 两批之间的间隔 (毫秒) */
+    unsigned int scan_batch;        /* 每批最多访问的 cgroup 数 */
+    unsigned int top_n;             /* 保留的最接近限制的 cgroup 数 */
+    unsigned int warn_percent;      /* 默认警告阈值 (占限制的百分比) */
+    unsigned int critical_percent;  /* 默认严重阈值 (占限制的百分比) */
+    unsigned int psi_threshold_centi; /* some avg10 不低于此值时视为警告 (0.01%)，0表示不使用 */
+    unsigned int max_cgroups;       /* 最多跟踪的 cgroup 数 */
+};
+
+/* cgroup 监控概况 */
+struct moeai_memcg_summary {
+    bool available;                 /* 是否检测到启用了内存控制器的 cgroup v2 */
+    unsigned int tracked;           /* 正在跟踪的 cgroup 数 */
+    unsigned int limited;           /* 其中设置了内存限制的数量 */
+    unsigned int warning;           /* 处于警告状态的数量 */
+    unsigned int critical;          /* 处于严重状态的数量 */
+    u64 passes;                     /* 已完成的完整遍历轮数 */
+    unsigned int last_pass_ms;      /* 最近一轮遍历耗时 (毫秒) */
+    u64 dropped;                    /* 超过跟踪上限而未记录的 cgroup 数 */
+    u64 events;                     /* 状态变化总次数 */
+};
+
+/**
+ * 初始化 cgroup 监控
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_init(void);
+
+/**
+ * 清理 cgroup 监控
+ */
+void moeai_memcg_exit(void);
+
+/**
+ * 开始周期性遍历，可能睡眠
+ */
+void moeai_memcg_start(void);
+
+/**
+ * 停止周期性遍历，可能睡眠
+ */
+void moeai_memcg_stop(void);
+
+/**
+ * 获取最接近内存限制的 cgroup，按使用比例降序排列
+ * @param out 输出数组
+ * @param max 数组容量
+ * @return 条目数，负值表示错误
+ */
+int moeai_memcg_get_top(struct moeai_memcg_stats *out, int max);
+
+/**
+ * 获取监控概况
+ * @param summary 输出概况
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_get_summary(struct moeai_memcg_summary *summary);
+
+/**
+ * 获取 cgroup 监控配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_get_config(struct moeai_memcg_config *config);
+
+/**
+ * 设置 cgroup 监控配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_set_config(const struct moeai_memcg_config *config);
+
+/**
+ * 为指定 cgroup 单独设置阈值，两者均为0时恢复默认阈值
+ * @param path 相对挂载点的路径，如 "/system.slice/docker.service"
+ * @param warn_percent 警告阈值
+ * @param critical_percent 严重阈值
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_set_threshold(const char *path, unsigned int warn_percent,
+                              unsigned int critical_percent);
+
+/**
+ * 通过 memory.reclaim 从指定 cgroup 回收内存，可能睡眠
+ * @param path 相对挂载点的路径，"/" 表示根 cgroup
+ * @param bytes 请求回收的字节数
+ * @return 成功返回0，未能回收到请求量时返回 -EAGAIN，其他失败返回错误码
+ */
+int moeai_memcg_reclaim(const char *path, u64 bytes);
+
+/**
+ * 同 moeai_memcg_reclaim，但只回收文件页 (6.11+)，较早的内核上按默认 swappiness 回收
+ * @param path 相对挂载点的路径，"/" 表示根 cgroup
+ * @param bytes 请求回收的字节数
+ * @return 成功返回0，未能回收到请求量时返回 -EAGAIN，其他失败返回错误码
+ */
+int moeai_memcg_reclaim_file(const char *path, u64 bytes);
+
+/**
+ * 读取 cgroup 目录下只含一个整数的文件，如 memory.current，可能睡眠
+ * @param path 相对挂载点的路径，"/" 表示根 cgroup
+ * @param name 文件名
+ * @param value 输出值
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_read_value(const char *path, const char *name, u64 *value);
+
+/**
+ * 读取 memory.stat 中的若干项，可能睡眠
+ * @param path 相对挂载点的路径，"/" 表示根 cgroup
+ * @param keys 项名数组
+ * @param values 输出值数组，不存在的项为0
+ * @param n 项数
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_memcg_read_stat(const char *path, const char * const *keys, u64 *values, int n);
+
+#endif /* _MOEAI_MEMCG_MONITOR_H */
@@ -0,0 +1,92 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/rss_tracker.h
+ * 描述: 进程RSS排行接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_RSS_TRACKER_H
+#define _MOEAI_RSS_TRACKER_H
+
+#include <linux/types.h>
+#include <linux/sched.h>
+
+/* 排行长度上限 */
+#define MOEAI_RSS_MAX_TOP 64
+
+/* 每批访问的PID数上限 */
+#define MOEAI_RSS_MAX_BATCH 1024
+
+/* 排行中的一个进程 */
+struct moeai_rss_entry {
+    pid_t pid;
+    char comm[TASK_COMM_LEN];
+    unsigned long rss_kb;           /* 常驻内存 (KB) */
+    long growth_kb_s;               /* 两次访问之间的RSS增长速度 (KB/秒)，负值表示收缩 */
+};
+
+/* 进程RSS排行配置 */
+struct moeai_rss_config {
+    unsigned int scan_interval_ms;  /* 两批之间的间隔 (毫秒) */
+    unsigned int scan_batch;        /* 每批最多访问的PID数 */
+    unsigned int top_k;             /* 排行长度 */
+    unsigned int max_tasks;         /* 最多跟踪的进程数 */
+};
+
+/* 最近一轮完整遍历得到的排行 */
+struct moeai_rss_top {
+    u64 passes;                     /* 已完成的完整遍历轮数 */
+    unsigned int last_pass_ms;      /* 最近一轮遍历耗时 (毫秒) */
+    unsigned int tracked;           /* 正在跟踪的进程数 */
+    u64 dropped;                    /* 超过跟踪上限而未记录的进程数 */
+    unsigned int nr_rss;
+    unsigned int nr_growth;
+    struct moeai_rss_entry by_rss[MOEAI_RSS_MAX_TOP];    /* 按RSS降序 */
+    struct moeai_rss_entry by_growth[MOEAI_RSS_MAX_TOP]; /* 按增长速度降序，只含增长中的进程 */
+};
+
+/**
+ * 初始化进程RSS排行
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_rss_init(void);
+
+/**
+ * 清理进程RSS排行
+ */
+void moeai_rss_exit(void);
+
+/**
+ * 开始周期性遍历，可能睡眠
+ */
+void moeai_rss_start(void);
+
+/**
+ * 停止周期性遍历，可能睡眠
+ */
+void moeai_rss_stop(void);
+
+/**
+ * 获取最近一轮遍历的排行，只复制排行本身，开销与进程总数无关
+ * @param top 输出排行
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_rss_get_top(struct moeai_rss_top *top);
+
+/**
+ * 获取进程RSS排行配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_rss_get_config(struct moeai_rss_config *config);
+
+/**
+ * 设置进程RSS排行配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_rss_set_config(const struct moeai_rss_config *config);
+
+#endif /* _MOEAI_RSS_TRACKER_H */
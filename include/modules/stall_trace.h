@@ -0,0 +1,73 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/stall_trace.h
+ * 描述: 直接回收停顿延迟统计接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_STALL_TRACE_H
+#define _MOEAI_STALL_TRACE_H
+
+#include <linux/types.h>
+
+/* 直方图桶数: 第 i 个桶统计 [2^(i-1), 2^i) 微秒的停顿，第0个桶统计不足1微秒的停顿 */
+#define MOEAI_STALL_BUCKETS 32
+
+/* 一段时间内的停顿分布 */
+struct moeai_stall_dist {
+    u64 count;                      /* 停顿次数 */
+    u64 total_us;                   /* 停顿时间累计 (微秒) */
+    u64 p50_us;                     /* 中位数 (所在桶的上界，微秒) */
+    u64 p99_us;                     /* 99分位 (所在桶的上界，微秒) */
+    u64 max_us;                     /* 最长一次停顿 (微秒) */
+};
+
+/* 停顿统计概况 */
+struct moeai_stall_summary {
+    bool attached;                  /* 是否已挂接到 vmscan 跟踪点 */
+    struct moeai_stall_dist total;  /* 挂接以来的分布 */
+    struct moeai_stall_dist window; /* 最近一个采样窗口内的分布 */
+    unsigned int window_ms;         /* 最近一个采样窗口的长度 (毫秒) */
+    u64 untracked;                  /* 在途表已满而未计时的停顿次数 */
+    u64 buckets[MOEAI_STALL_BUCKETS]; /* 挂接以来的直方图 */
+};
+
+/**
+ * 初始化停顿统计
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_stall_init(void);
+
+/**
+ * 清理停顿统计
+ */
+void moeai_stall_exit(void);
+
+/**
+ * 挂接到 mm_vmscan_direct_reclaim_begin/end 跟踪点，可能睡眠
+ * @return 成功返回0，跟踪点不存在时返回 -ENOENT
+ */
+int moeai_stall_start(void);
+
+/**
+ * 卸下跟踪点探针并等待正在执行的探针返回，可能睡眠
+ */
+void moeai_stall_stop(void);
+
+/**
+ * 结束当前采样窗口，计算窗口内的分布并开始下一个窗口
+ * 由内存监控检查任务调用，可在定时器上下文调用
+ * @param window 输出窗口内的分布，可为NULL
+ */
+void moeai_stall_sample(struct moeai_stall_dist *window);
+
+/**
+ * 获取停顿统计概况
+ * @param summary 输出概况
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_stall_get_summary(struct moeai_stall_summary *summary);
+
+#endif /* _MOEAI_STALL_TRACE_H */
@@ -0,0 +1,132 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/modules/wss_estimator.h
+ * 描述: 基于空闲页跟踪的工作集估算接口
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_WSS_ESTIMATOR_H
+#define _MOEAI_WSS_ESTIMATOR_H
+
+#include <linux/types.h>
+#include "memcg_monitor.h"
+
+/* 同时估算的 cgroup 数上限 */
+#define MOEAI_WSS_MAX_TARGETS 8
+
+/* 空闲时长分桶: 第 b 个桶统计连续 [2^b, 2^(b+1)) 轮扫描都空闲的页，最后一个桶不设上限 */
+#define MOEAI_WSS_AGE_BUCKETS 8
+
+/* 每批扫描的页数上限，批大小必须是64的倍数 (空闲位图按64页一个字读写) */
+#define MOEAI_WSS_MAX_BATCH 16384
+
+/* 单个 cgroup 最近一轮完整扫描的估算结果 (KB) */
+struct moeai_wss_target_stats {
+    char path[MOEAI_MEMCG_PATH_LEN]; /* 相对挂载点的路径，"/" 表示所有页面 */
+    unsigned long scanned_kb;       /* 属于该 cgroup 的可回收 LRU 页 */
+    unsigned long wss_kb;           /* 上一轮扫描以来被访问过的页，即工作集 */
+    unsigned long cold_kb;          /* 空闲时长不短于 cold_age_ms 的页 */
+    unsigned long anon_kb[MOEAI_WSS_AGE_BUCKETS]; /* 按空闲时长分桶的匿名页 */
+    unsigned long file_kb[MOEAI_WSS_AGE_BUCKETS]; /* 按空闲时长分桶的文件页 */
+};
+
+/* 工作集估算配置 */
+struct moeai_wss_config {
+    unsigned int scan_interval_ms;  /* 两批之间的间隔 (毫秒) */
+    unsigned int scan_batch;        /* 每批扫描的页数，决定扫描速率上限 */
+    unsigned int cold_age_ms;       /* 空闲超过此时长才视为冷内存，中等回收只回收冷内存 (毫秒) */
+};
+
+/* 工作集估算概况 */
+struct moeai_wss_summary {
+    bool available;                 /* 内核是否支持空闲页跟踪 */
+    unsigned int nr_targets;        /* 选中的 cgroup 数 */
+    u64 passes;                     /* 已完成的完整扫描轮数 */
+    unsigned int last_pass_ms;      /* 最近一轮扫描耗时，即分桶的时间单位 (毫秒) */
+    unsigned int cold_passes;       /* 冷内存对应的连续空闲轮数 */
+    unsigned long nr_pfns;          /* 扫描的物理页帧范围 */
+};
+
+/**
+ * 初始化工作集估算
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_wss_init(void);
+
+/**
+ * 清理工作集估算
+ */
+void moeai_wss_exit(void);
+
+/**
+ * 开始周期性扫描，没有选中的 cgroup 时不扫描，可能睡眠
+ */
+void moeai_wss_start(void);
+
+/**
+ * 停止周期性扫描，可能睡眠
+ */
+void moeai_wss_stop(void);
+
+/**
+ * 选中或取消选中一个 cgroup
+ * @param path 相对挂载点的路径，"/" 表示统计所有页面
+ * @param enable 选中或取消
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_wss_set_target(const char *path, bool enable);
+
+/**
+ * 获取各选中 cgroup 的估算结果
+ * @param out 输出数组
+ * @param max 数组容量
+ * @return 条目数，负值表示错误
+ */
+int moeai_wss_get_targets(struct moeai_wss_target_stats *out, int max);
+
+/**
+ * 获取工作集估算概况
+ * @param summary 输出概况
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_wss_get_summary(struct moeai_wss_summary *summary);
+
+/**
+ * 获取冷内存总量，可在定时器上下文调用
+ * @param cold_kb 输出冷内存 (KB)
+ * @return 已有有效估算时返回 true
+ */
+bool moeai_wss_cold_kb(unsigned long *cold_kb);
+
+/**
+ * 获取单个选中 cgroup 的冷内存，可能睡眠
+ * @param path 选中时使用的路径
+ * @param cold_kb 输出冷内存 (KB)
+ * @return 该 cgroup 已被选中且已有有效估算时返回 true
+ */
+bool moeai_wss_target_cold_kb(const char *path, unsigned long *cold_kb);
+
+/**
+ * 从各选中 cgroup 回收冷内存，每个 cgroup 的回收量不超过其冷内存，可能睡眠
+ * @return 各 cgroup 回收前后用量的实际减少量之和 (KB)，尚无有效估算时返回 -ENODATA，
+ *         所有 cgroup 都回收失败时返回错误码
+ */
+long moeai_wss_reclaim_cold(void);
+
+/**
+ * 获取工作集估算配置
+ * @param config 输出配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_wss_get_config(struct moeai_wss_config *config);
+
+/**
+ * 设置工作集估算配置
+ * @param config 新配置
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_wss_set_config(const struct moeai_wss_config *config);
+
+#endif /* _MOEAI_WSS_ESTIMATOR_H */
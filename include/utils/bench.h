@@ -0,0 +1,69 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: include/utils/bench.h
+ * 描述: 微基准测试运行器
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#ifndef _MOEAI_BENCH_H
+#define _MOEAI_BENCH_H
+
+#include <linux/types.h>
+
+/* 默认的预热和计时迭代次数 */
+#define MOEAI_BENCH_WARMUP     100
+#define MOEAI_BENCH_ITERATIONS 1000
+
+/* 一个基准测试用例 */
+struct moeai_bench_case {
+    const char *name;               /* 固定的英文名，便于跨构建和主机比较 */
+    void (*prepare)(void *arg);     /* 每次迭代前调用，不计时，可为NULL */
+    void (*run)(void *arg);         /* 被测操作，每次迭代单独计时 */
+    unsigned int warmup;            /* 预热迭代次数，0表示使用默认值 */
+    unsigned int iterations;        /* 计时迭代次数，0表示使用默认值 */
+};
+
+/* 基准测试结果，单位纳秒 */
+struct moeai_bench_result {
+    unsigned int iterations;
+    u64 min_ns;
+    u64 median_ns;
+    u64 p99_ns;
+    u64 max_ns;
+};
+
+/**
+ * 运行一个基准测试用例，可能睡眠
+ * 先预热，再逐次迭代用单调时钟计时，排序后取最小值、中位数和 p99
+ * @param bc 用例
+ * @param arg 传给 prepare 和 run 的参数
+ * @param res 输出结果
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_bench_run(const struct moeai_bench_case *bc, void *arg,
+                    struct moeai_bench_result *res);
+
+/* 并行基准测试的结果 */
+struct moeai_bench_parallel_result {
+    unsigned int nr_threads;        /* 实际参与的 CPU 数 */
+    u64 ops;                        /* 所有线程完成的操作总数 */
+    u64 duration_ns;                /* 实际运行时间 */
+    u64 ops_per_sec;                /* 总吞吐量 */
+};
+
+/**
+ * 在多个在线 CPU 上同时运行同一操作，每个 CPU 一个绑定的内核线程，可能睡眠
+ * 所有线程就绪后同时开始，运行到截止时间后统计完成的操作数
+ * @param run 被测操作，会在多个 CPU 上并发调用
+ * @param arg 传给 run 的参数
+ * @param nr_threads 线程数，不能超过在线 CPU 数
+ * @param duration_ms 运行时间 (毫秒)
+ * @param res 输出结果
+ * @return 成功返回0，失败返回错误码
+ */
+int moeai_bench_parallel(void (*run)(void *arg), void *arg, unsigned int nr_threads,
+                         unsigned int duration_ms, struct moeai_bench_parallel_result *res);
+
+#endif /* _MOEAI_BENCH_H */
@@ -11,6 +11,10 @@
 #define _MOEAI_LOGGER_H
 
 #include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/atomic.h>
+
+struct moeai_ring_buffer;
 
 /* 日志级别枚举 */
 enum moeai_log_level {
@@ -21,6 +25,8 @@ enum moeai_log_level {
     MOEAI_LOG_FATAL = 4   /* 致命错误 */
 };
 
+#define MOEAI_LOG_LEVELS (MOEAI_LOG_FATAL + 1)
+
 /* 日志条目结构体 */
 struct moeai_log_entry {
     u64 timestamp;                /* 纳秒级时间戳 */
@@ -37,13 +43,37 @@ struct moeai_logger_config {
     size_t buffer_size;             /* 缓冲区大小 */
 };
 
+/* 日志系统计数 */
+struct moeai_logger_stats {
+    u64 messages[MOEAI_LOG_LEVELS]; /* 各级别已记录的日志条数 */
+    u64 filtered;                   /* 低于最小级别被丢弃的条数 */
+    u64 contended;                  /* 写入缓冲区时需要等待锁的次数 */
+};
+
+/*
+ * 私有日志输出目标，供自检测量日志路径，不读写全局日志配置、缓冲区和计数
+ * 用 moeai_log_sink_init() 初始化
+ */
+struct moeai_log_sink {
+    enum moeai_log_level min_level; /* 最小日志级别 */
+    struct moeai_ring_buffer *buffer; /* 写入的缓冲区，NULL 表示不写入 */
+    spinlock_t lock;                /* 保护 buffer 的写入 */
+    atomic_long_t contended;        /* 写入缓冲区时需要等待锁的次数 */
+};
+
 /* 日志系统API */
 int moeai_logger_init(bool debug_mode);
 void moeai_logger_exit(void);
 void moeai_log(enum moeai_log_level level, const char *module, const char *fmt, ...);
+void moeai_log_sink_init(struct moeai_log_sink *sink, enum moeai_log_level min_level,
+                         struct moeai_ring_buffer *buffer);
+void moeai_log_to(struct moeai_log_sink *sink, enum moeai_log_level level,
+                  const char *module, const char *fmt, ...);
 int moeai_logger_get_recent_logs(struct moeai_log_entry *entries, size_t max_entries, size_t *count);
 int moeai_logger_set_config(const struct moeai_logger_config *config);
 int moeai_logger_get_config(struct moeai_logger_config *config);
+void moeai_logger_get_stats(struct moeai_logger_stats *stats);
+const char *moeai_log_level_key(enum moeai_log_level level);
 
 /* 便捷日志宏 */
 #define MOEAI_DEBUG(module, fmt, ...) \
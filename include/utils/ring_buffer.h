@@ -24,5 +24,6 @@ void moeai_ring_buffer_clear(struct moeai_ring_buffer *rb);
 size_t moeai_ring_buffer_count(struct moeai_ring_buffer *rb);
 bool moeai_ring_buffer_is_empty(struct moeai_ring_buffer *rb);
 bool moeai_ring_buffer_is_full(struct moeai_ring_buffer *rb);
+unsigned long moeai_ring_buffer_contended(struct moeai_ring_buffer *rb);
 
 #endif /* _MOEAI_RING_BUFFER_H */
\ No newline at end of file
@@ -15,10 +15,41 @@ enum StringID {
     LANG_CLI_HELP_AVAIL_CMDS,
     LANG_CLI_CMD_STATUS,
     LANG_CLI_CMD_RECLAIM,
+    LANG_CLI_CMD_RECLAIM_NODE,
+    LANG_CLI_CMD_COMPACT,
     LANG_CLI_CMD_SET_THRESHOLD,
     LANG_CLI_CMD_SET_INTERVAL,
     LANG_CLI_CMD_SET_AUTORECLAIM,
+    LANG_CLI_CMD_SET_HYSTERESIS,
+    LANG_CLI_CMD_SET_DWELL,
+    LANG_CLI_CMD_SET_COOLDOWN,
+    LANG_CLI_CMD_SET_NODE_THRESHOLD,
+    LANG_CLI_CMD_SET_RATE,
+    LANG_CLI_CMD_SET_HORIZON,
+    LANG_CLI_CMD_SET_MIN_RECLAIM,
+    LANG_CLI_CMD_SET_WMARK,
+    LANG_CLI_CMD_SET_STALL,
+    LANG_CLI_CMD_SET_THRASH,
+    LANG_CLI_CMD_SET_FRAG,
+    LANG_CLI_CMD_SET_POLICY,
+    LANG_CLI_CMD_SET_MEMCG,
+    LANG_CLI_CMD_SET_MEMCG_THRESHOLD,
+    LANG_CLI_CMD_SET_RSS,
+    LANG_CLI_CMD_SET_WSS,
+    LANG_CLI_CMD_SET_WSS_TARGET,
+    LANG_CLI_CMD_SET_PROACTIVE,
+    LANG_CLI_CMD_SET_PROACTIVE_PARAM,
+    LANG_CLI_CMD_SET_PROACTIVE_TARGET,
+    LANG_CLI_CMD_SAMPLE_BURST,
+    LANG_CLI_CMD_SAMPLE_STOP,
+    LANG_CLI_CMD_SAMPLE_DUMP,
+    LANG_CLI_CMD_TOP,
+    LANG_CLI_CMD_STATS,
+    LANG_CLI_CMD_LIVE,
+    LANG_CLI_CMD_BATCH,
+    LANG_CLI_CMD_EVENTS,
     LANG_CLI_CMD_SELFTEST,
+    LANG_CLI_CMD_SELFTEST_HISTORY,
     LANG_CLI_CMD_LOG,
     LANG_CLI_CMD_HELP,
 
@@ -29,8 +60,31 @@ enum StringID {
     LANG_CLI_ERR_OPEN_CONTROL,
     LANG_CLI_ERR_OPEN_SELFTEST,
     LANG_CLI_ERR_OPEN_LOG,
+    LANG_CLI_ERR_OPEN_BURST,
+    LANG_CLI_ERR_WRITE_FILE,
     LANG_CLI_ERR_TRIGGER_SELFTEST,
+    LANG_CLI_ERR_SELFTEST_TIMEOUT,
+    LANG_CLI_ERR_SELFTEST_FORMAT,
     LANG_CLI_ERR_INSUFFICIENT_ARGS,
+    LANG_CLI_ERR_INVALID_POLICY,
+    LANG_CLI_ERR_INVALID_RATE,
+    LANG_CLI_ERR_INVALID_STALL,
+    LANG_CLI_ERR_INVALID_THRASH,
+    LANG_CLI_ERR_INVALID_FRAG,
+    LANG_CLI_ERR_INVALID_POLICY_PARAM,
+    LANG_CLI_ERR_INVALID_MEMCG,
+    LANG_CLI_ERR_INVALID_RSS,
+    LANG_CLI_ERR_INVALID_WSS,
+    LANG_CLI_ERR_INVALID_SWITCH,
+    LANG_CLI_ERR_INVALID_PROACTIVE,
+    LANG_CLI_ERR_OPEN_TOP_MEM,
+    LANG_CLI_ERR_OPEN_STATS,
+    LANG_CLI_ERR_OPEN_EVENTS,
+    LANG_CLI_ERR_STATS_FORMAT,
+    LANG_CLI_ERR_MAP_LIVE,
+    LANG_CLI_ERR_LIVE_READ,
+    LANG_CLI_ERR_READ_FILE,
+    LANG_CLI_ERR_BATCH_TOO_LONG,
 
     // Operation messages
     LANG_CLI_MSG_MEM_RECLAIM,
@@ -38,7 +92,35 @@ enum StringID {
     LANG_CLI_MSG_SET_THRESHOLD,
     LANG_CLI_MSG_SET_INTERVAL,
     LANG_CLI_MSG_SET_AUTORECLAIM,
+    LANG_CLI_MSG_SET_HYSTERESIS,
+    LANG_CLI_MSG_SET_DWELL,
+    LANG_CLI_MSG_SET_COOLDOWN,
+    LANG_CLI_MSG_SET_NODE_THRESHOLD,
+    LANG_CLI_MSG_NODE_RECLAIM,
+    LANG_CLI_MSG_SET_RATE,
+    LANG_CLI_MSG_SET_HORIZON,
+    LANG_CLI_MSG_SET_MIN_RECLAIM,
+    LANG_CLI_MSG_SET_WMARK,
+    LANG_CLI_MSG_SET_STALL,
+    LANG_CLI_MSG_SET_THRASH,
+    LANG_CLI_MSG_SET_FRAG,
+    LANG_CLI_MSG_SET_POLICY,
+    LANG_CLI_MSG_SET_MEMCG,
+    LANG_CLI_MSG_SET_MEMCG_THRESHOLD,
+    LANG_CLI_MSG_SET_RSS,
+    LANG_CLI_MSG_SET_WSS,
+    LANG_CLI_MSG_SET_WSS_TARGET,
+    LANG_CLI_MSG_SET_PROACTIVE,
+    LANG_CLI_MSG_SET_PROACTIVE_PARAM,
+    LANG_CLI_MSG_SET_PROACTIVE_TARGET,
+    LANG_CLI_MSG_COMPACT,
+    LANG_CLI_MSG_COMPACT_COMPLETE,
+    LANG_CLI_MSG_SAMPLE_BURST,
+    LANG_CLI_MSG_SAMPLE_DUMP,
     LANG_CLI_MSG_SELFTEST_RESULT,
+    LANG_CLI_MSG_SELFTEST_NO_HISTORY,
+    LANG_CLI_MSG_NOTIFY_ADD,
+    LANG_CLI_MSG_NOTIFY_DEL,
 
     // Module initialization messages
     LANG_MODULE_INIT_START,
@@ -56,6 +138,7 @@ enum StringID {
     LANG_ERR_LOG_INIT_FAILED,
     LANG_ERR_MEM_INIT_FAILED, 
     LANG_ERR_PROC_INIT_FAILED,
+    LANG_ERR_LIVE_INIT_FAILED,
     LANG_ERR_MEM_START_FAILED,
 
     // Module descriptions
@@ -75,10 +158,28 @@ enum StringID {
     LANG_PROCFS_ERR_CREATE_CONTROL,
     LANG_PROCFS_ERR_CREATE_LOG,
     LANG_PROCFS_ERR_CREATE_SELFTEST,
+    LANG_PROCFS_ERR_CREATE_BURST,
+    LANG_PROCFS_ERR_CREATE_TOP_MEM,
+    LANG_PROCFS_ERR_CREATE_STATS_BIN,
+    LANG_PROCFS_ERR_CREATE_METRICS,
+    LANG_PROCFS_ERR_CREATE_EVENTS,
+    LANG_PROCFS_ERR_CREATE_LIVE,
+    LANG_PROCFS_ERR_CREATE_SELFTEST_BIN,
+    LANG_PROCFS_CTL_OK,
+    LANG_PROCFS_CTL_UNKNOWN,
+    LANG_PROCFS_CTL_USAGE,
+    LANG_PROCFS_CTL_FAILED,
+    LANG_PROCFS_CTL_SKIPPED,
+    LANG_PROCFS_CTL_APPLIED,
+    LANG_PROCFS_CTL_DUPLICATE,
     LANG_PROCFS_SELFTEST_HEADER,
     LANG_PROCFS_SELFTEST_SUMMARY,
     LANG_PROCFS_SELFTEST_NOT_RUN,
     LANG_PROCFS_SELFTEST_NO_BUFFER,
+    LANG_PROCFS_SELFTEST_RUN,
+    LANG_PROCFS_SELFTEST_IN_PROGRESS,
+    LANG_PROCFS_SELFTEST_QUEUED,
+    LANG_PROCFS_SELFTEST_COALESCED,
     LANG_PROCFS_SELFTEST_MEMORY_TEST,
     LANG_PROCFS_SELFTEST_RINGBUF_TEST,
     LANG_PROCFS_SELFTEST_LOGGER_TEST,
@@ -86,6 +187,9 @@ enum StringID {
     LANG_PROCFS_SELFTEST_NETGUARD_TEST,
     LANG_PROCFS_SELFTEST_FSLOGGER_TEST,
     LANG_PROCFS_SELFTEST_PERF_TEST,
+    LANG_PROCFS_SELFTEST_BENCH_UNIT,
+    LANG_PROCFS_SELFTEST_SCALE_TEST,
+    LANG_PROCFS_SELFTEST_SCALE_UNIT,
     LANG_PROCFS_SELFTEST_SYSINFO_TEST,
     LANG_PROCFS_SELFTEST_PASS,
     LANG_PROCFS_SELFTEST_WARN,
@@ -94,6 +198,8 @@ enum StringID {
     LANG_PROCFS_SELFTEST_RESULT,
     LANG_PROCFS_SELFTEST_TIME_MS,
     LANG_PROCFS_SELFTEST_TOTAL,
+    LANG_PROCFS_SELFTEST_COMPARE,
+    LANG_PROCFS_SELFTEST_DROPPED,
     LANG_PROCFS_STATUS_HEADER,
     LANG_PROCFS_MEMORY_STATUS,
     LANG_PROCFS_MEMORY_CONFIG,
@@ -135,10 +241,6 @@ enum StringID {
     LANG_PROCFS_MONITOR_CONFIG_OUTPUT,
     LANG_PROCFS_AUTO_RECLAIM_ON,
     LANG_PROCFS_AUTO_RECLAIM_OFF,
-    LANG_PROCFS_SELFTEST_MEM_WRITE_PERF,
-    LANG_PROCFS_SELFTEST_MEM_READ_PERF,
-    LANG_PROCFS_SELFTEST_WRITE_TIME,
-    LANG_PROCFS_SELFTEST_READ_TIME,
     LANG_PROCFS_TEST_NOT_IMPLEMENTED,
     LANG_PROCFS_MEMORY_TOTAL,
     LANG_PROCFS_MEMORY_FREE,
@@ -153,6 +255,93 @@ enum StringID {
     LANG_PROCFS_CRITICAL_THRESHOLD,
     LANG_PROCFS_EMERGENCY_THRESHOLD,
     LANG_PROCFS_AUTO_RECLAIM_STATUS,
+    LANG_PROCFS_WARN_EXIT_THRESHOLD,
+    LANG_PROCFS_CRITICAL_EXIT_THRESHOLD,
+    LANG_PROCFS_EMERGENCY_EXIT_THRESHOLD,
+    LANG_PROCFS_MIN_DWELL,
+    LANG_PROCFS_RECLAIM_COOLDOWN,
+    LANG_PROCFS_PRESSURE_STATE,
+    LANG_PROCFS_CURRENT_STATE,
+    LANG_PROCFS_STATE_DURATION,
+    LANG_PROCFS_STATE_TRANSITIONS,
+    LANG_PROCFS_STATE_ENTRIES,
+    LANG_PROCFS_RECLAIM_RUNS,
+    LANG_PROCFS_RECLAIM_SUPPRESSED,
+    LANG_PROCFS_NODE_WARN_THRESHOLD,
+    LANG_PROCFS_NODE_CRITICAL_THRESHOLD,
+    LANG_PROCFS_NODE_RECLAIM_TARGET,
+    LANG_PROCFS_NUMA_NODES,
+    LANG_PROCFS_NUMA_TABLE_HEADER,
+    LANG_PROCFS_NODE_RECLAIM_UNSUPPORTED,
+    LANG_PROCFS_RATE_THRESHOLDS,
+    LANG_PROCFS_MEMORY_RATES,
+    LANG_PROCFS_RATE_PGFAULT,
+    LANG_PROCFS_RATE_PGMAJFAULT,
+    LANG_PROCFS_RATE_PGSCAN_KSWAPD,
+    LANG_PROCFS_RATE_PGSCAN_DIRECT,
+    LANG_PROCFS_RATE_PGSTEAL_KSWAPD,
+    LANG_PROCFS_RATE_PGSTEAL_DIRECT,
+    LANG_PROCFS_RATE_ALLOCSTALL,
+    LANG_PROCFS_RATE_KSWAPD_RUN,
+    LANG_PROCFS_RATE_KSWAPD_QUICK,
+    LANG_PROCFS_RATE_REFAULT,
+    LANG_PROCFS_FORECAST_HORIZON,
+    LANG_PROCFS_FORECAST,
+    LANG_PROCFS_FORECAST_SAMPLES,
+    LANG_PROCFS_FORECAST_LEVEL,
+    LANG_PROCFS_FORECAST_TREND,
+    LANG_PROCFS_FORECAST_TIME_TO,
+    LANG_PROCFS_FORECAST_MAE,
+    LANG_PROCFS_FORECAST_ACCURACY,
+    LANG_PROCFS_FORECAST_TRIGGERS,
+    LANG_PROCFS_THRASH_THRESHOLDS,
+    LANG_PROCFS_THRASH_WINDOW,
+    LANG_PROCFS_THRASH_SUPPRESSED,
+    LANG_PROCFS_RECLAIM_FUTILE,
+    LANG_PROCFS_RECLAIMABLE,
+    LANG_PROCFS_RECLAIMABLE_ESTIMATE,
+    LANG_PROCFS_RECLAIMABLE_MIN,
+    LANG_PROCFS_WMARK_LOW_EVENTS,
+    LANG_PROCFS_WMARK,
+    LANG_PROCFS_WMARK_TRIGGER,
+    LANG_PROCFS_WMARK_TABLE_HEADER,
+    LANG_PROCFS_STALL,
+    LANG_PROCFS_STALL_DETACHED,
+    LANG_PROCFS_STALL_TOTAL,
+    LANG_PROCFS_STALL_WINDOW,
+    LANG_PROCFS_STALL_HISTOGRAM,
+    LANG_PROCFS_STALL_UNTRACKED,
+    LANG_PROCFS_STALL_THRESHOLDS,
+    LANG_PROCFS_FRAGMENTATION,
+    LANG_PROCFS_FRAG_CONFIG,
+    LANG_PROCFS_FRAG_HIGH_ORDER,
+    LANG_PROCFS_FRAG_INDEX,
+    LANG_PROCFS_FRAG_COMPACT_RUNS,
+    LANG_PROCFS_BURST,
+    LANG_PROCFS_BURST_RUNNING,
+    LANG_PROCFS_BURST_FINISHED,
+    LANG_PROCFS_POLICY,
+    LANG_PROCFS_POLICY_ADAPTIVE,
+    LANG_PROCFS_POLICY_TABLE_HEADER,
+    LANG_PROCFS_MEMCG,
+    LANG_PROCFS_MEMCG_UNAVAILABLE,
+    LANG_PROCFS_MEMCG_TRACKED,
+    LANG_PROCFS_MEMCG_PASSES,
+    LANG_PROCFS_MEMCG_TABLE_HEADER,
+    LANG_PROCFS_TOP_MEM,
+    LANG_PROCFS_TOP_MEM_PENDING,
+    LANG_PROCFS_TOP_MEM_BY_RSS,
+    LANG_PROCFS_TOP_MEM_BY_GROWTH,
+    LANG_PROCFS_TOP_MEM_TABLE_HEADER,
+    LANG_PROCFS_WSS,
+    LANG_PROCFS_WSS_UNAVAILABLE,
+    LANG_PROCFS_WSS_PASSES,
+    LANG_PROCFS_WSS_COLD_AGE,
+    LANG_PROCFS_WSS_BUCKETS,
+    LANG_PROCFS_WSS_TABLE_HEADER,
+    LANG_PROCFS_PROACTIVE,
+    LANG_PROCFS_PROACTIVE_STATUS,
+    LANG_PROCFS_PROACTIVE_TABLE_HEADER,
 
     // Core init messages
     LANG_CORE_ALREADY_INITIALIZED,
@@ -176,6 +365,8 @@ enum StringID {
     LANG_MEM_MODERATE_RECLAIM, 
     LANG_MEM_AGGRESSIVE_RECLAIM,
     LANG_MEM_COMPACT_NOT_SUPPORTED,
+    LANG_MEM_COMPACT_RESULT,
+    LANG_MEM_COMPACT_FAILED,
     LANG_MEM_INVALID_POLICY,
     LANG_MEM_ABOVE_EMERGENCY,
     LANG_MEM_ABOVE_CRITICAL,
@@ -185,6 +376,44 @@ enum StringID {
     LANG_MEM_STARTED,
     LANG_MEM_STOPPED,
     LANG_MEM_CONFIG_UPDATED,
+    LANG_MEM_STATE_CHANGED,
+    LANG_MEM_RECLAIM_COOLDOWN,
+    LANG_MEM_RECLAIM_ESTIMATE,
+    LANG_MEM_RECLAIM_ACTION_FAILED,
+    LANG_MEM_RECLAIM_FUTILE,
+    LANG_MEM_STATE_NORMAL,
+    LANG_MEM_STATE_WARNING,
+    LANG_MEM_STATE_CRITICAL,
+    LANG_MEM_STATE_EMERGENCY,
+    LANG_MEM_STATE_THRASHING,
+    LANG_MEM_POLICY_GENTLE,
+    LANG_MEM_POLICY_MODERATE,
+    LANG_MEM_POLICY_AGGRESSIVE,
+    LANG_MEM_NODE_RECLAIM,
+    LANG_MEM_NODE_RECLAIM_UNSUPPORTED,
+    LANG_MEM_NODE_RECLAIM_DISABLED,
+    LANG_MEM_NODE_STATE_CHANGED,
+    LANG_MEM_RATE_PRESSURE,
+    LANG_MEM_WMARK_LOW,
+    LANG_MEM_STALL_PRESSURE,
+    LANG_STALL_TP_MISSING,
+    LANG_STALL_ATTACHED,
+    LANG_STALL_ATTACH_FAILED,
+    LANG_MEM_FORECAST_CROSSING,
+    LANG_MEM_THRASHING_DETECTED,
+    LANG_MEM_THRASHING_CLEARED,
+    LANG_MEM_BURST_STARTED,
+    LANG_MEM_BURST_FINISHED,
+    LANG_MEM_BURST_STOPPED,
+    LANG_MEM_BURST_FAILED,
+    LANG_MEM_POLICY_SELECTED,
+    LANG_MEMCG_STATE_CHANGED,
+    LANG_MEMCG_UNAVAILABLE,
+    LANG_WSS_UNAVAILABLE,
+    LANG_WSS_SCAN_FAILED,
+    LANG_WSS_RECLAIM_COLD,
+    LANG_PROACTIVE_BACKOFF,
+    LANG_PROACTIVE_FAILED,
 
     // Logger strings
     LANG_LOG_BUFFER_CREATE_FAILED,
@@ -242,9 +471,50 @@ enum StringID {
     LANG_TEST_MEM_RECLAIM_PASSED,
     LANG_TEST_MEM_STOP_FAILED,
     LANG_TEST_MEM_STOP_PASSED,
+    LANG_TEST_MEM_STATE_FAILED,
+    LANG_TEST_MEM_STATE_PASSED,
+    LANG_TEST_MEM_NODE_FAILED,
+    LANG_TEST_MEM_NODE_PASSED,
     LANG_TEST_MEM_ALL_PASSED,
     LANG_TEST_MEM_CLEANUP,
     LANG_TEST_MEM_MODULE_DESC,
+    LANG_TEST_HOLT_START,
+    LANG_TEST_HOLT_CONST_FAILED,
+    LANG_TEST_HOLT_CONST_PASSED,
+    LANG_TEST_HOLT_RAMP_FAILED,
+    LANG_TEST_HOLT_RAMP_PASSED,
+    LANG_TEST_HOLT_TIME_TO_FAILED,
+    LANG_TEST_HOLT_TIME_TO_PASSED,
+    LANG_TEST_HOLT_FALLING_FAILED,
+    LANG_TEST_HOLT_FALLING_PASSED,
+    LANG_TEST_HOLT_RING_FAILED,
+    LANG_TEST_HOLT_RING_PASSED,
+    LANG_TEST_HOLT_ALL_PASSED,
+    LANG_TEST_HOLT_MODULE_DESC,
+    LANG_TEST_POLICY_START,
+    LANG_TEST_POLICY_INIT_FAILED,
+    LANG_TEST_POLICY_DEFAULT_FAILED,
+    LANG_TEST_POLICY_DEFAULT_PASSED,
+    LANG_TEST_POLICY_BOUNDS_FAILED,
+    LANG_TEST_POLICY_BOUNDS_PASSED,
+    LANG_TEST_POLICY_RELIABLE_FAILED,
+    LANG_TEST_POLICY_RELIABLE_PASSED,
+    LANG_TEST_POLICY_AVOID_FAILED,
+    LANG_TEST_POLICY_AVOID_PASSED,
+    LANG_TEST_POLICY_CONFIG_FAILED,
+    LANG_TEST_POLICY_CONFIG_PASSED,
+    LANG_TEST_POLICY_ALL_PASSED,
+    LANG_TEST_POLICY_MODULE_DESC,
+    LANG_TEST_CTL_START,
+    LANG_TEST_CTL_INIT_FAILED,
+    LANG_TEST_CTL_APPLY_FAILED,
+    LANG_TEST_CTL_APPLY_PASSED,
+    LANG_TEST_CTL_REJECT_FAILED,
+    LANG_TEST_CTL_REJECT_PASSED,
+    LANG_TEST_CTL_ROLLBACK_FAILED,
+    LANG_TEST_CTL_ROLLBACK_PASSED,
+    LANG_TEST_CTL_ALL_PASSED,
+    LANG_TEST_CTL_MODULE_DESC,
 
     // Ring buffer test strings
     LANG_TEST_RB_START,
@@ -267,6 +537,14 @@ enum StringID {
     LANG_TEST_RB_ALL_PASSED,
     LANG_TEST_RB_CLEANUP,
     LANG_TEST_RB_MODULE_DESC,
+    LANG_TEST_NODE_START,
+    LANG_TEST_NODE_ARGS_FAILED,
+    LANG_TEST_NODE_ARGS_PASSED,
+    LANG_TEST_NODE_UNSUPPORTED_FAILED,
+    LANG_TEST_NODE_UNSUPPORTED_PASSED,
+    LANG_TEST_NODE_FREE_FAILED,
+    LANG_TEST_NODE_FREE_PASSED,
+    LANG_TEST_NODE_ALL_PASSED,
     LANG_TEST_RB_MODULE_INFO,
     LANG_TEST_RB_COPYRIGHT,
 
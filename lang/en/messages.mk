@@ -27,6 +27,7 @@ MSG_QEMU_MINIMAL = Creating minimal test initramfs...
 MSG_MINIMAL_CREATED = Minimal initramfs created
 MSG_USE_TEST_CMD = Use following command to test
 MSG_CI_TEST_RUN = Running CI environment automated tests...
+MSG_QEMU_NUMA_TEST_RUN = Running QEMU test on a two-node NUMA topology...
 MSG_CLEAN_TEST_ENV = Cleaning test environment...
 MSG_TEST_ENV_CLEANED = Test environment cleaned
 MSG_START_QEMU = Starting QEMU...
@@ -109,6 +110,7 @@ MSG_HELP_QEMU_PACK = Pack initramfs as cpio.gz image
 MSG_HELP_QEMU_RUN = Run QEMU virtual machine
 MSG_HELP_QEMU_CHECK = Check QEMU environment compatibility
 MSG_HELP_QEMU_MINIMAL = Create minimal initramfs for testing
+MSG_HELP_QEMU_NUMA_TEST = Run QEMU test on a two-node NUMA topology
 
 # Other targets in help
 MSG_HELP_MKDIR = Create required build directories
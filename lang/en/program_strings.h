@@ -17,10 +17,41 @@ static const char* const en_strings[] = {
     [LANG_CLI_HELP_AVAIL_CMDS] = "Available commands:",
     [LANG_CLI_CMD_STATUS] = "  status            Display current system status",
     [LANG_CLI_CMD_RECLAIM] = "  reclaim           Trigger memory reclamation",
+    [LANG_CLI_CMD_RECLAIM_NODE] = "  reclaim node N    Trigger targeted reclaim on NUMA node N",
+    [LANG_CLI_CMD_COMPACT] = "  compact [N]       Compact memory on all nodes or on NUMA node N",
     [LANG_CLI_CMD_SET_THRESHOLD] = "  set threshold N   Set memory monitoring threshold to N%%",
     [LANG_CLI_CMD_SET_INTERVAL] = "  set interval N    Set check interval to N milliseconds",
     [LANG_CLI_CMD_SET_AUTORECLAIM] = "  set autoreclaim on|off  Toggle automatic reclamation",
+    [LANG_CLI_CMD_SET_HYSTERESIS] = "  set hysteresis N  Set exit thresholds N percent below entry thresholds",
+    [LANG_CLI_CMD_SET_DWELL] = "  set dwell N       Set minimum state dwell time to N milliseconds",
+    [LANG_CLI_CMD_SET_COOLDOWN] = "  set cooldown P N  Set cooldown of reclaim policy P (gentle|moderate|aggressive) to N ms",
+    [LANG_CLI_CMD_SET_NODE_THRESHOLD] = "  set nodethreshold W C  Set per-node warning and critical thresholds",
+    [LANG_CLI_CMD_SET_RATE] = "  set rate R N      Set rate trigger R (direct_scan|allocstall|refault) to N per second, 0 disables",
+    [LANG_CLI_CMD_SET_HORIZON] = "  set horizon N     Reclaim early when a threshold is forecast within N ms, 0 disables",
+    [LANG_CLI_CMD_SET_MIN_RECLAIM] = "  set minreclaim N  Skip automatic reclaim when the chosen policy can free less than N KB, 0 disables",
+    [LANG_CLI_CMD_SET_WMARK] = "  set wmark on|off  Raise pressure state when a zone falls below its low or min watermark",
+    [LANG_CLI_CMD_SET_STALL] = "  set stall L US    Raise pressure state when the p99 direct reclaim stall reaches US microseconds (L: warn|critical), 0 disables",
+    [LANG_CLI_CMD_SET_THRASH] = "  set thrash T N    Set thrash trigger T (swap|refault pages/s, activate percent) to N, 0 disables",
+    [LANG_CLI_CMD_SET_FRAG] = "  set frag P N      Set fragmentation parameter P (order|percent|index|cooldown|zones) to N",
+    [LANG_CLI_CMD_SET_POLICY] = "  set policy P N    Set reclaim policy selection P (adaptive 0|1, target percent, explore interval) to N",
+    [LANG_CLI_CMD_SET_MEMCG] = "  set memcg P N     Set cgroup monitor parameter P (interval ms|batch|top|warn|critical percent|psi centi-percent|max) to N",
+    [LANG_CLI_CMD_SET_MEMCG_THRESHOLD] = "  set memcgthreshold PATH W C  Set warning and critical thresholds of cgroup PATH, 0 0 restores defaults",
+    [LANG_CLI_CMD_SET_RSS] = "  set rss P N       Set process RSS ranking parameter P (interval ms|batch|top|max) to N",
+    [LANG_CLI_CMD_SET_WSS] = "  set wss P N       Set working set estimation parameter P (interval ms|batch pages|age ms) to N",
+    [LANG_CLI_CMD_SET_WSS_TARGET] = "  set wsstarget PATH on|off  Select a cgroup for working set estimation, / covers all memory",
+    [LANG_CLI_CMD_SET_PROACTIVE] = "  set proactive on|off  Periodically reclaim cold memory from selected cgroups before pressure builds",
+    [LANG_CLI_CMD_SET_PROACTIVE_PARAM] = "  set proactiveparam P N  Set proactive reclaim parameter P (interval ms|step KB|cost permille of refaults to reclaimed) to N",
+    [LANG_CLI_CMD_SET_PROACTIVE_TARGET] = "  set proactivetarget PATH on|off  Select a cgroup for proactive reclaim",
+    [LANG_CLI_CMD_SAMPLE_BURST] = "  sample burst I D  Record snapshots every I (e.g. 500us, 1ms) for D (e.g. 10s)",
+    [LANG_CLI_CMD_SAMPLE_STOP] = "  sample stop       Stop burst sampling early",
+    [LANG_CLI_CMD_SAMPLE_DUMP] = "  sample dump FILE  Save the last burst as a binary file",
+    [LANG_CLI_CMD_TOP] = "  top               Show processes using the most memory and growing fastest",
+    [LANG_CLI_CMD_STATS] = "  stats             Decode the binary stats file and print one field per line",
+    [LANG_CLI_CMD_LIVE] = "  live              Print a snapshot of the shared live stats page without a read syscall",
+    [LANG_CLI_CMD_BATCH] = "  batch FILE        Apply the commands in FILE (- for stdin) as one transaction",
+    [LANG_CLI_CMD_EVENTS] = "  events            Print memory state changes and reclaims as they happen",
     [LANG_CLI_CMD_SELFTEST] = "  selftest          Run module self-test and display results",
+    [LANG_CLI_CMD_SELFTEST_HISTORY] = "  selftest history  Compare the retained self-test runs without running the tests again",
     [LANG_CLI_CMD_LOG] = "  log              Display module logs",
     [LANG_CLI_CMD_HELP] = "  help              Show this help information",
 
@@ -31,8 +62,31 @@ static const char* const en_strings[] = {
     [LANG_CLI_ERR_OPEN_CONTROL] = "Cannot open control file",
     [LANG_CLI_ERR_OPEN_SELFTEST] = "Cannot open self-test results file",
     [LANG_CLI_ERR_OPEN_LOG] = "Cannot open log file",
+    [LANG_CLI_ERR_OPEN_BURST] = "Cannot open burst sample file",
+    [LANG_CLI_ERR_WRITE_FILE] = "Cannot write output file",
     [LANG_CLI_ERR_TRIGGER_SELFTEST] = "Cannot trigger self-test",
+    [LANG_CLI_ERR_SELFTEST_TIMEOUT] = "Timed out waiting for self-test results",
+    [LANG_CLI_ERR_SELFTEST_FORMAT] = "Unrecognized self-test history format",
     [LANG_CLI_ERR_INSUFFICIENT_ARGS] = "Error: Insufficient arguments\n",
+    [LANG_CLI_ERR_INVALID_POLICY] = "Error: Unknown reclaim policy: %s\n",
+    [LANG_CLI_ERR_INVALID_RATE] = "Error: Unknown rate trigger: %s\n",
+    [LANG_CLI_ERR_INVALID_STALL] = "Error: Unknown stall level: %s\n",
+    [LANG_CLI_ERR_INVALID_THRASH] = "Error: Unknown thrash trigger: %s\n",
+    [LANG_CLI_ERR_INVALID_FRAG] = "Error: Unknown fragmentation parameter: %s\n",
+    [LANG_CLI_ERR_INVALID_POLICY_PARAM] = "Error: Unknown policy selection parameter: %s\n",
+    [LANG_CLI_ERR_INVALID_MEMCG] = "Error: Unknown cgroup monitor parameter: %s\n",
+    [LANG_CLI_ERR_INVALID_RSS] = "Error: Unknown process RSS ranking parameter: %s\n",
+    [LANG_CLI_ERR_INVALID_WSS] = "Error: Unknown working set estimation parameter: %s\n",
+    [LANG_CLI_ERR_INVALID_SWITCH] = "Error: Expected on or off, got: %s\n",
+    [LANG_CLI_ERR_INVALID_PROACTIVE] = "Error: Unknown proactive reclaim parameter: %s\n",
+    [LANG_CLI_ERR_OPEN_TOP_MEM] = "Cannot open process memory ranking file",
+    [LANG_CLI_ERR_OPEN_STATS] = "Cannot open binary stats file",
+    [LANG_CLI_ERR_OPEN_EVENTS] = "Cannot read events file",
+    [LANG_CLI_ERR_STATS_FORMAT] = "Unsupported binary stats format",
+    [LANG_CLI_ERR_MAP_LIVE] = "Cannot map live stats page",
+    [LANG_CLI_ERR_LIVE_READ] = "Cannot read a consistent live stats snapshot",
+    [LANG_CLI_ERR_READ_FILE] = "Cannot read file",
+    [LANG_CLI_ERR_BATCH_TOO_LONG] = "Error: A batch may not exceed %d bytes\n",
 
     // Operation messages
     [LANG_CLI_MSG_MEM_RECLAIM] = "Performing memory reclamation...",
@@ -40,7 +94,35 @@ static const char* const en_strings[] = {
     [LANG_CLI_MSG_SET_THRESHOLD] = "Setting memory monitoring threshold to %d%%...",
     [LANG_CLI_MSG_SET_INTERVAL] = "Setting check interval to %d ms...",
     [LANG_CLI_MSG_SET_AUTORECLAIM] = "Setting auto-reclaim to %s...",
+    [LANG_CLI_MSG_SET_HYSTERESIS] = "Setting threshold hysteresis to %d%%...",
+    [LANG_CLI_MSG_SET_DWELL] = "Setting minimum state dwell time to %d ms...",
+    [LANG_CLI_MSG_SET_COOLDOWN] = "Setting %s reclaim cooldown to %d ms...",
+    [LANG_CLI_MSG_SET_NODE_THRESHOLD] = "Setting per-node thresholds to %d%%/%d%%...",
+    [LANG_CLI_MSG_NODE_RECLAIM] = "Performing targeted reclaim on node %d...",
+    [LANG_CLI_MSG_SET_RATE] = "Setting %s rate threshold to %d/s...",
+    [LANG_CLI_MSG_SET_HORIZON] = "Setting forecast horizon to %d ms...",
+    [LANG_CLI_MSG_SET_MIN_RECLAIM] = "Setting minimum reclaimable memory to %d KB...",
+    [LANG_CLI_MSG_SET_WMARK] = "Setting watermark trigger to %s...",
+    [LANG_CLI_MSG_SET_STALL] = "Setting %s stall threshold to %d us...",
+    [LANG_CLI_MSG_SET_THRASH] = "Setting %s thrash threshold to %d...",
+    [LANG_CLI_MSG_SET_FRAG] = "Setting fragmentation parameter %s to %d...",
+    [LANG_CLI_MSG_SET_POLICY] = "Setting policy selection parameter %s to %d...",
+    [LANG_CLI_MSG_SET_MEMCG] = "Setting cgroup monitor parameter %s to %d...",
+    [LANG_CLI_MSG_SET_MEMCG_THRESHOLD] = "Setting thresholds of cgroup %s to warning %d%%, critical %d%%...",
+    [LANG_CLI_MSG_SET_RSS] = "Setting process RSS ranking parameter %s to %d...",
+    [LANG_CLI_MSG_SET_WSS] = "Setting working set estimation parameter %s to %d...",
+    [LANG_CLI_MSG_SET_WSS_TARGET] = "Setting working set estimation for cgroup %s to %s...",
+    [LANG_CLI_MSG_SET_PROACTIVE] = "Setting proactive reclaim to %s...",
+    [LANG_CLI_MSG_SET_PROACTIVE_PARAM] = "Setting proactive reclaim parameter %s to %d...",
+    [LANG_CLI_MSG_SET_PROACTIVE_TARGET] = "Setting proactive reclaim for cgroup %s to %s...",
+    [LANG_CLI_MSG_COMPACT] = "Compacting memory...",
+    [LANG_CLI_MSG_COMPACT_COMPLETE] = "Memory compaction complete.",
+    [LANG_CLI_MSG_SAMPLE_BURST] = "Starting burst sampling: interval %s, duration %s...",
+    [LANG_CLI_MSG_SAMPLE_DUMP] = "Wrote %ld bytes to %s",
     [LANG_CLI_MSG_SELFTEST_RESULT] = "====== MoeAI-C Module Self-Test Results ======",
+    [LANG_CLI_MSG_SELFTEST_NO_HISTORY] = "No self-test runs recorded yet",
+    [LANG_CLI_MSG_NOTIFY_ADD] = "Eventfd %u registered for event mask 0x%x",
+    [LANG_CLI_MSG_NOTIFY_DEL] = "Eventfd %u unregistered",
 
     // Module initialization messages
     [LANG_MODULE_INIT_START] = "MoeAI-C: Starting module initialization",
@@ -58,6 +140,7 @@ static const char* const en_strings[] = {
     [LANG_ERR_LOG_INIT_FAILED] = "MoeAI-C: Failed to initialize logger (error %d)",
     [LANG_ERR_MEM_INIT_FAILED] = "MoeAI-C: Failed to initialize memory monitor (error %d)",
     [LANG_ERR_PROC_INIT_FAILED] = "MoeAI-C: Failed to initialize procfs interface (error %d)",
+    [LANG_ERR_LIVE_INIT_FAILED] = "MoeAI-C: Failed to initialize live stats page (error %d)",
     [LANG_ERR_MEM_START_FAILED] = "MoeAI-C: Failed to start memory monitoring (error %d)",
 
     // Module descriptions
@@ -77,17 +160,38 @@ static const char* const en_strings[] = {
     [LANG_PROCFS_ERR_CREATE_CONTROL] = "Failed to create control file", 
     [LANG_PROCFS_ERR_CREATE_LOG] = "Failed to create log file",
     [LANG_PROCFS_ERR_CREATE_SELFTEST] = "Failed to create selftest file",
+    [LANG_PROCFS_ERR_CREATE_BURST] = "Failed to create burst sample file",
+    [LANG_PROCFS_ERR_CREATE_TOP_MEM] = "Failed to create top_mem file",
+    [LANG_PROCFS_ERR_CREATE_STATS_BIN] = "Failed to create stats.bin file",
+    [LANG_PROCFS_ERR_CREATE_METRICS] = "Failed to create metrics file",
+    [LANG_PROCFS_ERR_CREATE_EVENTS] = "Failed to create events file",
+    [LANG_PROCFS_ERR_CREATE_LIVE] = "Failed to create live file",
+    [LANG_PROCFS_ERR_CREATE_SELFTEST_BIN] = "Failed to create selftest.bin file",
+    [LANG_PROCFS_CTL_OK] = "line %u: %s: ok",
+    [LANG_PROCFS_CTL_UNKNOWN] = "line %u: unknown command: %s",
+    [LANG_PROCFS_CTL_USAGE] = "line %u: %s: invalid arguments (%d), usage: %s",
+    [LANG_PROCFS_CTL_FAILED] = "line %u: %s: failed (%d)",
+    [LANG_PROCFS_CTL_SKIPPED] = "line %u: %s: not applied, the batch was rejected",
+    [LANG_PROCFS_CTL_APPLIED] = "Applied %u configuration commands in one transaction",
+    [LANG_PROCFS_CTL_DUPLICATE] = "Duplicate control command: %s",
     [LANG_PROCFS_SELFTEST_HEADER] = "MoeAI-C Module Self-Test Results",
     [LANG_PROCFS_SELFTEST_SUMMARY] = "Self-Test Summary:",
     [LANG_PROCFS_SELFTEST_NOT_RUN] = "Self-test not run yet. Use 'moectl selftest' command to trigger self-test.",
     [LANG_PROCFS_SELFTEST_NO_BUFFER] = "Error: Self-test buffer not allocated",
+    [LANG_PROCFS_SELFTEST_RUN] = "Run",
+    [LANG_PROCFS_SELFTEST_IN_PROGRESS] = "Self-test run %llu in progress, showing previous results",
+    [LANG_PROCFS_SELFTEST_QUEUED] = "Self-test run %llu queued",
+    [LANG_PROCFS_SELFTEST_COALESCED] = "Self-test run %llu already in progress, request coalesced",
     [LANG_PROCFS_SELFTEST_MEMORY_TEST] = "- Testing memory monitoring...",
     [LANG_PROCFS_SELFTEST_RINGBUF_TEST] = "- Testing ring buffer functionality...",
     [LANG_PROCFS_SELFTEST_LOGGER_TEST] = "- Testing logger system...",
     [LANG_PROCFS_SELFTEST_PROCFS_TEST] = "- Testing procfs interface...",
     [LANG_PROCFS_SELFTEST_NETGUARD_TEST] = "- Testing network guard module...",
     [LANG_PROCFS_SELFTEST_FSLOGGER_TEST] = "- Testing filesystem logger...",
-    [LANG_PROCFS_SELFTEST_PERF_TEST] = "- Running basic performance test...",
+    [LANG_PROCFS_SELFTEST_PERF_TEST] = "- Running microbenchmarks...",
+    [LANG_PROCFS_SELFTEST_BENCH_UNIT] = "Times in ns per call (monotonic clock, after warm-up)",
+    [LANG_PROCFS_SELFTEST_SCALE_TEST] = "- Running per-CPU scalability test...",
+    [LANG_PROCFS_SELFTEST_SCALE_UNIT] = "One bound kthread per CPU; xN = throughput relative to 1 CPU, contended = lock acquisitions that had to wait",
     [LANG_PROCFS_SELFTEST_SYSINFO_TEST] = "- Collecting system environment info...",
     [LANG_PROCFS_SELFTEST_PASS] = "  [PASS] ",
     [LANG_PROCFS_SELFTEST_WARN] = "  [WARN] ",
@@ -96,6 +200,8 @@ static const char* const en_strings[] = {
     [LANG_PROCFS_SELFTEST_RESULT] = "Self-test results:",
     [LANG_PROCFS_SELFTEST_TIME_MS] = "Execution time: %llu.%03llu ms",
     [LANG_PROCFS_SELFTEST_TOTAL] = "Total tests: %u",
+    [LANG_PROCFS_SELFTEST_COMPARE] = "Compared with run %llu",
+    [LANG_PROCFS_SELFTEST_DROPPED] = "Records dropped (out of memory): %u",
     [LANG_PROCFS_STATUS_HEADER] = "MoeAI-C Module Status",
     [LANG_PROCFS_MEMORY_STATUS] = "Memory Status:",
     [LANG_PROCFS_MEMORY_CONFIG] = "Monitoring Configuration:",
@@ -137,10 +243,6 @@ static const char* const en_strings[] = {
     [LANG_PROCFS_MONITOR_CONFIG_OUTPUT] = "Monitoring Configuration:",
     [LANG_PROCFS_AUTO_RECLAIM_ON] = "on",
     [LANG_PROCFS_AUTO_RECLAIM_OFF] = "off",
-    [LANG_PROCFS_SELFTEST_MEM_WRITE_PERF] = "Testing memory write performance (1MB)...",
-    [LANG_PROCFS_SELFTEST_MEM_READ_PERF] = "Testing memory read performance (1MB)...",
-    [LANG_PROCFS_SELFTEST_WRITE_TIME] = "1MB write time: %llu.%03llu ms",
-    [LANG_PROCFS_SELFTEST_READ_TIME] = "1MB read time: %llu.%03llu ms",
     [LANG_PROCFS_TEST_NOT_IMPLEMENTED] = "Test not implemented yet",
     [LANG_PROCFS_MEMORY_TOTAL] = "Total physical memory",
     [LANG_PROCFS_MEMORY_FREE] = "Free memory",
@@ -155,6 +257,93 @@ static const char* const en_strings[] = {
     [LANG_PROCFS_CRITICAL_THRESHOLD] = "Critical threshold",
     [LANG_PROCFS_EMERGENCY_THRESHOLD] = "Emergency threshold",
     [LANG_PROCFS_AUTO_RECLAIM_STATUS] = "Auto reclaim",
+    [LANG_PROCFS_WARN_EXIT_THRESHOLD] = "Warning exit threshold",
+    [LANG_PROCFS_CRITICAL_EXIT_THRESHOLD] = "Critical exit threshold",
+    [LANG_PROCFS_EMERGENCY_EXIT_THRESHOLD] = "Emergency exit threshold",
+    [LANG_PROCFS_MIN_DWELL] = "Minimum state dwell time",
+    [LANG_PROCFS_RECLAIM_COOLDOWN] = "Reclaim cooldown",
+    [LANG_PROCFS_PRESSURE_STATE] = "Memory Pressure State:",
+    [LANG_PROCFS_CURRENT_STATE] = "Current state",
+    [LANG_PROCFS_STATE_DURATION] = "Time in state",
+    [LANG_PROCFS_STATE_TRANSITIONS] = "State transitions",
+    [LANG_PROCFS_STATE_ENTRIES] = "State entries",
+    [LANG_PROCFS_RECLAIM_RUNS] = "Reclaim runs",
+    [LANG_PROCFS_RECLAIM_SUPPRESSED] = "Reclaims skipped (cooldown)",
+    [LANG_PROCFS_NODE_WARN_THRESHOLD] = "Node warning threshold",
+    [LANG_PROCFS_NODE_CRITICAL_THRESHOLD] = "Node critical threshold",
+    [LANG_PROCFS_NODE_RECLAIM_TARGET] = "Node reclaim target",
+    [LANG_PROCFS_NUMA_NODES] = "NUMA Nodes:",
+    [LANG_PROCFS_NUMA_TABLE_HEADER] = "  Node     Total KB      Free KB     Avail KB      File KB      Anon KB  Usage  State      Reclaims  Last freed KB",
+    [LANG_PROCFS_NODE_RECLAIM_UNSUPPORTED] = "  Node-targeted reclaim: unsupported by this kernel",
+    [LANG_PROCFS_RATE_THRESHOLDS] = "Rate triggers",
+    [LANG_PROCFS_MEMORY_RATES] = "Memory Activity Rates",
+    [LANG_PROCFS_RATE_PGFAULT] = "Page faults",
+    [LANG_PROCFS_RATE_PGMAJFAULT] = "Major faults",
+    [LANG_PROCFS_RATE_PGSCAN_KSWAPD] = "Pages scanned (kswapd)",
+    [LANG_PROCFS_RATE_PGSCAN_DIRECT] = "Pages scanned (direct)",
+    [LANG_PROCFS_RATE_PGSTEAL_KSWAPD] = "Pages reclaimed (kswapd)",
+    [LANG_PROCFS_RATE_PGSTEAL_DIRECT] = "Pages reclaimed (direct)",
+    [LANG_PROCFS_RATE_ALLOCSTALL] = "Allocation stalls",
+    [LANG_PROCFS_RATE_KSWAPD_RUN] = "kswapd wakeups",
+    [LANG_PROCFS_RATE_KSWAPD_QUICK] = "kswapd re-woken quickly",
+    [LANG_PROCFS_RATE_REFAULT] = "Workingset refaults",
+    [LANG_PROCFS_FORECAST_HORIZON] = "Forecast horizon",
+    [LANG_PROCFS_FORECAST] = "Pressure Forecast:",
+    [LANG_PROCFS_FORECAST_SAMPLES] = "Samples",
+    [LANG_PROCFS_FORECAST_LEVEL] = "Smoothed usage",
+    [LANG_PROCFS_FORECAST_TREND] = "Usage trend",
+    [LANG_PROCFS_FORECAST_TIME_TO] = "Time to threshold",
+    [LANG_PROCFS_FORECAST_MAE] = "Mean absolute error",
+    [LANG_PROCFS_FORECAST_ACCURACY] = "Crossing predictions",
+    [LANG_PROCFS_FORECAST_TRIGGERS] = "Forecast-triggered reclaims",
+    [LANG_PROCFS_THRASH_THRESHOLDS] = "Thrash triggers",
+    [LANG_PROCFS_THRASH_WINDOW] = "Thrash window",
+    [LANG_PROCFS_THRASH_SUPPRESSED] = "Reclaims suppressed while thrashing",
+    [LANG_PROCFS_RECLAIM_FUTILE] = "Reclaims skipped as futile",
+    [LANG_PROCFS_RECLAIMABLE] = "Reclaimable Memory:",
+    [LANG_PROCFS_RECLAIMABLE_ESTIMATE] = "Estimate by policy",
+    [LANG_PROCFS_RECLAIMABLE_MIN] = "Minimum worth reclaiming",
+    [LANG_PROCFS_WMARK_LOW_EVENTS] = "Zones fallen below low watermark",
+    [LANG_PROCFS_WMARK] = "Zone Watermarks:",
+    [LANG_PROCFS_WMARK_TRIGGER] = "Watermark trigger",
+    [LANG_PROCFS_WMARK_TABLE_HEADER] = "  Node Zone          Free KB     Min KB     Low KB    High KB  Level  Low hits",
+    [LANG_PROCFS_STALL] = "Direct Reclaim Stalls:",
+    [LANG_PROCFS_STALL_DETACHED] = "Not attached to vmscan tracepoints",
+    [LANG_PROCFS_STALL_TOTAL] = "Since attach",
+    [LANG_PROCFS_STALL_WINDOW] = "Last check interval",
+    [LANG_PROCFS_STALL_HISTOGRAM] = "Histogram",
+    [LANG_PROCFS_STALL_UNTRACKED] = "Untimed stalls",
+    [LANG_PROCFS_STALL_THRESHOLDS] = "p99 triggers",
+    [LANG_PROCFS_FRAGMENTATION] = "Fragmentation (free blocks per order):",
+    [LANG_PROCFS_FRAG_CONFIG] = "Compaction triggers",
+    [LANG_PROCFS_FRAG_HIGH_ORDER] = "High-order free",
+    [LANG_PROCFS_FRAG_INDEX] = "Fragmentation index",
+    [LANG_PROCFS_FRAG_COMPACT_RUNS] = "Compactions",
+    [LANG_PROCFS_BURST] = "Burst sampling:",
+    [LANG_PROCFS_BURST_RUNNING] = "running",
+    [LANG_PROCFS_BURST_FINISHED] = "finished",
+    [LANG_PROCFS_POLICY] = "Reclaim Policy Effectiveness:",
+    [LANG_PROCFS_POLICY_ADAPTIVE] = "Adaptive selection",
+    [LANG_PROCFS_POLICY_TABLE_HEADER] = "  Policy       Runs Avg freed KB   Avg lat us   Max lat us  Success by level: ok/settled[confidence]",
+    [LANG_PROCFS_MEMCG] = "Memory cgroups:",
+    [LANG_PROCFS_MEMCG_UNAVAILABLE] = "cgroup v2 memory controller not available",
+    [LANG_PROCFS_MEMCG_TRACKED] = "Tracked",
+    [LANG_PROCFS_MEMCG_PASSES] = "Scan passes",
+    [LANG_PROCFS_MEMCG_TABLE_HEADER] = "  Usage MB   Limit MB   Usage%   PSI some  State      Warn/Crit  Path",
+    [LANG_PROCFS_TOP_MEM] = "Process memory ranking",
+    [LANG_PROCFS_TOP_MEM_PENDING] = "First scan of all processes has not finished yet",
+    [LANG_PROCFS_TOP_MEM_BY_RSS] = "By resident memory",
+    [LANG_PROCFS_TOP_MEM_BY_GROWTH] = "By RSS growth",
+    [LANG_PROCFS_TOP_MEM_TABLE_HEADER] = "       PID  Command                RSS KB  Growth KB/s",
+    [LANG_PROCFS_WSS] = "Working Set Estimate:",
+    [LANG_PROCFS_WSS_UNAVAILABLE] = "Idle page tracking not available (CONFIG_IDLE_PAGE_TRACKING)",
+    [LANG_PROCFS_WSS_PASSES] = "Full scans",
+    [LANG_PROCFS_WSS_COLD_AGE] = "Cold after (scans)",
+    [LANG_PROCFS_WSS_BUCKETS] = "Idle age buckets",
+    [LANG_PROCFS_WSS_TABLE_HEADER] = "  Scanned MB    WSS MB   Cold MB  Idle MB by age (anon/file)  Path",
+    [LANG_PROCFS_PROACTIVE] = "Proactive Reclaim:",
+    [LANG_PROCFS_PROACTIVE_STATUS] = "Proactive reclaim",
+    [LANG_PROCFS_PROACTIVE_TABLE_HEADER] = "   Rounds  Reclaimed MB    Last KB  Refault MB    Cost  Step KB Skip Backoffs  Short  Path",
     [LANG_CORE_ALREADY_INITIALIZED] = "MoeAI-C: Core system already initialized",
     [LANG_CORE_INIT_START] = "MoeAI-C: Starting core system initialization, debug mode: %s",
     [LANG_CORE_INIT_COMPLETE] = "MoeAI-C: Core system initialization complete",
@@ -174,6 +363,8 @@ static const char* const en_strings[] = {
     [LANG_MEM_MODERATE_RECLAIM] = "Performing moderate memory reclamation",
     [LANG_MEM_AGGRESSIVE_RECLAIM] = "Performing aggressive memory reclamation",
     [LANG_MEM_COMPACT_NOT_SUPPORTED] = "Memory compaction not supported in current kernel",
+    [LANG_MEM_COMPACT_RESULT] = "Compaction on node %d zone %s: free blocks of order >= %u %lu -> %lu",
+    [LANG_MEM_COMPACT_FAILED] = "Compaction on node %d failed: %d",
     [LANG_MEM_INVALID_POLICY] = "Invalid reclamation policy: %d",
     [LANG_MEM_ABOVE_EMERGENCY] = "Memory usage(%u%%) above emergency threshold(%u%%)",
     [LANG_MEM_ABOVE_CRITICAL] = "Memory usage(%u%%) above critical threshold(%u%%)",
@@ -183,6 +374,44 @@ static const char* const en_strings[] = {
     [LANG_MEM_STARTED] = "Memory monitoring started, check interval: %u ms",
     [LANG_MEM_STOPPED] = "Memory monitoring stopped",
     [LANG_MEM_CONFIG_UPDATED] = "Memory monitor configuration updated",
+    [LANG_MEM_STATE_CHANGED] = "Memory state changed: %s -> %s (usage %u%%)",
+    [LANG_MEM_RECLAIM_COOLDOWN] = "Reclaim policy %d is cooling down, skipped",
+    [LANG_MEM_RECLAIM_ESTIMATE] = "Starting %s reclaim, up to %lu KB reclaimable",
+    [LANG_MEM_RECLAIM_ACTION_FAILED] = "%s reclaim action failed: %d",
+    [LANG_MEM_RECLAIM_FUTILE] = "Skipping %s reclaim: only %lu KB reclaimable (file %lu KB, dirty %lu KB, slab %lu KB, anon %lu KB, swap free %lu KB); memory must be freed from userspace",
+    [LANG_MEM_STATE_NORMAL] = "normal",
+    [LANG_MEM_STATE_WARNING] = "warning",
+    [LANG_MEM_STATE_CRITICAL] = "critical",
+    [LANG_MEM_STATE_EMERGENCY] = "emergency",
+    [LANG_MEM_STATE_THRASHING] = "thrashing",
+    [LANG_MEM_POLICY_GENTLE] = "gentle",
+    [LANG_MEM_POLICY_MODERATE] = "moderate",
+    [LANG_MEM_POLICY_AGGRESSIVE] = "aggressive",
+    [LANG_MEM_NODE_RECLAIM] = "Performing targeted reclaim on node %d, target %lu KB",
+    [LANG_MEM_NODE_RECLAIM_UNSUPPORTED] = "Targeted reclaim on node %d is not supported by this kernel (needs /sys/devices/system/node/nodeN/reclaim)",
+    [LANG_MEM_NODE_RECLAIM_DISABLED] = "Kernel has no per-node reclaim interface, automatic node-targeted reclaim disabled",
+    [LANG_MEM_NODE_STATE_CHANGED] = "Node %d memory state changed: %s -> %s (usage %u%%)",
+    [LANG_MEM_RATE_PRESSURE] = "Reclaim activity indicates memory pressure: direct scan %lu/s, allocation stalls %lu/s, refaults %lu/s",
+    [LANG_MEM_WMARK_LOW] = "Node %d zone %s fell below its low watermark: free %lu KB, low %lu KB, min %lu KB",
+    [LANG_MEM_STALL_PRESSURE] = "Direct reclaim stalls indicate memory pressure: p99 %llu us, max %llu us over %llu stalls",
+    [LANG_STALL_TP_MISSING] = "vmscan direct reclaim tracepoints not found, stall latency will not be recorded",
+    [LANG_STALL_ATTACHED] = "Attached to vmscan direct reclaim tracepoints",
+    [LANG_STALL_ATTACH_FAILED] = "Failed to attach to vmscan tracepoints: %d",
+    [LANG_MEM_FORECAST_CROSSING] = "Forecast: memory usage projected to reach %s threshold in %u s, reclaiming early",
+    [LANG_MEM_THRASHING_DETECTED] = "Memory thrashing detected (swap in %lu/s, swap out %lu/s, refaults %lu/s, activations %lu/s), automatic reclaim stopped",
+    [LANG_MEM_THRASHING_CLEARED] = "Memory thrashing cleared, returning to %s state",
+    [LANG_MEM_BURST_STARTED] = "Burst sampling started, interval %u us, duration %u ms",
+    [LANG_MEM_BURST_FINISHED] = "Burst sampling finished, %u snapshots recorded",
+    [LANG_MEM_BURST_STOPPED] = "Burst sampling stopped, %u snapshots recorded",
+    [LANG_MEM_BURST_FAILED] = "Failed to start burst sampling:",
+    [LANG_MEM_POLICY_SELECTED] = "Reclaim policy %s chosen instead of %s (success %u%% over %llu settled runs)",
+    [LANG_MEMCG_STATE_CHANGED] = "Memory cgroup %s: %s -> %s (usage %u.%02u%% of limit, pressure %u.%02u%%)",
+    [LANG_MEMCG_UNAVAILABLE] = "cgroup v2 memory controller not found under %s, cgroup monitoring disabled",
+    [LANG_WSS_UNAVAILABLE] = "%s not available, working set estimation disabled",
+    [LANG_WSS_SCAN_FAILED] = "Idle page scan failed: %d, working set estimation disabled",
+    [LANG_WSS_RECLAIM_COLD] = "Reclaiming cold memory of cgroup %s: %lu KB (%d)",
+    [LANG_PROACTIVE_BACKOFF] = "Proactive reclaim of cgroup %s backs off: refault cost %u permille, step %u KB, skipping %u rounds",
+    [LANG_PROACTIVE_FAILED] = "Proactive reclaim of cgroup %s failed: %d",
 
     // Logger strings
     [LANG_LOG_BUFFER_CREATE_FAILED] = "MoeAI-C: Failed to create log buffer",
@@ -240,9 +469,50 @@ static const char* const en_strings[] = {
     [LANG_TEST_MEM_RECLAIM_PASSED] = "Test passed: Successfully reclaimed memory, freed %ld KB",
     [LANG_TEST_MEM_STOP_FAILED] = "Test failed: Failed to stop memory monitor, error code: %d",
     [LANG_TEST_MEM_STOP_PASSED] = "Test passed: Successfully stopped memory monitor",
+    [LANG_TEST_MEM_STATE_FAILED] = "Test failed: Unexpected memory state or exit thresholds (state=%d, warn exit=%u%%)",
+    [LANG_TEST_MEM_STATE_PASSED] = "Test passed: Memory state machine ready and exit thresholds normalized",
+    [LANG_TEST_MEM_NODE_FAILED] = "Test failed: Per-node memory statistics unavailable (nodes=%d)",
+    [LANG_TEST_MEM_NODE_PASSED] = "Test passed: Per-node memory statistics collected for %d node(s)",
     [LANG_TEST_MEM_ALL_PASSED] = "MoeAI-C: All memory monitor tests passed!",
     [LANG_TEST_MEM_CLEANUP] = "MoeAI-C: Memory monitor test cleanup completed",
     [LANG_TEST_MEM_MODULE_DESC] = "MoeAI-C Memory Monitor Test Module",
+    [LANG_TEST_HOLT_START] = "MoeAI-C: Starting trend forecast test",
+    [LANG_TEST_HOLT_CONST_FAILED] = "Test failed: Constant series drifted (level=%lld, trend=%lld)",
+    [LANG_TEST_HOLT_CONST_PASSED] = "Test passed: Constant series keeps its level with zero trend",
+    [LANG_TEST_HOLT_RAMP_FAILED] = "Test failed: Linear ramp trend %lld, expected about %lld per second",
+    [LANG_TEST_HOLT_RAMP_PASSED] = "Test passed: Linear ramp trend and forecast converged",
+    [LANG_TEST_HOLT_TIME_TO_FAILED] = "Test failed: Time to threshold %u ms (ret=%d), expected about %u ms",
+    [LANG_TEST_HOLT_TIME_TO_PASSED] = "Test passed: Time to threshold matches the trend",
+    [LANG_TEST_HOLT_FALLING_FAILED] = "Test failed: Falling or single-sample series reported a time to threshold (ret=%d)",
+    [LANG_TEST_HOLT_FALLING_PASSED] = "Test passed: Falling and single-sample series never reach the threshold",
+    [LANG_TEST_HOLT_RING_FAILED] = "Test failed: Sample history error (count=%u, newest=%lld)",
+    [LANG_TEST_HOLT_RING_PASSED] = "Test passed: Sample history wraps and keeps the newest samples",
+    [LANG_TEST_HOLT_ALL_PASSED] = "MoeAI-C: All trend forecast tests passed!",
+    [LANG_TEST_HOLT_MODULE_DESC] = "MoeAI-C Trend Forecast Test Module",
+    [LANG_TEST_POLICY_START] = "MoeAI-C: Starting reclaim policy selection test",
+    [LANG_TEST_POLICY_INIT_FAILED] = "Test failed: Failed to initialize policy selection, error code: %d",
+    [LANG_TEST_POLICY_DEFAULT_FAILED] = "Test failed: Without data the default policy %d should be chosen, got %d",
+    [LANG_TEST_POLICY_DEFAULT_PASSED] = "Test passed: Default policy chosen without data",
+    [LANG_TEST_POLICY_BOUNDS_FAILED] = "Test failed: Confidence bounds inconsistent (rate=%u%%, lower=%u%%, upper=%u%%)",
+    [LANG_TEST_POLICY_BOUNDS_PASSED] = "Test passed: Confidence bounds contain the rate and narrow with more trials",
+    [LANG_TEST_POLICY_RELIABLE_FAILED] = "Test failed: Proven cheaper policy not chosen (expected %d, got %d)",
+    [LANG_TEST_POLICY_RELIABLE_PASSED] = "Test passed: Cheapest reliable policy chosen",
+    [LANG_TEST_POLICY_AVOID_FAILED] = "Test failed: Policy %d chosen despite failing every trial",
+    [LANG_TEST_POLICY_AVOID_PASSED] = "Test passed: Failing policy avoided",
+    [LANG_TEST_POLICY_CONFIG_FAILED] = "Test failed: Fixed mapping or config validation broken (%d)",
+    [LANG_TEST_POLICY_CONFIG_PASSED] = "Test passed: Fixed mapping and config validation work",
+    [LANG_TEST_POLICY_ALL_PASSED] = "MoeAI-C: All reclaim policy selection tests passed!",
+    [LANG_TEST_POLICY_MODULE_DESC] = "MoeAI-C Reclaim Policy Selection Test Module",
+    [LANG_TEST_CTL_START] = "MoeAI-C: Starting control command test",
+    [LANG_TEST_CTL_INIT_FAILED] = "Test failed: Failed to initialize control commands, error code: %d",
+    [LANG_TEST_CTL_APPLY_FAILED] = "Test failed: Valid batch not applied (ret=%d, interval=%u ms)",
+    [LANG_TEST_CTL_APPLY_PASSED] = "Test passed: Valid batch applied, comments and blank lines ignored",
+    [LANG_TEST_CTL_REJECT_FAILED] = "Test failed: Invalid batch changed the configuration (ret=%d, interval=%u ms)",
+    [LANG_TEST_CTL_REJECT_PASSED] = "Test passed: Batch with an unknown command or bad argument rejected as a whole",
+    [LANG_TEST_CTL_ROLLBACK_FAILED] = "Test failed: Rejected commit was not rolled back (ret=%d, interval=%u ms)",
+    [LANG_TEST_CTL_ROLLBACK_PASSED] = "Test passed: Modules committed before a rejected one rolled back",
+    [LANG_TEST_CTL_ALL_PASSED] = "MoeAI-C: All control command tests passed!",
+    [LANG_TEST_CTL_MODULE_DESC] = "MoeAI-C Control Command Test Module",
     
     // Ring buffer test strings
     [LANG_TEST_RB_START] = "MoeAI-C: Starting ring buffer test",
@@ -264,7 +534,15 @@ static const char* const en_strings[] = {
     [LANG_TEST_RB_EMPTY_READ_PASSED] = "Test passed: Empty buffer read handled correctly",
     [LANG_TEST_RB_ALL_PASSED] = "MoeAI-C: All ring buffer tests passed!",
     [LANG_TEST_RB_CLEANUP] = "MoeAI-C: Ring buffer test cleanup completed",
-    [LANG_TEST_RB_MODULE_DESC] = "MoeAI-C Ring Buffer Test Module"
+    [LANG_TEST_RB_MODULE_DESC] = "MoeAI-C Ring Buffer Test Module",
+    [LANG_TEST_NODE_START] = "MoeAI-C: Starting node-targeted reclaim test",
+    [LANG_TEST_NODE_ARGS_FAILED] = "Test failed: Invalid node or target accepted (ret=%ld)",
+    [LANG_TEST_NODE_ARGS_PASSED] = "Test passed: Invalid node and zero target are rejected",
+    [LANG_TEST_NODE_UNSUPPORTED_FAILED] = "Test failed: Reclaim without kernel support returned %ld instead of -EOPNOTSUPP",
+    [LANG_TEST_NODE_UNSUPPORTED_PASSED] = "Test passed: Kernel has no per-node reclaim, node %d reports it as unsupported",
+    [LANG_TEST_NODE_FREE_FAILED] = "Test failed: Node %d free memory did not rise (before=%lu KB, after=%lu KB, ret=%ld)",
+    [LANG_TEST_NODE_FREE_PASSED] = "Test passed: Node %d free memory rose from %lu KB to %lu KB",
+    [LANG_TEST_NODE_ALL_PASSED] = "MoeAI-C: All node-targeted reclaim tests passed",
 };
 
 #endif // MOEAI_EN_STRINGS_H
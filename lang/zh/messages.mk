@@ -27,6 +27,7 @@ MSG_QEMU_MINIMAL = 创建最小化测试initramfs...
 MSG_MINIMAL_CREATED = 最小化initramfs已创建
 MSG_USE_TEST_CMD = 使用以下命令测试
 MSG_CI_TEST_RUN = 运行CI环境自动化测试...
+MSG_QEMU_NUMA_TEST_RUN = 在双节点NUMA拓扑上运行QEMU测试...
 MSG_CLEAN_TEST_ENV = 清理测试环境...
 MSG_TEST_ENV_CLEANED = 测试环境已清理
 MSG_START_QEMU = 启动 QEMU...
@@ -109,6 +110,7 @@ MSG_HELP_QEMU_PACK = 打包 initramfs 为 cpio.gz 映像
 MSG_HELP_QEMU_RUN = 运行 QEMU 虚拟机
 MSG_HELP_QEMU_CHECK = 检查 QEMU 环境兼容性
 MSG_HELP_QEMU_MINIMAL = 创建最小化 initramfs 用于测试
+MSG_HELP_QEMU_NUMA_TEST = 在双节点 NUMA 拓扑上运行 QEMU 测试
 
 # 帮助信息中其他目标
 MSG_HELP_MKDIR = 创建构建所需的目录
@@ -17,10 +17,41 @@ static const char* const zh_strings[] = {
     [LANG_CLI_HELP_AVAIL_CMDS] = "可用命令:",
     [LANG_CLI_CMD_STATUS] = "  status            显示当前系统状态",
     [LANG_CLI_CMD_RECLAIM] = "  reclaim           触发内存回收",
+    [LANG_CLI_CMD_RECLAIM_NODE] = "  reclaim node N    在NUMA节点N上触发定向回收",
+    [LANG_CLI_CMD_COMPACT] = "  compact [N]       规整所有节点或NUMA节点N的内存",
     [LANG_CLI_CMD_SET_THRESHOLD] = "  set threshold N   设置内存监控阈值为N%%",
     [LANG_CLI_CMD_SET_INTERVAL] = "  set interval N    设置检查间隔为N毫秒",
     [LANG_CLI_CMD_SET_AUTORECLAIM] = "  set autoreclaim on|off  切换自动回收",
+    [LANG_CLI_CMD_SET_HYSTERESIS] = "  set hysteresis N  设置退出阈值比进入阈值低N个百分点",
+    [LANG_CLI_CMD_SET_DWELL] = "  set dwell N       设置状态最短驻留时间为N毫秒",
+    [LANG_CLI_CMD_SET_COOLDOWN] = "  set cooldown P N  设置回收策略P(gentle|moderate|aggressive)的冷却时间为N毫秒",
+    [LANG_CLI_CMD_SET_NODE_THRESHOLD] = "  set nodethreshold W C  设置节点警告和临界阈值",
+    [LANG_CLI_CMD_SET_RATE] = "  set rate R N      设置速率触发阈值 R (direct_scan|allocstall|refault) 为每秒 N，0 表示禁用",
+    [LANG_CLI_CMD_SET_HORIZON] = "  set horizon N     预计 N 毫秒内越过阈值时提前回收，0 表示禁用",
+    [LANG_CLI_CMD_SET_MIN_RECLAIM] = "  set minreclaim N  选定策略预计可回收量低于 N KB 时放弃自动回收，0 表示不检查",
+    [LANG_CLI_CMD_SET_WMARK] = "  set wmark on|off  区域跌破 low 或 min 水位时抬高压力状态",
+    [LANG_CLI_CMD_SET_STALL] = "  set stall L US    直接回收停顿的99分位达到 US 微秒时抬高压力状态 (L: warn|critical)，0 表示禁用",
+    [LANG_CLI_CMD_SET_THRASH] = "  set thrash T N    设置抖动判定阈值 T (swap|refault 页/秒, activate 百分比) 为 N，0 表示禁用",
+    [LANG_CLI_CMD_SET_FRAG] = "  set frag P N      设置碎片监控参数 P (order|percent|index|cooldown|zones) 为 N",
+    [LANG_CLI_CMD_SET_POLICY] = "  set policy P N    设置回收策略选择参数 P (adaptive 0|1、target 百分比、explore 间隔) 为 N",
+    [LANG_CLI_CMD_SET_MEMCG] = "  set memcg P N     设置 cgroup 监控参数 P (interval 毫秒|batch|top|warn|critical 百分比|psi 0.01%|max) 为 N",
+    [LANG_CLI_CMD_SET_MEMCG_THRESHOLD] = "  set memcgthreshold PATH W C  设置 cgroup PATH 的警告与严重阈值，0 0 恢复默认",
+    [LANG_CLI_CMD_SET_RSS] = "  set rss P N       设置进程RSS排行参数 P (interval 毫秒|batch|top|max) 为 N",
+    [LANG_CLI_CMD_SET_WSS] = "  set wss P N       设置工作集估算参数 P (interval 毫秒|batch 页数|age 毫秒) 为 N",
+    [LANG_CLI_CMD_SET_WSS_TARGET] = "  set wsstarget PATH on|off  选中或取消工作集估算的 cgroup，/ 表示全部内存",
+    [LANG_CLI_CMD_SET_PROACTIVE] = "  set proactive on|off  在压力出现前定期从选中的 cgroup 回收冷内存",
+    [LANG_CLI_CMD_SET_PROACTIVE_PARAM] = "  set proactiveparam P N  设置主动回收参数 P (interval 毫秒|step KB|cost 重新缺页占回收量的千分比) 为 N",
+    [LANG_CLI_CMD_SET_PROACTIVE_TARGET] = "  set proactivetarget PATH on|off  选中或取消主动回收的 cgroup",
+    [LANG_CLI_CMD_SAMPLE_BURST] = "  sample burst I D  每隔 I (如 500us、1ms) 记录一次快照，持续 D (如 10s)",
+    [LANG_CLI_CMD_SAMPLE_STOP] = "  sample stop       提前结束突发采样",
+    [LANG_CLI_CMD_SAMPLE_DUMP] = "  sample dump FILE  将最近一次突发采样保存为二进制文件",
+    [LANG_CLI_CMD_TOP] = "  top               显示占用内存最多和增长最快的进程",
+    [LANG_CLI_CMD_STATS] = "  stats             解码二进制统计文件，每行输出一个字段",
+    [LANG_CLI_CMD_LIVE] = "  live              通过共享实时页读取一次快照，不经过 read 系统调用",
+    [LANG_CLI_CMD_BATCH] = "  batch FILE        将 FILE 中的命令作为一个事务执行 (- 表示标准输入)",
+    [LANG_CLI_CMD_EVENTS] = "  events            实时输出内存状态变化和回收完成事件",
     [LANG_CLI_CMD_SELFTEST] = "  selftest          运行模块自检并显示结果",
+    [LANG_CLI_CMD_SELFTEST_HISTORY] = "  selftest history  对比保留的历次自检结果，不重新运行测试",
     [LANG_CLI_CMD_LOG] = "  log              显示模块日志",
     [LANG_CLI_CMD_HELP] = "  help              显示帮助信息",
 
@@ -31,8 +62,31 @@ static const char* const zh_strings[] = {
     [LANG_CLI_ERR_OPEN_CONTROL] = "无法打开控制文件",
     [LANG_CLI_ERR_OPEN_SELFTEST] = "无法打开自检结果文件",
     [LANG_CLI_ERR_OPEN_LOG] = "无法打开日志文件",
+    [LANG_CLI_ERR_OPEN_BURST] = "无法打开突发采样文件",
+    [LANG_CLI_ERR_WRITE_FILE] = "无法写入输出文件",
     [LANG_CLI_ERR_TRIGGER_SELFTEST] = "无法触发自检",
+    [LANG_CLI_ERR_SELFTEST_TIMEOUT] = "等待自检结果超时",
+    [LANG_CLI_ERR_SELFTEST_FORMAT] = "无法识别的自检历史格式",
     [LANG_CLI_ERR_INSUFFICIENT_ARGS] = "错误: 参数不足\n",
+    [LANG_CLI_ERR_INVALID_POLICY] = "错误: 未知回收策略: %s\n",
+    [LANG_CLI_ERR_INVALID_RATE] = "错误: 未知速率触发项: %s\n",
+    [LANG_CLI_ERR_INVALID_STALL] = "错误: 未知停顿等级: %s\n",
+    [LANG_CLI_ERR_INVALID_THRASH] = "错误: 未知抖动判定项: %s\n",
+    [LANG_CLI_ERR_INVALID_FRAG] = "错误: 未知碎片监控参数: %s\n",
+    [LANG_CLI_ERR_INVALID_POLICY_PARAM] = "错误: 未知策略选择参数: %s\n",
+    [LANG_CLI_ERR_INVALID_MEMCG] = "错误: 未知 cgroup 监控参数: %s\n",
+    [LANG_CLI_ERR_INVALID_RSS] = "错误: 未知进程RSS排行参数: %s\n",
+    [LANG_CLI_ERR_INVALID_WSS] = "错误: 未知工作集估算参数: %s\n",
+    [LANG_CLI_ERR_INVALID_SWITCH] = "错误: 应为 on 或 off，实际为: %s\n",
+    [LANG_CLI_ERR_INVALID_PROACTIVE] = "错误: 未知主动回收参数: %s\n",
+    [LANG_CLI_ERR_OPEN_TOP_MEM] = "无法打开进程内存排行文件",
+    [LANG_CLI_ERR_OPEN_STATS] = "无法打开二进制统计文件",
+    [LANG_CLI_ERR_OPEN_EVENTS] = "无法读取事件文件",
+    [LANG_CLI_ERR_STATS_FORMAT] = "不支持的二进制统计格式",
+    [LANG_CLI_ERR_MAP_LIVE] = "无法映射实时统计页",
+    [LANG_CLI_ERR_LIVE_READ] = "无法读取一致的实时统计快照",
+    [LANG_CLI_ERR_READ_FILE] = "无法读取文件",
+    [LANG_CLI_ERR_BATCH_TOO_LONG] = "错误: 一批命令不能超过 %d 字节\n",
 
     // Operation messages
     [LANG_CLI_MSG_MEM_RECLAIM] = "正在执行内存回收...",
@@ -40,7 +94,35 @@ static const char* const zh_strings[] = {
     [LANG_CLI_MSG_SET_THRESHOLD] = "设置内存监控阈值为%d%%...",
     [LANG_CLI_MSG_SET_INTERVAL] = "设置检查间隔为%d毫秒...",
     [LANG_CLI_MSG_SET_AUTORECLAIM] = "设置自动回收为%s...",
+    [LANG_CLI_MSG_SET_HYSTERESIS] = "设置阈值滞后量为%d%%...",
+    [LANG_CLI_MSG_SET_DWELL] = "设置状态最短驻留时间为%d毫秒...",
+    [LANG_CLI_MSG_SET_COOLDOWN] = "设置%s回收冷却时间为%d毫秒...",
+    [LANG_CLI_MSG_SET_NODE_THRESHOLD] = "设置节点阈值为%d%%/%d%%...",
+    [LANG_CLI_MSG_NODE_RECLAIM] = "正在节点%d上执行定向回收...",
+    [LANG_CLI_MSG_SET_RATE] = "设置 %s 速率阈值为 %d/秒...",
+    [LANG_CLI_MSG_SET_HORIZON] = "设置预测窗口为 %d 毫秒...",
+    [LANG_CLI_MSG_SET_MIN_RECLAIM] = "设置最小可回收内存为 %d KB...",
+    [LANG_CLI_MSG_SET_WMARK] = "设置水位触发为 %s...",
+    [LANG_CLI_MSG_SET_STALL] = "设置 %s 停顿阈值为 %d 微秒...",
+    [LANG_CLI_MSG_SET_THRASH] = "设置 %s 抖动阈值为 %d...",
+    [LANG_CLI_MSG_SET_FRAG] = "设置碎片监控参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_POLICY] = "设置策略选择参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_MEMCG] = "设置 cgroup 监控参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_MEMCG_THRESHOLD] = "设置 cgroup %s 的阈值为警告 %d%%、严重 %d%%...",
+    [LANG_CLI_MSG_SET_RSS] = "设置进程RSS排行参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_WSS] = "设置工作集估算参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_WSS_TARGET] = "设置 cgroup %s 的工作集估算为 %s...",
+    [LANG_CLI_MSG_SET_PROACTIVE] = "设置主动回收为 %s...",
+    [LANG_CLI_MSG_SET_PROACTIVE_PARAM] = "设置主动回收参数 %s 为 %d...",
+    [LANG_CLI_MSG_SET_PROACTIVE_TARGET] = "设置 cgroup %s 的主动回收为 %s...",
+    [LANG_CLI_MSG_COMPACT] = "正在规整内存...",
+    [LANG_CLI_MSG_COMPACT_COMPLETE] = "内存规整完成。",
+    [LANG_CLI_MSG_SAMPLE_BURST] = "开始突发采样: 间隔 %s，时长 %s...",
+    [LANG_CLI_MSG_SAMPLE_DUMP] = "已写入 %ld 字节到 %s",
     [LANG_CLI_MSG_SELFTEST_RESULT] = "====== MoeAI-C 模块自检结果 ======",
+    [LANG_CLI_MSG_SELFTEST_NO_HISTORY] = "尚无自检记录",
+    [LANG_CLI_MSG_NOTIFY_ADD] = "eventfd %u 已登记，事件掩码 0x%x",
+    [LANG_CLI_MSG_NOTIFY_DEL] = "eventfd %u 已注销",
 
     // Module initialization messages
     [LANG_MODULE_INIT_START] = "MoeAI-C: 开始模块初始化",
@@ -58,6 +140,7 @@ static const char* const zh_strings[] = {
     [LANG_ERR_LOG_INIT_FAILED] = "MoeAI-C: 日志系统初始化失败(错误 %d)",
     [LANG_ERR_MEM_INIT_FAILED] = "MoeAI-C: 内存监控初始化失败(错误 %d)",
     [LANG_ERR_PROC_INIT_FAILED] = "MoeAI-C: procfs接口初始化失败(错误 %d)",
+    [LANG_ERR_LIVE_INIT_FAILED] = "MoeAI-C: 实时统计页初始化失败(错误 %d)",
     [LANG_ERR_MEM_START_FAILED] = "MoeAI-C: 内存监控启动失败(错误 %d)",
 
     // Module descriptions
@@ -74,17 +157,38 @@ static const char* const zh_strings[] = {
     [LANG_PROCFS_ERR_CREATE_CONTROL] = "无法创建控制文件",
     [LANG_PROCFS_ERR_CREATE_LOG] = "无法创建日志文件",
     [LANG_PROCFS_ERR_CREATE_SELFTEST] = "无法创建自检文件",
+    [LANG_PROCFS_ERR_CREATE_BURST] = "无法创建突发采样文件",
+    [LANG_PROCFS_ERR_CREATE_TOP_MEM] = "创建 top_mem 文件失败",
+    [LANG_PROCFS_ERR_CREATE_STATS_BIN] = "创建 stats.bin 文件失败",
+    [LANG_PROCFS_ERR_CREATE_METRICS] = "创建 metrics 文件失败",
+    [LANG_PROCFS_ERR_CREATE_EVENTS] = "创建 events 文件失败",
+    [LANG_PROCFS_ERR_CREATE_LIVE] = "创建 live 文件失败",
+    [LANG_PROCFS_ERR_CREATE_SELFTEST_BIN] = "创建 selftest.bin 文件失败",
+    [LANG_PROCFS_CTL_OK] = "第 %u 行: %s: 成功",
+    [LANG_PROCFS_CTL_UNKNOWN] = "第 %u 行: 未知命令: %s",
+    [LANG_PROCFS_CTL_USAGE] = "第 %u 行: %s: 参数无效 (%d)，用法: %s",
+    [LANG_PROCFS_CTL_FAILED] = "第 %u 行: %s: 执行失败 (%d)",
+    [LANG_PROCFS_CTL_SKIPPED] = "第 %u 行: %s: 未执行，整批命令已被拒绝",
+    [LANG_PROCFS_CTL_APPLIED] = "已在一个事务中应用 %u 条配置命令",
+    [LANG_PROCFS_CTL_DUPLICATE] = "控制命令重复注册: %s",
     [LANG_PROCFS_SELFTEST_HEADER] = "MoeAI-C 模块自检结果",
     [LANG_PROCFS_SELFTEST_SUMMARY] = "自检摘要:",
     [LANG_PROCFS_SELFTEST_NOT_RUN] = "尚未运行自检。使用'moectl selftest'命令触发自检",
     [LANG_PROCFS_SELFTEST_NO_BUFFER] = "错误: 未分配自检缓冲区",
+    [LANG_PROCFS_SELFTEST_RUN] = "运行代数",
+    [LANG_PROCFS_SELFTEST_IN_PROGRESS] = "自检第 %llu 次运行进行中，以下为上一次的结果",
+    [LANG_PROCFS_SELFTEST_QUEUED] = "自检第 %llu 次运行已排队",
+    [LANG_PROCFS_SELFTEST_COALESCED] = "自检第 %llu 次运行已在进行，请求已合并",
     [LANG_PROCFS_SELFTEST_MEMORY_TEST] = "- 测试内存监控...",
     [LANG_PROCFS_SELFTEST_RINGBUF_TEST] = "- 测试环形缓冲区功能...",
     [LANG_PROCFS_SELFTEST_LOGGER_TEST] = "- 测试日志系统...",
     [LANG_PROCFS_SELFTEST_PROCFS_TEST] = "- 测试procfs接口...",
     [LANG_PROCFS_SELFTEST_NETGUARD_TEST] = "- 测试网络防护模块...",
     [LANG_PROCFS_SELFTEST_FSLOGGER_TEST] = "- 测试文件系统日志...",
-    [LANG_PROCFS_SELFTEST_PERF_TEST] = "- 运行基本性能测试...",
+    [LANG_PROCFS_SELFTEST_PERF_TEST] = "- 运行微基准测试...",
+    [LANG_PROCFS_SELFTEST_BENCH_UNIT] = "时间单位为每次调用的纳秒数（单调时钟，已预热）",
+    [LANG_PROCFS_SELFTEST_SCALE_TEST] = "- 运行多 CPU 可扩展性测试...",
+    [LANG_PROCFS_SELFTEST_SCALE_UNIT] = "每个 CPU 一个绑定的内核线程；xN 为相对单 CPU 的吞吐量倍数，contended 为需要等待锁的次数",
     [LANG_PROCFS_SELFTEST_SYSINFO_TEST] = "- 收集系统环境信息...",
     [LANG_PROCFS_SELFTEST_PASS] = "  [通过] ",
     [LANG_PROCFS_SELFTEST_WARN] = "  [警告] ",
@@ -93,6 +197,8 @@ static const char* const zh_strings[] = {
     [LANG_PROCFS_SELFTEST_RESULT] = "自检结果:",
     [LANG_PROCFS_SELFTEST_TIME_MS] = "执行时间: %llu.%03llu 毫秒",
     [LANG_PROCFS_SELFTEST_TOTAL] = "总测试数: %u",
+    [LANG_PROCFS_SELFTEST_COMPARE] = "对比运行 %llu",
+    [LANG_PROCFS_SELFTEST_DROPPED] = "因内存不足丢弃的记录: %u",
     [LANG_PROCFS_STATUS_HEADER] = "MoeAI-C 模块状态",
     [LANG_PROCFS_MEMORY_STATUS] = "内存状态:",
     [LANG_PROCFS_MEMORY_CONFIG] = "监控配置:",
@@ -134,10 +240,6 @@ static const char* const zh_strings[] = {
     [LANG_PROCFS_MONITOR_CONFIG_OUTPUT] = "监控配置:",
     [LANG_PROCFS_AUTO_RECLAIM_ON] = "开启",
     [LANG_PROCFS_AUTO_RECLAIM_OFF] = "关闭",
-    [LANG_PROCFS_SELFTEST_MEM_WRITE_PERF] = "测试内存写入性能(1MB)...",
-    [LANG_PROCFS_SELFTEST_MEM_READ_PERF] = "测试内存读取性能(1MB)...",
-    [LANG_PROCFS_SELFTEST_WRITE_TIME] = "1MB写入时间: %llu.%03llu 毫秒",
-    [LANG_PROCFS_SELFTEST_READ_TIME] = "1MB读取时间: %llu.%03llu 毫秒",
     [LANG_PROCFS_TEST_NOT_IMPLEMENTED] = "测试尚未实现",
     [LANG_PROCFS_MEMORY_TOTAL] = "总物理内存",
     [LANG_PROCFS_MEMORY_FREE] = "空闲内存",
@@ -152,6 +254,93 @@ static const char* const zh_strings[] = {
     [LANG_PROCFS_CRITICAL_THRESHOLD] = "严重阈值",
     [LANG_PROCFS_EMERGENCY_THRESHOLD] = "紧急阈值",
     [LANG_PROCFS_AUTO_RECLAIM_STATUS] = "自动回收",
+    [LANG_PROCFS_WARN_EXIT_THRESHOLD] = "警告退出阈值",
+    [LANG_PROCFS_CRITICAL_EXIT_THRESHOLD] = "临界退出阈值",
+    [LANG_PROCFS_EMERGENCY_EXIT_THRESHOLD] = "紧急退出阈值",
+    [LANG_PROCFS_MIN_DWELL] = "状态最短驻留时间",
+    [LANG_PROCFS_RECLAIM_COOLDOWN] = "回收冷却时间",
+    [LANG_PROCFS_PRESSURE_STATE] = "内存压力状态:",
+    [LANG_PROCFS_CURRENT_STATE] = "当前状态",
+    [LANG_PROCFS_STATE_DURATION] = "当前状态持续时间",
+    [LANG_PROCFS_STATE_TRANSITIONS] = "状态切换次数",
+    [LANG_PROCFS_STATE_ENTRIES] = "进入各状态次数",
+    [LANG_PROCFS_RECLAIM_RUNS] = "回收执行次数",
+    [LANG_PROCFS_RECLAIM_SUPPRESSED] = "冷却期跳过的回收次数",
+    [LANG_PROCFS_NODE_WARN_THRESHOLD] = "节点警告阈值",
+    [LANG_PROCFS_NODE_CRITICAL_THRESHOLD] = "节点临界阈值",
+    [LANG_PROCFS_NODE_RECLAIM_TARGET] = "节点定向回收目标",
+    [LANG_PROCFS_NUMA_NODES] = "NUMA 节点:",
+    [LANG_PROCFS_NUMA_TABLE_HEADER] = "  节点     总量 KB      空闲 KB      可用 KB    文件页 KB    匿名页 KB  使用率 状态       回收次数  最近释放 KB",
+    [LANG_PROCFS_NODE_RECLAIM_UNSUPPORTED] = "  节点定向回收: 当前内核不支持",
+    [LANG_PROCFS_RATE_THRESHOLDS] = "速率触发阈值",
+    [LANG_PROCFS_MEMORY_RATES] = "内存活动速率",
+    [LANG_PROCFS_RATE_PGFAULT] = "缺页",
+    [LANG_PROCFS_RATE_PGMAJFAULT] = "主缺页",
+    [LANG_PROCFS_RATE_PGSCAN_KSWAPD] = "扫描页数 (kswapd)",
+    [LANG_PROCFS_RATE_PGSCAN_DIRECT] = "扫描页数 (直接回收)",
+    [LANG_PROCFS_RATE_PGSTEAL_KSWAPD] = "回收页数 (kswapd)",
+    [LANG_PROCFS_RATE_PGSTEAL_DIRECT] = "回收页数 (直接回收)",
+    [LANG_PROCFS_RATE_ALLOCSTALL] = "分配停顿",
+    [LANG_PROCFS_RATE_KSWAPD_RUN] = "kswapd 唤醒",
+    [LANG_PROCFS_RATE_KSWAPD_QUICK] = "kswapd 睡眠后很快再次跌破水位",
+    [LANG_PROCFS_RATE_REFAULT] = "工作集重新缺页",
+    [LANG_PROCFS_FORECAST_HORIZON] = "预测窗口",
+    [LANG_PROCFS_FORECAST] = "内存压力预测:",
+    [LANG_PROCFS_FORECAST_SAMPLES] = "采样数",
+    [LANG_PROCFS_FORECAST_LEVEL] = "平滑使用率",
+    [LANG_PROCFS_FORECAST_TREND] = "使用率趋势",
+    [LANG_PROCFS_FORECAST_TIME_TO] = "预计到达阈值",
+    [LANG_PROCFS_FORECAST_MAE] = "平均绝对误差",
+    [LANG_PROCFS_FORECAST_ACCURACY] = "越线预测",
+    [LANG_PROCFS_FORECAST_TRIGGERS] = "预测触发的回收次数",
+    [LANG_PROCFS_THRASH_THRESHOLDS] = "抖动判定阈值",
+    [LANG_PROCFS_THRASH_WINDOW] = "抖动检测窗口",
+    [LANG_PROCFS_THRASH_SUPPRESSED] = "抖动期间放弃的回收",
+    [LANG_PROCFS_RECLAIM_FUTILE] = "因无内存可回收而放弃的回收",
+    [LANG_PROCFS_RECLAIMABLE] = "可回收内存:",
+    [LANG_PROCFS_RECLAIMABLE_ESTIMATE] = "各策略预计可回收",
+    [LANG_PROCFS_RECLAIMABLE_MIN] = "值得回收的最小量",
+    [LANG_PROCFS_WMARK_LOW_EVENTS] = "区域跌破 low 水位次数",
+    [LANG_PROCFS_WMARK] = "区域水位:",
+    [LANG_PROCFS_WMARK_TRIGGER] = "水位触发",
+    [LANG_PROCFS_WMARK_TABLE_HEADER] = "  节点 区域        空闲 KB    min KB     low KB     high KB  位置   跌破次数",
+    [LANG_PROCFS_STALL] = "直接回收停顿:",
+    [LANG_PROCFS_STALL_DETACHED] = "未挂接到 vmscan 跟踪点",
+    [LANG_PROCFS_STALL_TOTAL] = "挂接以来",
+    [LANG_PROCFS_STALL_WINDOW] = "最近检查间隔",
+    [LANG_PROCFS_STALL_HISTOGRAM] = "直方图",
+    [LANG_PROCFS_STALL_UNTRACKED] = "未计时的停顿",
+    [LANG_PROCFS_STALL_THRESHOLDS] = "99分位触发阈值",
+    [LANG_PROCFS_FRAGMENTATION] = "内存碎片 (各阶空闲块数):",
+    [LANG_PROCFS_FRAG_CONFIG] = "规整触发条件",
+    [LANG_PROCFS_FRAG_HIGH_ORDER] = "高阶空闲占比",
+    [LANG_PROCFS_FRAG_INDEX] = "碎片化指数",
+    [LANG_PROCFS_FRAG_COMPACT_RUNS] = "规整次数",
+    [LANG_PROCFS_BURST] = "突发采样:",
+    [LANG_PROCFS_BURST_RUNNING] = "进行中",
+    [LANG_PROCFS_BURST_FINISHED] = "已结束",
+    [LANG_PROCFS_POLICY] = "回收策略效果:",
+    [LANG_PROCFS_POLICY_ADAPTIVE] = "自适应选择",
+    [LANG_PROCFS_POLICY_TABLE_HEADER] = "  策略          次数  平均释放 KB  平均耗时 us  最长耗时 us  各等级成功率: 成功/结算[置信区间]",
+    [LANG_PROCFS_MEMCG] = "内存 cgroup:",
+    [LANG_PROCFS_MEMCG_UNAVAILABLE] = "未检测到 cgroup v2 内存控制器",
+    [LANG_PROCFS_MEMCG_TRACKED] = "跟踪数",
+    [LANG_PROCFS_MEMCG_PASSES] = "遍历轮数",
+    [LANG_PROCFS_MEMCG_TABLE_HEADER] = "  用量 MB    限制 MB    使用率   PSI some  状态       警告/严重  路径",
+    [LANG_PROCFS_TOP_MEM] = "进程内存排行",
+    [LANG_PROCFS_TOP_MEM_PENDING] = "首轮进程遍历尚未完成",
+    [LANG_PROCFS_TOP_MEM_BY_RSS] = "按常驻内存",
+    [LANG_PROCFS_TOP_MEM_BY_GROWTH] = "按RSS增长速度",
+    [LANG_PROCFS_TOP_MEM_TABLE_HEADER] = "       PID  进程                   RSS KB   增长 KB/秒",
+    [LANG_PROCFS_WSS] = "工作集估算:",
+    [LANG_PROCFS_WSS_UNAVAILABLE] = "空闲页跟踪不可用 (CONFIG_IDLE_PAGE_TRACKING)",
+    [LANG_PROCFS_WSS_PASSES] = "完整扫描轮数",
+    [LANG_PROCFS_WSS_COLD_AGE] = "冷内存判定时长 (扫描轮数)",
+    [LANG_PROCFS_WSS_BUCKETS] = "空闲时长分桶",
+    [LANG_PROCFS_WSS_TABLE_HEADER] = "    扫描 MB   工作集 MB   冷 MB  各空闲时长 MB (匿名/文件)  路径",
+    [LANG_PROCFS_PROACTIVE] = "主动回收:",
+    [LANG_PROCFS_PROACTIVE_STATUS] = "主动回收",
+    [LANG_PROCFS_PROACTIVE_TABLE_HEADER] = "     轮数    回收 MB    上轮 KB  重新缺页 MB   代价  每轮 KB 跳过     退避   不足  路径",
     [LANG_CORE_ALREADY_INITIALIZED] = "MoeAI-C: 核心系统已初始化",
     [LANG_CORE_INIT_START] = "MoeAI-C: 开始核心系统初始化, 调试模式: %s",
     [LANG_CORE_INIT_COMPLETE] = "MoeAI-C: 核心系统初始化完成",
@@ -171,6 +360,8 @@ static const char* const zh_strings[] = {
     [LANG_MEM_MODERATE_RECLAIM] = "执行中等强度内存回收",
     [LANG_MEM_AGGRESSIVE_RECLAIM] = "执行积极内存回收",
     [LANG_MEM_COMPACT_NOT_SUPPORTED] = "当前内核不支持内存压缩操作",
+    [LANG_MEM_COMPACT_RESULT] = "节点 %d 区域 %s 规整完成: 不低于 %u 阶的空闲块 %lu -> %lu",
+    [LANG_MEM_COMPACT_FAILED] = "节点 %d 规整失败: %d",
     [LANG_MEM_INVALID_POLICY] = "无效的回收策略: %d",
     [LANG_MEM_ABOVE_EMERGENCY] = "内存使用率(%u%%)超过紧急阈值(%u%%)",
     [LANG_MEM_ABOVE_CRITICAL] = "内存使用率(%u%%)超过临界阈值(%u%%)",
@@ -180,6 +371,44 @@ static const char* const zh_strings[] = {
     [LANG_MEM_STARTED] = "内存监控已启动，检查间隔: %u毫秒",
     [LANG_MEM_STOPPED] = "内存监控已停止",
     [LANG_MEM_CONFIG_UPDATED] = "内存监控配置已更新",
+    [LANG_MEM_STATE_CHANGED] = "内存状态变化: %s -> %s (使用率 %u%%)",
+    [LANG_MEM_RECLAIM_COOLDOWN] = "回收策略 %d 处于冷却期，已跳过",
+    [LANG_MEM_RECLAIM_ESTIMATE] = "开始%s回收，预计最多可回收 %lu KB",
+    [LANG_MEM_RECLAIM_ACTION_FAILED] = "%s回收操作失败: %d",
+    [LANG_MEM_RECLAIM_FUTILE] = "放弃%s回收: 仅 %lu KB 可回收 (文件页 %lu KB，脏页 %lu KB，slab %lu KB，匿名页 %lu KB，剩余交换空间 %lu KB)，需要由用户空间释放内存",
+    [LANG_MEM_STATE_NORMAL] = "正常",
+    [LANG_MEM_STATE_WARNING] = "警告",
+    [LANG_MEM_STATE_CRITICAL] = "临界",
+    [LANG_MEM_STATE_EMERGENCY] = "紧急",
+    [LANG_MEM_STATE_THRASHING] = "抖动",
+    [LANG_MEM_POLICY_GENTLE] = "温和",
+    [LANG_MEM_POLICY_MODERATE] = "中等",
+    [LANG_MEM_POLICY_AGGRESSIVE] = "积极",
+    [LANG_MEM_NODE_RECLAIM] = "在节点 %d 上执行定向回收，目标 %lu KB",
+    [LANG_MEM_NODE_RECLAIM_UNSUPPORTED] = "当前内核不支持在节点 %d 上定向回收 (需要 /sys/devices/system/node/nodeN/reclaim)",
+    [LANG_MEM_NODE_RECLAIM_DISABLED] = "内核没有按节点回收的接口，已禁用自动节点定向回收",
+    [LANG_MEM_NODE_STATE_CHANGED] = "节点 %d 内存状态变化: %s -> %s (使用率 %u%%)",
+    [LANG_MEM_RATE_PRESSURE] = "回收活动表明存在内存压力: 直接扫描 %lu/秒, 分配停顿 %lu/秒, 重新缺页 %lu/秒",
+    [LANG_MEM_WMARK_LOW] = "节点 %d 区域 %s 跌破 low 水位: 空闲 %lu KB，low %lu KB，min %lu KB",
+    [LANG_MEM_STALL_PRESSURE] = "直接回收停顿表明存在内存压力: 99分位 %llu 微秒, 最长 %llu 微秒, 共 %llu 次",
+    [LANG_STALL_TP_MISSING] = "未找到 vmscan 直接回收跟踪点，不记录停顿延迟",
+    [LANG_STALL_ATTACHED] = "已挂接到 vmscan 直接回收跟踪点",
+    [LANG_STALL_ATTACH_FAILED] = "挂接 vmscan 跟踪点失败: %d",
+    [LANG_MEM_FORECAST_CROSSING] = "预测: 内存使用率预计达到%s阈值还需 %u 秒，提前回收",
+    [LANG_MEM_THRASHING_DETECTED] = "检测到内存抖动 (换入 %lu/秒, 换出 %lu/秒, 重新缺页 %lu/秒, 激活 %lu/秒)，已停止自动回收",
+    [LANG_MEM_THRASHING_CLEARED] = "内存抖动已消除，恢复为%s状态",
+    [LANG_MEM_BURST_STARTED] = "突发采样已开始，间隔 %u 微秒，时长 %u 毫秒",
+    [LANG_MEM_BURST_FINISHED] = "突发采样已结束，共记录 %u 条快照",
+    [LANG_MEM_BURST_STOPPED] = "突发采样已停止，共记录 %u 条快照",
+    [LANG_MEM_BURST_FAILED] = "无法启动突发采样:",
+    [LANG_MEM_POLICY_SELECTED] = "选用回收策略 %s 而非 %s (成功率 %u%%，已结算 %llu 次)",
+    [LANG_MEMCG_STATE_CHANGED] = "内存 cgroup %s: %s -> %s (使用率 %u.%02u%%，压力 %u.%02u%%)",
+    [LANG_MEMCG_UNAVAILABLE] = "%s 下未找到 cgroup v2 内存控制器，cgroup 监控未启用",
+    [LANG_WSS_UNAVAILABLE] = "%s 不可用，工作集估算已禁用",
+    [LANG_WSS_SCAN_FAILED] = "空闲页扫描失败: %d，工作集估算已禁用",
+    [LANG_WSS_RECLAIM_COLD] = "回收 cgroup %s 的冷内存: %lu KB (%d)",
+    [LANG_PROACTIVE_BACKOFF] = "cgroup %s 的主动回收退避: 重新缺页代价 %u‰, 每轮 %u KB, 跳过 %u 轮",
+    [LANG_PROACTIVE_FAILED] = "cgroup %s 的主动回收失败: %d",
 
     // 日志系统字符串
     [LANG_LOG_BUFFER_CREATE_FAILED] = "MoeAI-C: 无法创建日志缓冲区",
@@ -237,9 +466,50 @@ static const char* const zh_strings[] = {
     [LANG_TEST_MEM_RECLAIM_PASSED] = "测试通过: 成功回收内存，释放 %ld KB",
     [LANG_TEST_MEM_STOP_FAILED] = "测试失败: 无法停止内存监控，错误码: %d",
     [LANG_TEST_MEM_STOP_PASSED] = "测试通过: 成功停止内存监控",
+    [LANG_TEST_MEM_STATE_FAILED] = "测试失败: 内存状态或退出阈值异常 (状态=%d, 警告退出=%u%%)",
+    [LANG_TEST_MEM_STATE_PASSED] = "测试通过: 内存状态机就绪，退出阈值已规范化",
+    [LANG_TEST_MEM_NODE_FAILED] = "测试失败: 无法获取节点内存统计 (节点数=%d)",
+    [LANG_TEST_MEM_NODE_PASSED] = "测试通过: 已获取 %d 个节点的内存统计",
     [LANG_TEST_MEM_ALL_PASSED] = "MoeAI-C: 所有内存监控测试通过!",
     [LANG_TEST_MEM_CLEANUP] = "MoeAI-C: 内存监控测试清理完成",
     [LANG_TEST_MEM_MODULE_DESC] = "MoeAI-C 内存监控测试模块",
+    [LANG_TEST_HOLT_START] = "MoeAI-C: 开始趋势预测测试",
+    [LANG_TEST_HOLT_CONST_FAILED] = "测试失败: 恒定序列发生漂移 (水平值=%lld, 斜率=%lld)",
+    [LANG_TEST_HOLT_CONST_PASSED] = "测试通过: 恒定序列保持水平值且斜率为0",
+    [LANG_TEST_HOLT_RAMP_FAILED] = "测试失败: 线性序列斜率为 %lld，应约为每秒 %lld",
+    [LANG_TEST_HOLT_RAMP_PASSED] = "测试通过: 线性序列的斜率和预测值已收敛",
+    [LANG_TEST_HOLT_TIME_TO_FAILED] = "测试失败: 到达阈值时间为 %u 毫秒 (返回值=%d)，应约为 %u 毫秒",
+    [LANG_TEST_HOLT_TIME_TO_PASSED] = "测试通过: 到达阈值时间与斜率一致",
+    [LANG_TEST_HOLT_FALLING_FAILED] = "测试失败: 下降或只有一个采样的序列给出了到达阈值时间 (返回值=%d)",
+    [LANG_TEST_HOLT_FALLING_PASSED] = "测试通过: 下降和只有一个采样的序列不会到达阈值",
+    [LANG_TEST_HOLT_RING_FAILED] = "测试失败: 采样历史错误 (采样数=%u, 最新值=%lld)",
+    [LANG_TEST_HOLT_RING_PASSED] = "测试通过: 采样历史循环覆盖并保留最新的采样",
+    [LANG_TEST_HOLT_ALL_PASSED] = "MoeAI-C: 所有趋势预测测试通过！",
+    [LANG_TEST_HOLT_MODULE_DESC] = "MoeAI-C 趋势预测测试模块",
+    [LANG_TEST_POLICY_START] = "MoeAI-C: 开始回收策略选择测试",
+    [LANG_TEST_POLICY_INIT_FAILED] = "测试失败: 策略选择初始化失败，错误码: %d",
+    [LANG_TEST_POLICY_DEFAULT_FAILED] = "测试失败: 没有数据时应选择默认策略 %d，实际为 %d",
+    [LANG_TEST_POLICY_DEFAULT_PASSED] = "测试通过: 没有数据时选择默认策略",
+    [LANG_TEST_POLICY_BOUNDS_FAILED] = "测试失败: 置信区间不一致 (成功率=%u%%, 下界=%u%%, 上界=%u%%)",
+    [LANG_TEST_POLICY_BOUNDS_PASSED] = "测试通过: 置信区间包含成功率且随结算次数收窄",
+    [LANG_TEST_POLICY_RELIABLE_FAILED] = "测试失败: 未选择已被证明可靠的更便宜策略 (应为 %d, 实际为 %d)",
+    [LANG_TEST_POLICY_RELIABLE_PASSED] = "测试通过: 选择了开销最低的可靠策略",
+    [LANG_TEST_POLICY_AVOID_FAILED] = "测试失败: 每次都失败的策略 %d 仍被选中",
+    [LANG_TEST_POLICY_AVOID_PASSED] = "测试通过: 避开了失败的策略",
+    [LANG_TEST_POLICY_CONFIG_FAILED] = "测试失败: 固定映射或配置校验有误 (%d)",
+    [LANG_TEST_POLICY_CONFIG_PASSED] = "测试通过: 固定映射和配置校验正常",
+    [LANG_TEST_POLICY_ALL_PASSED] = "MoeAI-C: 所有回收策略选择测试通过！",
+    [LANG_TEST_POLICY_MODULE_DESC] = "MoeAI-C 回收策略选择测试模块",
+    [LANG_TEST_CTL_START] = "MoeAI-C: 开始控制命令测试",
+    [LANG_TEST_CTL_INIT_FAILED] = "测试失败: 控制命令初始化失败，错误码: %d",
+    [LANG_TEST_CTL_APPLY_FAILED] = "测试失败: 合法的命令批未生效 (返回值=%d, 间隔=%u 毫秒)",
+    [LANG_TEST_CTL_APPLY_PASSED] = "测试通过: 合法的命令批已生效，注释和空行被忽略",
+    [LANG_TEST_CTL_REJECT_FAILED] = "测试失败: 非法的命令批修改了配置 (返回值=%d, 间隔=%u 毫秒)",
+    [LANG_TEST_CTL_REJECT_PASSED] = "测试通过: 含未知命令或错误参数的命令批被整批拒绝",
+    [LANG_TEST_CTL_ROLLBACK_FAILED] = "测试失败: 提交被拒绝后未回滚 (返回值=%d, 间隔=%u 毫秒)",
+    [LANG_TEST_CTL_ROLLBACK_PASSED] = "测试通过: 某模块拒绝新配置时已提交的模块已回滚",
+    [LANG_TEST_CTL_ALL_PASSED] = "MoeAI-C: 所有控制命令测试通过！",
+    [LANG_TEST_CTL_MODULE_DESC] = "MoeAI-C 控制命令测试模块",
     [LANG_TEST_RB_START] = "MoeAI-C: 开始环形缓冲区测试",
     [LANG_TEST_RB_CREATE_FAILED] = "测试失败: 无法创建环形缓冲区",
     [LANG_TEST_RB_CREATE_PASSED] = "测试通过: 环形缓冲区创建成功",
@@ -260,6 +530,14 @@ static const char* const zh_strings[] = {
     [LANG_TEST_RB_ALL_PASSED] = "MoeAI-C: 所有环形缓冲区测试通过!",
     [LANG_TEST_RB_CLEANUP] = "MoeAI-C: 环形缓冲区测试清理完成",
     [LANG_TEST_RB_MODULE_DESC] = "MoeAI-C 环形缓冲区测试模块",
+    [LANG_TEST_NODE_START] = "MoeAI-C: 开始节点定向回收测试",
+    [LANG_TEST_NODE_ARGS_FAILED] = "测试失败: 接受了无效的节点或目标 (ret=%ld)",
+    [LANG_TEST_NODE_ARGS_PASSED] = "测试通过: 无效节点和零目标被拒绝",
+    [LANG_TEST_NODE_UNSUPPORTED_FAILED] = "测试失败: 内核不支持时回收返回 %ld 而不是 -EOPNOTSUPP",
+    [LANG_TEST_NODE_UNSUPPORTED_PASSED] = "测试通过: 内核没有按节点回收接口，节点 %d 报告为不支持",
+    [LANG_TEST_NODE_FREE_FAILED] = "测试失败: 节点 %d 空闲内存没有增加 (之前=%lu KB，之后=%lu KB，ret=%ld)",
+    [LANG_TEST_NODE_FREE_PASSED] = "测试通过: 节点 %d 空闲内存从 %lu KB 增加到 %lu KB",
+    [LANG_TEST_NODE_ALL_PASSED] = "MoeAI-C: 所有节点定向回收测试通过",
     [LANG_TEST_RB_MODULE_INFO] = "文件: test/test_ring_buffer.c\n描述: 环形缓冲区单元测试",
     [LANG_TEST_RB_COPYRIGHT] = "版权所有 © 2025 @ydzat"
 
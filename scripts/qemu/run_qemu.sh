@@ -36,6 +36,9 @@ KERNEL="${KERNEL:-../linux-6.5.7/arch/x86/boot/bzImage}"
 INITRD="${INITRD:-../initramfs.cpio.gz}"
 CMDLINE="${CMDLINE:-rdinit=/init console=ttyS0 root=/dev/ram0 init=/init}"
 FLAGS="${FLAGS:---enable-kvm}"
+MEMORY="${MEMORY:-1G}"
+SMP="${SMP:-}"
+NUMA_FLAGS="${NUMA_FLAGS:-}"
 
 # 解析路径中的环境变量
 if [ -n "$KERNEL" ]; then
@@ -69,6 +72,10 @@ echo "启动 QEMU..."
 echo "内核: $KERNEL"
 echo "initramfs: $INITRD"
 echo "内核参数: $CMDLINE"
+echo "内存: $MEMORY"
+if [ -n "$NUMA_FLAGS" ]; then
+    echo "NUMA: $NUMA_FLAGS"
+fi
 
 # 检查文件是否存在
 if [ ! -f "$KERNEL" ]; then
@@ -99,7 +106,9 @@ exec qemu-system-x86_64 ${FLAGS} \
     ${VIRTFS} \
     -net user -net nic \
     -nographic \
-    -boot c -m 1G \
+    -boot c -m ${MEMORY} \
+    ${SMP:+-smp $SMP} \
+    ${NUMA_FLAGS} \
     -kernel "${KERNEL}" \
     -initrd "${INITRD}" \
     -append "${CMDLINE}"
\ No newline at end of file
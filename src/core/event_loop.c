@@ -0,0 +1,248 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/core/event_loop.c
+ * 描述: 事件中心实现
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/spinlock.h>
+#include <linux/wait.h>
+#include <linux/atomic.h>
+#include <linux/timekeeping.h>
+#include <linux/eventfd.h>
+#include <linux/list.h>
+#include <linux/slab.h>
+#include <linux/err.h>
+#include <linux/version.h>
+#include "../../include/core/event_loop.h"
+
+/* 一个登记的 eventfd */
+struct moeai_hub_notify {
+    struct list_head node;
+    struct eventfd_ctx *ctx;
+    const void *owner;
+    u32 mask;
+};
+
+/*
+ * 最近事件的环形表，事件代数 seq 存放在 ring[seq % MOEAI_EVENT_HUB_SIZE]。
+ * 发布在持锁时写入表项后再更新代数，读者无锁读取代数，持锁复制表项。
+ * 登记的 eventfd 也受同一把锁保护，发布时直接通知，不经过工作队列。
+ * 静态初始化，不依赖模块初始化顺序，任何模块都可以随时发布。
+ * shutdown 在模块卸载时置位，之后等待的读者立即返回，不再阻塞 proc 条目的删除。
+ */
+static struct {
+    spinlock_t lock;
+    atomic64_t seq;
+    struct moeai_hub_event ring[MOEAI_EVENT_HUB_SIZE];
+    wait_queue_head_t wait;
+    struct list_head notifiers;
+    unsigned int nr_notifiers;
+    bool shutdown;
+} moeai_event_hub = {
+    .lock = __SPIN_LOCK_UNLOCKED(moeai_event_hub.lock),
+    .seq = ATOMIC64_INIT(0),
+    .wait = __WAIT_QUEUE_HEAD_INITIALIZER(moeai_event_hub.wait),
+    .notifiers = LIST_HEAD_INIT(moeai_event_hub.notifiers),
+};
+
+/* eventfd 计数加一，6.8 起 eventfd_signal 不再带计数参数 */
+static void moeai_event_hub_signal(struct eventfd_ctx *ctx)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+    eventfd_signal(ctx);
+#else
+    eventfd_signal(ctx, 1);
+#endif
+}
+
+void moeai_event_hub_publish(enum moeai_hub_event_type type, int from, int to, s64 value)
+{
+    struct moeai_hub_notify *n;
+    struct moeai_hub_event *ev;
+    unsigned long flags;
+    u64 seq;
+
+    spin_lock_irqsave(&moeai_event_hub.lock, flags);
+    seq = atomic64_read(&moeai_event_hub.seq) + 1;
+    ev = &moeai_event_hub.ring[seq % MOEAI_EVENT_HUB_SIZE];
+    ev->seq = seq;
+    ev->time_ns = ktime_get_ns();
+    ev->type = type;
+    ev->from = from;
+    ev->to = to;
+    ev->value = value;
+    atomic64_set_release(&moeai_event_hub.seq, seq);
+    list_for_each_entry(n, &moeai_event_hub.notifiers, node) {
+        if (n->mask & MOEAI_HUB_MASK(type))
+            moeai_event_hub_signal(n->ctx);
+    }
+    spin_unlock_irqrestore(&moeai_event_hub.lock, flags);
+
+    wake_up_interruptible_poll(&moeai_event_hub.wait, EPOLLIN | EPOLLRDNORM);
+}
+
+u64 moeai_event_hub_seq(void)
+{
+    return atomic64_read_acquire(&moeai_event_hub.seq);
+}
+
+int moeai_event_hub_read(u64 after, struct moeai_hub_event *out, int max, u64 *lost)
+{
+    unsigned long flags;
+    u64 seq, oldest;
+    int n = 0;
+
+    *lost = 0;
+    if (max <= 0)
+        return 0;
+
+    spin_lock_irqsave(&moeai_event_hub.lock, flags);
+    seq = atomic64_read(&moeai_event_hub.seq);
+    oldest = seq > MOEAI_EVENT_HUB_SIZE ? seq - MOEAI_EVENT_HUB_SIZE + 1 : 1;
+    if (after + 1 < oldest) {
+        *lost = oldest - after - 1;
+        after = oldest - 1;
+    }
+    while (after < seq && n < max)
+        out[n++] = moeai_event_hub.ring[++after % MOEAI_EVENT_HUB_SIZE];
+    spin_unlock_irqrestore(&moeai_event_hub.lock, flags);
+
+    return n;
+}
+
+int moeai_event_hub_wait(u64 seen)
+{
+    return wait_event_interruptible(moeai_event_hub.wait,
+                                    moeai_event_hub_seq() != seen ||
+                                    READ_ONCE(moeai_event_hub.shutdown));
+}
+
+__poll_t moeai_event_hub_poll(struct file *file, poll_table *wait, u64 seen)
+{
+    __poll_t mask = 0;
+
+    poll_wait(file, &moeai_event_hub.wait, wait);
+    if (moeai_event_hub_seq() != seen)
+        mask |= EPOLLIN | EPOLLRDNORM;
+    if (READ_ONCE(moeai_event_hub.shutdown))
+        mask |= EPOLLHUP;
+    return mask;
+}
+
+void moeai_event_hub_shutdown(void)
+{
+    WRITE_ONCE(moeai_event_hub.shutdown, true);
+    wake_up_interruptible_all(&moeai_event_hub.wait);
+}
+
+bool moeai_event_hub_is_shutdown(void)
+{
+    return READ_ONCE(moeai_event_hub.shutdown);
+}
+
+/* 查找登记者的某个 eventfd，调用者持有锁 */
+static struct moeai_hub_notify *moeai_event_hub_find(const void *owner, struct eventfd_ctx *ctx)
+{
+    struct moeai_hub_notify *n;
+
+    list_for_each_entry(n, &moeai_event_hub.notifiers, node) {
+        if (n->owner == owner && n->ctx == ctx)
+            return n;
+    }
+    return NULL;
+}
+
+int moeai_event_hub_notify_add(const void *owner, int fd, u32 mask)
+{
+    struct moeai_hub_notify *n, *old;
+    struct eventfd_ctx *ctx;
+    unsigned long flags;
+    int ret = 0;
+
+    if (!mask || (mask & ~MOEAI_HUB_MASK_ALL))
+        return -EINVAL;
+
+    ctx = eventfd_ctx_fdget(fd);
+    if (IS_ERR(ctx))
+        return PTR_ERR(ctx);
+
+    n = kzalloc(sizeof(*n), GFP_KERNEL);
+    if (!n) {
+        eventfd_ctx_put(ctx);
+        return -ENOMEM;
+    }
+    n->ctx = ctx;
+    n->owner = owner;
+    n->mask = mask;
+
+    spin_lock_irqsave(&moeai_event_hub.lock, flags);
+    old = moeai_event_hub_find(owner, ctx);
+    if (old) {
+        old->mask = mask;
+    } else if (moeai_event_hub.nr_notifiers >= MOEAI_EVENT_HUB_MAX_NOTIFY) {
+        ret = -ENOSPC;
+    } else {
+        list_add_tail(&n->node, &moeai_event_hub.notifiers);
+        moeai_event_hub.nr_notifiers++;
+        n = NULL;
+    }
+    spin_unlock_irqrestore(&moeai_event_hub.lock, flags);
+
+    /* 未加入列表的新登记连同它持有的引用一起释放 */
+    if (n) {
+        eventfd_ctx_put(n->ctx);
+        kfree(n);
+    }
+    return ret;
+}
+
+int moeai_event_hub_notify_del(const void *owner, int fd)
+{
+    struct moeai_hub_notify *n;
+    struct eventfd_ctx *ctx;
+    unsigned long flags;
+
+    ctx = eventfd_ctx_fdget(fd);
+    if (IS_ERR(ctx))
+        return PTR_ERR(ctx);
+
+    spin_lock_irqsave(&moeai_event_hub.lock, flags);
+    n = moeai_event_hub_find(owner, ctx);
+    if (n) {
+        list_del(&n->node);
+        moeai_event_hub.nr_notifiers--;
+    }
+    spin_unlock_irqrestore(&moeai_event_hub.lock, flags);
+
+    eventfd_ctx_put(ctx);
+    if (!n)
+        return -ENOENT;
+    eventfd_ctx_put(n->ctx);
+    kfree(n);
+    return 0;
+}
+
+void moeai_event_hub_notify_release(const void *owner)
+{
+    struct moeai_hub_notify *n, *tmp;
+    unsigned long flags;
+    LIST_HEAD(dead);
+
+    spin_lock_irqsave(&moeai_event_hub.lock, flags);
+    list_for_each_entry_safe(n, tmp, &moeai_event_hub.notifiers, node) {
+        if (n->owner == owner) {
+            list_move(&n->node, &dead);
+            moeai_event_hub.nr_notifiers--;
+        }
+    }
+    spin_unlock_irqrestore(&moeai_event_hub.lock, flags);
+
+    list_for_each_entry_safe(n, tmp, &dead, node) {
+        eventfd_ctx_put(n->ctx);
+        kfree(n);
+    }
+}
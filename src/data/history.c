@@ -0,0 +1,97 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/data/history.c
+ * 描述: 采样历史与定点趋势预测 (Holt 双指数平滑)
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/errno.h>
+#include <linux/math64.h>
+#include <linux/limits.h>
+#include "../../include/data/history.h"
+
+void moeai_history_init(struct moeai_history *h, u32 alpha, u32 beta)
+{
+    h->alpha = min_t(u32, alpha, MOEAI_FP_ONE);
+    h->beta = min_t(u32, beta, MOEAI_FP_ONE);
+    moeai_history_reset(h);
+}
+
+void moeai_history_reset(struct moeai_history *h)
+{
+    memset(h->samples, 0, sizeof(h->samples));
+    h->head = 0;
+    h->count = 0;
+    h->level = 0;
+    h->trend = 0;
+}
+
+/*
+ * 采样间隔不固定，斜率以"每秒"为单位保存，预测时按实际间隔折算：
+ *   预测值 = level + trend * dt
+ *   level' = alpha * x + (1 - alpha) * 预测值
+ *   trend' = beta * (level' - level) / dt + (1 - beta) * trend
+ */
+void moeai_history_add(struct moeai_history *h, s64 value, unsigned int dt_ms)
+{
+    s64 predicted, level;
+
+    h->samples[h->head] = value;
+    h->head = (h->head + 1) % MOEAI_HISTORY_LEN;
+    if (h->count < MOEAI_HISTORY_LEN)
+        h->count++;
+
+    if (h->count == 1) {
+        h->level = value;
+        h->trend = 0;
+        return;
+    }
+
+    if (dt_ms == 0)
+        dt_ms = 1;
+
+    predicted = moeai_history_forecast(h, dt_ms);
+    level = (h->alpha * value + (MOEAI_FP_ONE - h->alpha) * predicted) >> MOEAI_FP_SHIFT;
+
+    h->trend = (h->beta * div_s64((level - h->level) * MSEC_PER_SEC, dt_ms) +
+                (MOEAI_FP_ONE - h->beta) * h->trend) >> MOEAI_FP_SHIFT;
+    h->level = level;
+}
+
+s64 moeai_history_get(const struct moeai_history *h, unsigned int idx)
+{
+    if (idx >= h->count)
+        return 0;
+
+    return h->samples[(h->head + MOEAI_HISTORY_LEN - 1 - idx) % MOEAI_HISTORY_LEN];
+}
+
+s64 moeai_history_forecast(const struct moeai_history *h, unsigned int ahead_ms)
+{
+    return h->level + div_s64(h->trend * ahead_ms, MSEC_PER_SEC);
+}
+
+int moeai_history_time_to(const struct moeai_history *h, s64 threshold, unsigned int *ms)
+{
+    s64 t;
+
+    /* 至少需要两个采样才有斜率 */
+    if (h->count < 2)
+        return -ERANGE;
+
+    if (h->level >= threshold) {
+        *ms = 0;
+        return 0;
+    }
+
+    if (h->trend <= 0)
+        return -ERANGE;
+
+    t = div64_s64((threshold - h->level) * MSEC_PER_SEC, h->trend);
+    *ms = t > UINT_MAX ? UINT_MAX : (unsigned int)t;
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/data/live.c
+ * 描述: /proc/moeai/live 只读共享页的维护与映射
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/mm.h>
+#include <linux/gfp.h>
+#include <linux/errno.h>
+#include <linux/compiler.h>
+#include <linux/build_bug.h>
+#include <linux/timekeeping.h>
+#include <linux/version.h>
+#include <asm/byteorder.h>
+#include "../../include/data/live.h"
+#include "../../include/modules/mem_monitor.h"
+
+static_assert(sizeof(struct moeai_live_page) <= PAGE_SIZE);
+static_assert(MOEAI_STATE_MAX == MOEAI_STATS_NR_STATES);
+static_assert(MOEAI_MEM_RECLAIM_MAX == MOEAI_STATS_NR_POLICIES);
+
+/* 共享页及写者私有的更新序号，页中的 seq 只由 moeai_live_update() 修改 */
+static struct moeai_live_page *live_page;
+static u32 live_seq;
+
+int moeai_live_init(void)
+{
+    struct moeai_live_page *page;
+
+    page = (struct moeai_live_page *)get_zeroed_page(GFP_KERNEL);
+    if (!page)
+        return -ENOMEM;
+
+    page->header.magic = cpu_to_le32(MOEAI_LIVE_MAGIC);
+    page->header.version = cpu_to_le16(MOEAI_LIVE_VERSION);
+    page->header.size = cpu_to_le16(sizeof(*page));
+    live_seq = 0;
+    live_page = page;
+    return 0;
+}
+
+void moeai_live_exit(void)
+{
+    struct moeai_live_page *page = live_page;
+
+    live_page = NULL;
+    /* 映射持有页的引用，此处只释放模块自己的引用 */
+    if (page)
+        free_page((unsigned long)page);
+}
+
+/* 写入状态机信息与累计计数 */
+static void moeai_live_fill_state(struct moeai_live_page *page,
+                                  const struct moeai_mem_state_info *info)
+{
+    struct moeai_live_counters *c = &page->counters;
+    int i;
+
+    page->mem.state = cpu_to_le32(info->state);
+    page->mem.state_ms = cpu_to_le32(info->state_ms);
+    c->transitions = cpu_to_le64(info->transitions);
+    for (i = 0; i < MOEAI_STATS_NR_STATES; i++)
+        c->state_entries[i] = cpu_to_le64(info->state_entries[i]);
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++) {
+        c->reclaim_runs[i] = cpu_to_le64(info->reclaim_runs[i]);
+        c->reclaim_suppressed[i] = cpu_to_le64(info->reclaim_suppressed[i]);
+    }
+    c->thrash_suppressed = cpu_to_le64(info->thrash_suppressed);
+    c->reclaim_futile = cpu_to_le64(info->reclaim_futile);
+    c->wmark_low_events = cpu_to_le64(info->wmark_low_events);
+}
+
+void moeai_live_update(const struct moeai_mem_stats *stats,
+                       const struct moeai_mem_state_info *info, u32 flags)
+{
+    struct moeai_live_page *page = live_page;
+
+    if (!page || !stats || !info)
+        return;
+
+    /* seq 变为奇数后才写数据，数据写完后 seq 才变回偶数，与读者的读屏障配对 */
+    WRITE_ONCE(page->header.seq, cpu_to_le32(++live_seq));
+    smp_wmb();
+
+    page->header.flags = cpu_to_le32(flags);
+    page->header.update_ns = cpu_to_le64(ktime_get_ns());
+    moeai_stats_fill_mem(stats, &page->mem, &page->rates);
+    moeai_live_fill_state(page, info);
+
+    smp_wmb();
+    WRITE_ONCE(page->header.seq, cpu_to_le32(++live_seq));
+}
+
+int moeai_live_mmap(struct vm_area_struct *vma)
+{
+    struct moeai_live_page *page = live_page;
+
+    if (!page)
+        return -ENODEV;
+    if (vma->vm_pgoff != 0 || vma->vm_end - vma->vm_start > PAGE_SIZE)
+        return -EINVAL;
+    if (vma->vm_flags & VM_WRITE)
+        return -EPERM;
+
+    /* 禁止之后用 mprotect 改为可写 */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 3, 0)
+    vm_flags_clear(vma, VM_MAYWRITE);
+#else
+    vma->vm_flags &= ~VM_MAYWRITE;
+#endif
+
+    /* vm_insert_page 为映射增加页引用，模块卸载后已有的映射仍然有效 */
+    return vm_insert_page(vma, vma->vm_start, virt_to_page(page));
+}
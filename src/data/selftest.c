@@ -0,0 +1,293 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/data/selftest.c
+ * 描述: 自检结果的记录、历史保留与二进制编码
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include <linux/mutex.h>
+#include <linux/seq_file.h>
+#include <linux/utsname.h>
+#include <linux/timekeeping.h>
+#include <linux/build_bug.h>
+#include <asm/byteorder.h>
+#include "../../include/data/selftest.h"
+#include "../../include/utils/bench.h"
+
+/* 记录数组的初始容量和上限，上限只防止失控的测试耗尽内存 */
+#define MOEAI_SELFTEST_INIT_RECORDS 32
+#define MOEAI_SELFTEST_MAX_RECORDS  4096
+
+static_assert(MOEAI_SELFTEST_NR_TESTS <= MOEAI_SELFTEST_MAX_TESTS);
+static_assert(sizeof(struct moeai_selftest_bin_run) == 128);
+static_assert(sizeof(struct moeai_selftest_bin_record) == 80);
+
+/* 已完成的运行，从旧到新 */
+static LIST_HEAD(moeai_selftest_runs);
+static unsigned int moeai_selftest_nr_runs;
+static DEFINE_MUTEX(moeai_selftest_lock);
+
+struct moeai_selftest_run *moeai_selftest_run_alloc(u64 gen)
+{
+    struct moeai_selftest_run *run;
+
+    run = kzalloc(sizeof(*run), GFP_KERNEL);
+    if (!run)
+        return NULL;
+
+    run->records = kcalloc(MOEAI_SELFTEST_INIT_RECORDS, sizeof(*run->records), GFP_KERNEL);
+    if (!run->records) {
+        kfree(run);
+        return NULL;
+    }
+    run->max_records = MOEAI_SELFTEST_INIT_RECORDS;
+
+    kref_init(&run->ref);
+    INIT_LIST_HEAD(&run->node);
+    run->gen = gen;
+    run->start_ns = ktime_get_real_ns();
+    run->start_mono_ns = ktime_get_ns();
+    strscpy(run->release, init_utsname()->release, sizeof(run->release));
+    return run;
+}
+
+static void moeai_selftest_run_release(struct kref *ref)
+{
+    struct moeai_selftest_run *run = container_of(ref, struct moeai_selftest_run, ref);
+
+    kfree(run->records);
+    kfree(run);
+}
+
+void moeai_selftest_run_get(struct moeai_selftest_run *run)
+{
+    kref_get(&run->ref);
+}
+
+void moeai_selftest_run_put(struct moeai_selftest_run *run)
+{
+    if (run)
+        kref_put(&run->ref, moeai_selftest_run_release);
+}
+
+void moeai_selftest_begin(struct moeai_selftest_run *run, enum moeai_selftest_id test)
+{
+    run->cur_test = test;
+}
+
+void moeai_selftest_end(struct moeai_selftest_run *run, enum moeai_selftest_id test, u8 status)
+{
+    if (test < MOEAI_SELFTEST_NR_TESTS)
+        run->status[test] = status;
+}
+
+void moeai_selftest_finish(struct moeai_selftest_run *run)
+{
+    run->duration_ns = ktime_get_ns() - run->start_mono_ns;
+}
+
+/* 追加一条记录，容量不足时翻倍 */
+static struct moeai_selftest_record *moeai_selftest_add(struct moeai_selftest_run *run,
+                                                        u8 type, const char *name)
+{
+    struct moeai_selftest_record *rec;
+
+    if (run->nr_records == run->max_records) {
+        if (run->max_records >= MOEAI_SELFTEST_MAX_RECORDS) {
+            run->dropped++;
+            return NULL;
+        }
+        rec = krealloc(run->records, 2 * run->max_records * sizeof(*rec), GFP_KERNEL);
+        if (!rec) {
+            run->dropped++;
+            return NULL;
+        }
+        run->records = rec;
+        run->max_records *= 2;
+    }
+
+    rec = &run->records[run->nr_records++];
+    memset(rec, 0, sizeof(*rec));
+    rec->test = run->cur_test;
+    rec->type = type;
+    strscpy(rec->name, name, sizeof(rec->name));
+    return rec;
+}
+
+void moeai_selftest_value(struct moeai_selftest_run *run, const char *name, u64 value)
+{
+    struct moeai_selftest_record *rec = moeai_selftest_add(run, MOEAI_SELFTEST_REC_VALUE, name);
+
+    if (rec)
+        rec->v[0] = value;
+}
+
+void moeai_selftest_error(struct moeai_selftest_run *run, const char *name,
+                          unsigned int threads, int err)
+{
+    struct moeai_selftest_record *rec = moeai_selftest_add(run, MOEAI_SELFTEST_REC_ERROR, name);
+
+    if (rec) {
+        rec->arg = min_t(unsigned int, threads, U16_MAX);
+        rec->err = err;
+    }
+}
+
+void moeai_selftest_bench(struct moeai_selftest_run *run, const char *name,
+                          const struct moeai_bench_result *res)
+{
+    struct moeai_selftest_record *rec = moeai_selftest_add(run, MOEAI_SELFTEST_REC_BENCH, name);
+
+    if (!rec)
+        return;
+    rec->v[0] = res->min_ns;
+    rec->v[1] = res->median_ns;
+    rec->v[2] = res->p99_ns;
+    rec->v[3] = res->max_ns;
+    rec->v[4] = res->iterations;
+}
+
+void moeai_selftest_scale(struct moeai_selftest_run *run, const char *name,
+                          unsigned int threads, u64 ops_per_sec, u64 speedup_x100,
+                          u64 contended, u64 ops)
+{
+    struct moeai_selftest_record *rec = moeai_selftest_add(run, MOEAI_SELFTEST_REC_SCALE, name);
+
+    if (!rec)
+        return;
+    rec->arg = min_t(unsigned int, threads, U16_MAX);
+    rec->v[0] = ops_per_sec;
+    rec->v[1] = speedup_x100;
+    rec->v[2] = contended;
+    rec->v[3] = ops;
+}
+
+const struct moeai_selftest_record *moeai_selftest_find(const struct moeai_selftest_run *run,
+                                                        const struct moeai_selftest_record *rec)
+{
+    const struct moeai_selftest_record *r;
+    unsigned int i;
+
+    if (!run)
+        return NULL;
+
+    for (i = 0; i < run->nr_records; i++) {
+        r = &run->records[i];
+        if (r->test == rec->test && r->type == rec->type && r->arg == rec->arg &&
+            strcmp(r->name, rec->name) == 0)
+            return r;
+    }
+    return NULL;
+}
+
+void moeai_selftest_publish(struct moeai_selftest_run *run)
+{
+    struct moeai_selftest_run *oldest = NULL;
+
+    mutex_lock(&moeai_selftest_lock);
+    list_add_tail(&run->node, &moeai_selftest_runs);
+    if (++moeai_selftest_nr_runs > MOEAI_SELFTEST_HISTORY) {
+        oldest = list_first_entry(&moeai_selftest_runs, struct moeai_selftest_run, node);
+        list_del_init(&oldest->node);
+        moeai_selftest_nr_runs--;
+    }
+    mutex_unlock(&moeai_selftest_lock);
+
+    moeai_selftest_run_put(oldest);
+}
+
+struct moeai_selftest_run *moeai_selftest_latest(struct moeai_selftest_run **prev)
+{
+    struct moeai_selftest_run *run = NULL, *before = NULL;
+
+    mutex_lock(&moeai_selftest_lock);
+    if (!list_empty(&moeai_selftest_runs)) {
+        run = list_last_entry(&moeai_selftest_runs, struct moeai_selftest_run, node);
+        moeai_selftest_run_get(run);
+        if (!list_is_first(&run->node, &moeai_selftest_runs)) {
+            before = list_prev_entry(run, node);
+            moeai_selftest_run_get(before);
+        }
+    }
+    mutex_unlock(&moeai_selftest_lock);
+
+    if (prev)
+        *prev = before;
+    else
+        moeai_selftest_run_put(before);
+    return run;
+}
+
+int moeai_selftest_history(struct moeai_selftest_run **runs, int max)
+{
+    struct moeai_selftest_run *run;
+    int n = 0;
+
+    mutex_lock(&moeai_selftest_lock);
+    list_for_each_entry(run, &moeai_selftest_runs, node) {
+        if (n == max)
+            break;
+        moeai_selftest_run_get(run);
+        runs[n++] = run;
+    }
+    mutex_unlock(&moeai_selftest_lock);
+
+    return n;
+}
+
+void moeai_selftest_clear_history(void)
+{
+    struct moeai_selftest_run *run, *tmp;
+    LIST_HEAD(dead);
+
+    mutex_lock(&moeai_selftest_lock);
+    list_splice_init(&moeai_selftest_runs, &dead);
+    moeai_selftest_nr_runs = 0;
+    mutex_unlock(&moeai_selftest_lock);
+
+    list_for_each_entry_safe(run, tmp, &dead, node) {
+        list_del_init(&run->node);
+        moeai_selftest_run_put(run);
+    }
+}
+
+void moeai_selftest_encode(struct seq_file *m, const struct moeai_selftest_run *run)
+{
+    struct moeai_selftest_bin_run hdr;
+    struct moeai_selftest_bin_record out;
+    const struct moeai_selftest_record *rec;
+    unsigned int i, j;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = cpu_to_le32(MOEAI_SELFTEST_MAGIC);
+    hdr.version = cpu_to_le16(MOEAI_SELFTEST_VERSION);
+    hdr.size = cpu_to_le16(sizeof(hdr));
+    hdr.record_size = cpu_to_le16(sizeof(out));
+    hdr.nr_tests = MOEAI_SELFTEST_NR_TESTS;
+    hdr.nr_records = cpu_to_le32(run->nr_records);
+    hdr.gen = cpu_to_le64(run->gen);
+    hdr.start_ns = cpu_to_le64(run->start_ns);
+    hdr.duration_ns = cpu_to_le64(run->duration_ns);
+    hdr.dropped = cpu_to_le32(run->dropped);
+    memcpy(hdr.status, run->status, sizeof(run->status));
+    memcpy(hdr.release, run->release, sizeof(hdr.release));
+    seq_write(m, &hdr, sizeof(hdr));
+
+    for (i = 0; i < run->nr_records; i++) {
+        rec = &run->records[i];
+        memset(&out, 0, sizeof(out));
+        out.test = rec->test;
+        out.type = rec->type;
+        out.arg = cpu_to_le16(rec->arg);
+        out.err = cpu_to_le32((u32)rec->err);
+        memcpy(out.name, rec->name, sizeof(out.name));
+        for (j = 0; j < MOEAI_SELFTEST_NR_VALUES; j++)
+            out.v[j] = cpu_to_le64(rec->v[j]);
+        seq_write(m, &out, sizeof(out));
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/data/snapshot.c
+ * 描述: 内存状态快照缓冲区
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/errno.h>
+#include <linux/vmalloc.h>
+#include <linux/uaccess.h>
+#include <asm/barrier.h>
+#include "../../include/data/snapshot.h"
+
+int moeai_snapshot_alloc(struct moeai_snapshot_buffer *buf, unsigned int capacity)
+{
+    if (capacity == 0 || capacity > MOEAI_SNAPSHOT_MAX_RECORDS)
+        return -EINVAL;
+
+    /* 突发采样期间不允许分配内存，因此一次性分配全部记录 */
+    buf->records = vzalloc(array_size(capacity, sizeof(*buf->records)));
+    if (!buf->records)
+        return -ENOMEM;
+
+    memset(&buf->header, 0, sizeof(buf->header));
+    buf->header.magic = MOEAI_SNAPSHOT_MAGIC;
+    buf->header.version = MOEAI_SNAPSHOT_VERSION;
+    buf->header.record_size = sizeof(struct moeai_snapshot_record);
+    buf->capacity = capacity;
+    buf->count = 0;
+    return 0;
+}
+
+void moeai_snapshot_free(struct moeai_snapshot_buffer *buf)
+{
+    vfree(buf->records);
+    buf->records = NULL;
+    buf->capacity = 0;
+    buf->count = 0;
+}
+
+struct moeai_snapshot_record *moeai_snapshot_next(struct moeai_snapshot_buffer *buf)
+{
+    if (!buf->records || buf->count >= buf->capacity)
+        return NULL;
+
+    return &buf->records[buf->count];
+}
+
+void moeai_snapshot_commit(struct moeai_snapshot_buffer *buf)
+{
+    /* 记录内容先于计数对读者可见 */
+    smp_store_release(&buf->count, buf->count + 1);
+}
+
+ssize_t moeai_snapshot_read(struct moeai_snapshot_buffer *buf, char __user *ubuf,
+                            size_t count, loff_t *ppos)
+{
+    struct moeai_snapshot_header header;
+    size_t total, pos, copied = 0, len;
+
+    if (*ppos < 0)
+        return -EINVAL;
+
+    /* 尚未采样时导出为空文件 */
+    if (!buf->records)
+        return 0;
+
+    /* 读取期间采样可能仍在进行，以读取开始时的记录数为准 */
+    header = buf->header;
+    header.count = smp_load_acquire(&buf->count);
+
+    total = sizeof(header) + (size_t)header.count * sizeof(*buf->records);
+    pos = *ppos;
+    if (pos >= total)
+        return 0;
+    count = min(count, total - pos);
+
+    if (pos < sizeof(header)) {
+        len = min(count, sizeof(header) - pos);
+        if (copy_to_user(ubuf, (char *)&header + pos, len))
+            return -EFAULT;
+        copied = len;
+        pos += len;
+    }
+
+    if (copied < count) {
+        len = count - copied;
+        if (copy_to_user(ubuf + copied, (char *)buf->records + (pos - sizeof(header)), len))
+            return -EFAULT;
+        copied += len;
+    }
+
+    *ppos += copied;
+    return copied;
+}
@@ -0,0 +1,182 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/data/stats.c
+ * 描述: /proc/moeai/stats.bin 的二进制统计编码
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/errno.h>
+#include <linux/slab.h>
+#include <linux/build_bug.h>
+#include <linux/timekeeping.h>
+#include <asm/byteorder.h>
+#include "../../include/data/stats.h"
+#include "../../include/modules/mem_monitor.h"
+#include "../../include/modules/stall_trace.h"
+
+/* 格式中的数组长度与内核枚举必须一致，否则需要增加格式版本 */
+static_assert(MOEAI_STATE_MAX == MOEAI_STATS_NR_STATES);
+static_assert(MOEAI_MEM_RECLAIM_MAX == MOEAI_STATS_NR_POLICIES);
+
+void moeai_stats_fill_mem(const struct moeai_mem_stats *stats,
+                          struct moeai_stats_mem *m, struct moeai_stats_rates *out)
+{
+    const struct moeai_mem_rates *r = &stats->rates;
+
+    m->sample_ns = cpu_to_le64(timespec64_to_ns(&stats->timestamp));
+    m->total_kb = cpu_to_le64(stats->total_ram);
+    m->free_kb = cpu_to_le64(stats->free_ram);
+    m->available_kb = cpu_to_le64(stats->available_ram);
+    m->cached_kb = cpu_to_le64(stats->cached_ram);
+    m->swap_total_kb = cpu_to_le64(stats->swap_total);
+    m->swap_free_kb = cpu_to_le64(stats->swap_free);
+    m->mem_usage_percent = cpu_to_le32(stats->mem_usage_percent);
+    m->swap_usage_percent = cpu_to_le32(stats->swap_usage_percent);
+
+    out->interval_ms = cpu_to_le32(r->interval_ms);
+    out->pgfault = cpu_to_le64(r->pgfault);
+    out->pgmajfault = cpu_to_le64(r->pgmajfault);
+    out->pgscan_kswapd = cpu_to_le64(r->pgscan_kswapd);
+    out->pgscan_direct = cpu_to_le64(r->pgscan_direct);
+    out->pgsteal_kswapd = cpu_to_le64(r->pgsteal_kswapd);
+    out->pgsteal_direct = cpu_to_le64(r->pgsteal_direct);
+    out->allocstall = cpu_to_le64(r->allocstall);
+    out->refault = cpu_to_le64(r->refault);
+    out->pswpin = cpu_to_le64(r->pswpin);
+    out->pswpout = cpu_to_le64(r->pswpout);
+    out->activate = cpu_to_le64(r->activate);
+    out->kswapd_run = cpu_to_le64(r->kswapd_run);
+    out->kswapd_quick = cpu_to_le64(r->kswapd_quick);
+}
+
+/* 编码内存统计和速率 */
+static int moeai_stats_encode_mem(struct moeai_stats_blob *blob)
+{
+    struct moeai_mem_stats stats;
+    int ret;
+
+    ret = moeai_mem_monitor_get_stats(&stats);
+    if (ret)
+        return ret;
+
+    moeai_stats_fill_mem(&stats, &blob->mem, &blob->rates);
+    return 0;
+}
+
+/* 编码内存监控配置 */
+static int moeai_stats_encode_config(struct moeai_stats_blob *blob)
+{
+    struct moeai_mem_monitor_config config;
+    struct moeai_stats_config *c = &blob->config;
+    int ret, i;
+
+    ret = moeai_mem_monitor_get_config(&config);
+    if (ret)
+        return ret;
+
+    c->check_interval_ms = cpu_to_le32(config.check_interval_ms);
+    c->warn_threshold = cpu_to_le32(config.warn_threshold);
+    c->critical_threshold = cpu_to_le32(config.critical_threshold);
+    c->emergency_threshold = cpu_to_le32(config.emergency_threshold);
+    c->warn_exit_threshold = cpu_to_le32(config.warn_exit_threshold);
+    c->critical_exit_threshold = cpu_to_le32(config.critical_exit_threshold);
+    c->emergency_exit_threshold = cpu_to_le32(config.emergency_exit_threshold);
+    c->min_dwell_ms = cpu_to_le32(config.min_dwell_ms);
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++)
+        c->reclaim_cooldown_ms[i] = cpu_to_le32(config.reclaim_cooldown_ms[i]);
+    c->node_warn_threshold = cpu_to_le32(config.node_warn_threshold);
+    c->node_critical_threshold = cpu_to_le32(config.node_critical_threshold);
+    c->node_reclaim_kb = cpu_to_le32(config.node_reclaim_kb);
+    c->forecast_horizon_ms = cpu_to_le32(config.forecast_horizon_ms);
+    c->thrash_activate_percent = cpu_to_le32(config.thrash_activate_percent);
+    c->stall_warn_us = cpu_to_le32(config.stall_warn_us);
+    c->stall_critical_us = cpu_to_le32(config.stall_critical_us);
+    c->direct_scan_rate_threshold = cpu_to_le64(config.direct_scan_rate_threshold);
+    c->allocstall_rate_threshold = cpu_to_le64(config.allocstall_rate_threshold);
+    c->refault_rate_threshold = cpu_to_le64(config.refault_rate_threshold);
+    c->thrash_swap_threshold = cpu_to_le64(config.thrash_swap_threshold);
+    c->thrash_refault_threshold = cpu_to_le64(config.thrash_refault_threshold);
+    c->min_reclaimable_kb = cpu_to_le64(config.min_reclaimable_kb);
+
+    if (config.auto_reclaim)
+        blob->header.flags |= cpu_to_le32(MOEAI_STATS_F_AUTO_RECLAIM);
+    if (config.wmark_trigger)
+        blob->header.flags |= cpu_to_le32(MOEAI_STATS_F_WMARK_TRIGGER);
+    return 0;
+}
+
+/* 编码状态机、预测和停顿的累计计数 */
+static int moeai_stats_encode_counters(struct moeai_stats_blob *blob)
+{
+    struct moeai_mem_state_info info;
+    struct moeai_mem_forecast_info fc;
+    struct moeai_stall_summary *stall;
+    struct moeai_stats_counters *c = &blob->counters;
+    int ret, i;
+
+    ret = moeai_mem_monitor_get_state(&info);
+    if (ret)
+        return ret;
+
+    blob->mem.state = cpu_to_le32(info.state);
+    blob->mem.state_ms = cpu_to_le32(info.state_ms);
+    c->transitions = cpu_to_le64(info.transitions);
+    for (i = 0; i < MOEAI_STATS_NR_STATES; i++)
+        c->state_entries[i] = cpu_to_le64(info.state_entries[i]);
+    for (i = 0; i < MOEAI_STATS_NR_POLICIES; i++) {
+        c->reclaim_runs[i] = cpu_to_le64(info.reclaim_runs[i]);
+        c->reclaim_suppressed[i] = cpu_to_le64(info.reclaim_suppressed[i]);
+    }
+    c->thrash_suppressed = cpu_to_le64(info.thrash_suppressed);
+    c->reclaim_futile = cpu_to_le64(info.reclaim_futile);
+    c->wmark_low_events = cpu_to_le64(info.wmark_low_events);
+
+    if (moeai_mem_monitor_get_forecast(&fc) == 0) {
+        c->forecast_predictions = cpu_to_le64(fc.predictions);
+        c->forecast_hits = cpu_to_le64(fc.hits);
+        c->forecast_false_alarms = cpu_to_le64(fc.false_alarms);
+        c->forecast_misses = cpu_to_le64(fc.misses);
+        c->forecast_triggers = cpu_to_le64(fc.triggers);
+    }
+
+    /* 停顿概况含直方图，不放在栈上 */
+    stall = kzalloc(sizeof(*stall), GFP_KERNEL);
+    if (!stall)
+        return -ENOMEM;
+    if (moeai_stall_get_summary(stall) == 0) {
+        if (stall->attached)
+            blob->header.flags |= cpu_to_le32(MOEAI_STATS_F_STALL_ATTACHED);
+        c->stall_count = cpu_to_le64(stall->total.count);
+        c->stall_total_us = cpu_to_le64(stall->total.total_us);
+        c->stall_max_us = cpu_to_le64(stall->total.max_us);
+        c->stall_untracked = cpu_to_le64(stall->untracked);
+    }
+    kfree(stall);
+    return 0;
+}
+
+int moeai_stats_encode(struct moeai_stats_blob *blob)
+{
+    int ret;
+
+    if (!blob)
+        return -EINVAL;
+
+    memset(blob, 0, sizeof(*blob));
+    blob->header.magic = cpu_to_le32(MOEAI_STATS_MAGIC);
+    blob->header.version = cpu_to_le16(MOEAI_STATS_VERSION);
+    blob->header.size = cpu_to_le16(sizeof(*blob));
+    blob->header.timestamp_ns = cpu_to_le64(ktime_get_real_ns());
+
+    ret = moeai_stats_encode_mem(blob);
+    if (ret)
+        return ret;
+    ret = moeai_stats_encode_config(blob);
+    if (ret)
+        return ret;
+    return moeai_stats_encode_counters(blob);
+}
@@ -0,0 +1,1178 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/ipc/control.c
+ * 描述: 控制命令分发: 命令注册表、带类型的参数解析与批量配置事务
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include <linux/stringhash.h>
+#include <linux/hashtable.h>
+#include <linux/mutex.h>
+#include <linux/nodemask.h>
+#include <linux/time64.h>
+#include <linux/build_bug.h>
+#include "../../include/ipc/control.h"
+#include "../../include/ipc/procfs_interface.h"
+#include "../../include/modules/mem_monitor.h"
+#include "../../include/modules/mem_frag.h"
+#include "../../include/modules/mem_policy.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/rss_tracker.h"
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/modules/mem_proactive.h"
+#include "../../include/core/event_loop.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "control"
+
+/* 单条命令的参数个数上限 */
+#define MOEAI_CTL_MAX_ARGS 4
+
+/* 命令名最多两个单词，其后是参数 */
+#define MOEAI_CTL_MAX_TOKENS (2 + MOEAI_CTL_MAX_ARGS)
+#define MOEAI_CTL_NAME_LEN   32
+
+/* 单条执行结果的长度上限 */
+#define MOEAI_CTL_MSG_LEN    192
+
+/* 命令注册表的哈希桶数 (2^6) */
+#define MOEAI_CTL_HASH_BITS  6
+
+/* 参数类型 */
+enum moeai_ctl_arg_type {
+    MOEAI_CTL_ARG_NONE = 0,         /* 参数列表结束 */
+    MOEAI_CTL_ARG_UINT,             /* 十进制 unsigned int */
+    MOEAI_CTL_ARG_ULONG,            /* 十进制 unsigned long */
+    MOEAI_CTL_ARG_BOOL,             /* on/off、1/0、yes/no、true/false */
+    MOEAI_CTL_ARG_DURATION,         /* 带 us/ms/s 单位的时长，无单位按毫秒，解析为微秒 */
+    MOEAI_CTL_ARG_KEY,              /* 命令 keys 列表中的一项，解析为下标 */
+    MOEAI_CTL_ARG_PATH,             /* 以 / 开头的 cgroup 路径 */
+    MOEAI_CTL_ARG_MASK,             /* 以逗号分隔的 keys 列表或 all，解析为位掩码 */
+};
+
+/* 解析后的参数 */
+union moeai_ctl_value {
+    unsigned int u;
+    unsigned long ul;
+    bool b;
+    u64 us;
+    int key;
+    const char *str;
+};
+
+/* 事务中的各模块配置，下标即提交顺序 */
+enum moeai_ctl_cfg {
+    MOEAI_CTL_CFG_MEM = 0,
+    MOEAI_CTL_CFG_FRAG,
+    MOEAI_CTL_CFG_POLICY,
+    MOEAI_CTL_CFG_MEMCG,
+    MOEAI_CTL_CFG_RSS,
+    MOEAI_CTL_CFG_WSS,
+    MOEAI_CTL_CFG_PROACTIVE,
+    MOEAI_CTL_CFG_MAX
+};
+
+struct moeai_ctl_configs {
+    struct moeai_mem_monitor_config mem;
+    struct moeai_frag_config frag;
+    struct moeai_mem_policy_config policy;
+    struct moeai_memcg_config memcg;
+    struct moeai_rss_config rss;
+    struct moeai_wss_config wss;
+    struct moeai_proactive_config proactive;
+};
+
+/* 配置事务: 第一次修改某模块时读出其配置，整批执行完后每个模块只提交一次 */
+struct moeai_ctl_txn {
+    unsigned long dirty;            /* 被修改的模块 */
+    unsigned long touched;          /* 当前命令修改的模块 */
+    struct moeai_ctl_configs old;   /* 事务开始前的配置，用于回滚 */
+    struct moeai_ctl_configs cur;   /* 修改后的配置 */
+    const void *owner;              /* 发出本批命令的控制文件 */
+};
+
+/* 命令处理函数，argv 按命令声明的参数类型解析 */
+typedef int (*moeai_ctl_handler_t)(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv);
+
+/* 注册的命令 */
+struct moeai_ctl_cmd {
+    const char *name;               /* 命令名，一到两个单词 */
+    const char *usage;              /* 参数格式，参数有误时返回给写者 */
+    enum moeai_ctl_arg_type args[MOEAI_CTL_MAX_ARGS];
+    const char * const *keys;       /* MOEAI_CTL_ARG_KEY 参数的可选值 */
+    unsigned int nr_keys;
+    unsigned int flags;             /* MOEAI_CTL_F_* */
+    moeai_ctl_handler_t handler;
+    struct hlist_node node;
+};
+
+/* 动作类命令: 不修改配置，在配置提交后按顺序执行 */
+#define MOEAI_CTL_F_ACTION 0x1
+
+#define MOEAI_CTL_KEYS(k) .keys = (k), .nr_keys = ARRAY_SIZE(k)
+
+/* 单条命令的执行状态 */
+enum moeai_ctl_status {
+    MOEAI_CTL_PENDING = 0,
+    MOEAI_CTL_OK,
+    MOEAI_CTL_UNKNOWN,              /* 无法识别的命令 */
+    MOEAI_CTL_USAGE,                /* 参数个数或格式有误 */
+    MOEAI_CTL_FAILED,               /* 执行或提交失败 */
+};
+
+/* 批中的一条命令 */
+struct moeai_ctl_line {
+    unsigned int lineno;            /* 在批中的行号，从1开始 */
+    const char *word;               /* 第一个单词，命令无法识别时回显 */
+    const struct moeai_ctl_cmd *cmd;
+    union moeai_ctl_value argv[MOEAI_CTL_MAX_ARGS];
+    unsigned long cfgs;             /* 修改的模块 */
+    enum moeai_ctl_status status;
+    int ret;
+};
+
+static DEFINE_HASHTABLE(moeai_ctl_table, MOEAI_CTL_HASH_BITS);
+
+/* 串行执行各批命令，避免两个事务交错读改写同一份配置 */
+static DEFINE_MUTEX(moeai_ctl_mutex);
+
+/* 读出模块配置并加入事务 */
+static int moeai_ctl_load(struct moeai_ctl_txn *txn, enum moeai_ctl_cfg cfg)
+{
+    struct moeai_ctl_configs *o = &txn->old;
+    int ret;
+
+    txn->touched |= BIT(cfg);
+    if (txn->dirty & BIT(cfg))
+        return 0;
+
+    switch (cfg) {
+    case MOEAI_CTL_CFG_MEM:
+        ret = moeai_mem_monitor_get_config(&o->mem);
+        txn->cur.mem = o->mem;
+        break;
+    case MOEAI_CTL_CFG_FRAG:
+        ret = moeai_mem_frag_get_config(&o->frag);
+        txn->cur.frag = o->frag;
+        break;
+    case MOEAI_CTL_CFG_POLICY:
+        ret = moeai_mem_policy_get_config(&o->policy);
+        txn->cur.policy = o->policy;
+        break;
+    case MOEAI_CTL_CFG_MEMCG:
+        ret = moeai_memcg_get_config(&o->memcg);
+        txn->cur.memcg = o->memcg;
+        break;
+    case MOEAI_CTL_CFG_RSS:
+        ret = moeai_rss_get_config(&o->rss);
+        txn->cur.rss = o->rss;
+        break;
+    case MOEAI_CTL_CFG_WSS:
+        ret = moeai_wss_get_config(&o->wss);
+        txn->cur.wss = o->wss;
+        break;
+    case MOEAI_CTL_CFG_PROACTIVE:
+        ret = moeai_proactive_get_config(&o->proactive);
+        txn->cur.proactive = o->proactive;
+        break;
+    default:
+        ret = -EINVAL;
+        break;
+    }
+    if (ret)
+        return ret;
+
+    txn->dirty |= BIT(cfg);
+    return 0;
+}
+
+/* 提交一个模块的配置 */
+static int moeai_ctl_apply(enum moeai_ctl_cfg cfg, const struct moeai_ctl_configs *c)
+{
+    switch (cfg) {
+    case MOEAI_CTL_CFG_MEM:
+        return moeai_mem_monitor_set_config(&c->mem);
+    case MOEAI_CTL_CFG_FRAG:
+        return moeai_mem_frag_set_config(&c->frag);
+    case MOEAI_CTL_CFG_POLICY:
+        return moeai_mem_policy_set_config(&c->policy);
+    case MOEAI_CTL_CFG_MEMCG:
+        return moeai_memcg_set_config(&c->memcg);
+    case MOEAI_CTL_CFG_RSS:
+        return moeai_rss_set_config(&c->rss);
+    case MOEAI_CTL_CFG_WSS:
+        return moeai_wss_set_config(&c->wss);
+    case MOEAI_CTL_CFG_PROACTIVE:
+        return moeai_proactive_set_config(&c->proactive);
+    default:
+        return -EINVAL;
+    }
+}
+
+/*
+ * 提交事务中被修改的模块
+ * 某个模块拒绝新配置时，已提交的模块恢复为事务开始前的配置
+ */
+static int moeai_ctl_commit(struct moeai_ctl_txn *txn, int *failed)
+{
+    int cfg, done, ret;
+
+    for (cfg = 0; cfg < MOEAI_CTL_CFG_MAX; cfg++) {
+        if (!(txn->dirty & BIT(cfg)))
+            continue;
+        ret = moeai_ctl_apply(cfg, &txn->cur);
+        if (ret) {
+            for (done = 0; done < cfg; done++) {
+                if (txn->dirty & BIT(done))
+                    moeai_ctl_apply(done, &txn->old);
+            }
+            *failed = cfg;
+            return ret;
+        }
+    }
+    return 0;
+}
+
+/* 事务中各模块配置的访问函数，模块未初始化时返回 NULL */
+#define MOEAI_CTL_CONFIG_ACCESSOR(fn, cfg, type, field)                 \
+static type *fn(struct moeai_ctl_txn *txn)                              \
+{                                                                       \
+    return moeai_ctl_load(txn, cfg) ? NULL : &txn->cur.field;           \
+}
+
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_mem, MOEAI_CTL_CFG_MEM,
+                          struct moeai_mem_monitor_config, mem)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_frag, MOEAI_CTL_CFG_FRAG,
+                          struct moeai_frag_config, frag)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_policy, MOEAI_CTL_CFG_POLICY,
+                          struct moeai_mem_policy_config, policy)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_memcg, MOEAI_CTL_CFG_MEMCG,
+                          struct moeai_memcg_config, memcg)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_rss, MOEAI_CTL_CFG_RSS,
+                          struct moeai_rss_config, rss)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_wss, MOEAI_CTL_CFG_WSS,
+                          struct moeai_wss_config, wss)
+MOEAI_CTL_CONFIG_ACCESSOR(moeai_ctl_proactive, MOEAI_CTL_CFG_PROACTIVE,
+                          struct moeai_proactive_config, proactive)
+
+/* ---------------- 配置类命令 ---------------- */
+
+static const char * const moeai_ctl_policy_keys[] = { "gentle", "moderate", "aggressive" };
+static const char * const moeai_ctl_stall_keys[] = { "warn", "critical" };
+static const char * const moeai_ctl_thrash_keys[] = { "swap", "refault", "activate" };
+static const char * const moeai_ctl_frag_keys[] = { "order", "percent", "index", "cooldown", "zones" };
+static const char * const moeai_ctl_rate_keys[] = { "direct_scan", "allocstall", "refault" };
+static const char * const moeai_ctl_mpolicy_keys[] = { "adaptive", "target", "explore" };
+static const char * const moeai_ctl_memcg_keys[] = {
+    "interval", "batch", "top", "warn", "critical", "psi", "max"
+};
+static const char * const moeai_ctl_rss_keys[] = { "interval", "batch", "top", "max" };
+static const char * const moeai_ctl_wss_keys[] = { "interval", "batch", "age" };
+static const char * const moeai_ctl_proactive_keys[] = { "interval", "step", "cost" };
+/* 下标即事件类型 */
+static const char * const moeai_ctl_event_keys[] = { "state", "reclaim", "node_reclaim", "log" };
+
+static_assert(ARRAY_SIZE(moeai_ctl_event_keys) == MOEAI_HUB_EVENT_MAX);
+
+/* set threshold <percent>: 临界和紧急阈值依次高10%，保持各等级原有的进入/退出差值 */
+static int moeai_ctl_set_threshold(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+    unsigned int threshold = argv[0].u;
+
+    if (!c)
+        return -ENODEV;
+
+    c->warn_exit_threshold = threshold -
+        min(threshold, c->warn_threshold - c->warn_exit_threshold);
+    c->critical_exit_threshold = threshold + 10 -
+        min(threshold + 10, c->critical_threshold - c->critical_exit_threshold);
+    c->emergency_exit_threshold = threshold + 20 -
+        min(threshold + 20, c->emergency_threshold - c->emergency_exit_threshold);
+    c->warn_threshold = threshold;
+    c->critical_threshold = threshold + 10;
+    c->emergency_threshold = threshold + 20;
+    return 0;
+}
+
+static int moeai_ctl_set_interval(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->check_interval_ms = argv[0].u;
+    return 0;
+}
+
+/* set hysteresis <percent>: 各等级的退出阈值比进入阈值低此值 */
+static int moeai_ctl_set_hysteresis(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+    unsigned int hysteresis = argv[0].u;
+
+    if (!c)
+        return -ENODEV;
+
+    c->warn_exit_threshold = c->warn_threshold - min(hysteresis, c->warn_threshold);
+    c->critical_exit_threshold = c->critical_threshold - min(hysteresis, c->critical_threshold);
+    c->emergency_exit_threshold = c->emergency_threshold - min(hysteresis, c->emergency_threshold);
+    return 0;
+}
+
+static int moeai_ctl_set_dwell(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->min_dwell_ms = argv[0].u;
+    return 0;
+}
+
+static int moeai_ctl_set_cooldown(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    /* keys 的顺序与 enum moeai_mem_reclaim_policy 一致 */
+    c->reclaim_cooldown_ms[argv[0].key] = argv[1].u;
+    return 0;
+}
+
+static int moeai_ctl_set_node_threshold(struct moeai_ctl_txn *txn,
+                                        const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->node_warn_threshold = argv[0].u;
+    c->node_critical_threshold = argv[1].u;
+    return 0;
+}
+
+static int moeai_ctl_set_horizon(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->forecast_horizon_ms = argv[0].u;
+    return 0;
+}
+
+static int moeai_ctl_set_min_reclaim(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->min_reclaimable_kb = argv[0].ul;
+    return 0;
+}
+
+static int moeai_ctl_set_stall(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    if (argv[0].key == 0)
+        c->stall_warn_us = argv[1].u;
+    else
+        c->stall_critical_us = argv[1].u;
+    return 0;
+}
+
+static int moeai_ctl_set_wmark(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->wmark_trigger = argv[0].b;
+    return 0;
+}
+
+static int moeai_ctl_set_thrash(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* swap */
+        c->thrash_swap_threshold = argv[1].ul;
+        break;
+    case 1: /* refault */
+        c->thrash_refault_threshold = argv[1].ul;
+        break;
+    default: /* activate */
+        if (argv[1].ul > 100)
+            return -ERANGE;
+        c->thrash_activate_percent = argv[1].ul;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_rate(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* direct_scan */
+        c->direct_scan_rate_threshold = argv[1].ul;
+        break;
+    case 1: /* allocstall */
+        c->allocstall_rate_threshold = argv[1].ul;
+        break;
+    default: /* refault */
+        c->refault_rate_threshold = argv[1].ul;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_autoreclaim(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config *c = moeai_ctl_mem(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->auto_reclaim = argv[0].b;
+    return 0;
+}
+
+static int moeai_ctl_set_frag(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_frag_config *c = moeai_ctl_frag(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* order */
+        c->order = value;
+        break;
+    case 1: /* percent */
+        c->min_high_order_percent = value;
+        break;
+    case 2: /* index */
+        c->index_threshold = value;
+        break;
+    case 3: /* cooldown */
+        c->compact_cooldown_ms = value;
+        break;
+    default: /* zones */
+        c->max_zones_per_run = value;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_policy(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_policy_config *c = moeai_ctl_policy(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* adaptive */
+        c->adaptive = value != 0;
+        break;
+    case 1: /* target */
+        c->target_percent = value;
+        break;
+    default: /* explore */
+        c->explore_interval = value;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_memcg(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_memcg_config *c = moeai_ctl_memcg(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* interval */
+        c->scan_interval_ms = value;
+        break;
+    case 1: /* batch */
+        c->scan_batch = value;
+        break;
+    case 2: /* top */
+        c->top_n = value;
+        break;
+    case 3: /* warn */
+        c->warn_percent = value;
+        break;
+    case 4: /* critical */
+        c->critical_percent = value;
+        break;
+    case 5: /* psi */
+        c->psi_threshold_centi = value;
+        break;
+    default: /* max */
+        c->max_cgroups = value;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_rss(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_rss_config *c = moeai_ctl_rss(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* interval */
+        c->scan_interval_ms = value;
+        break;
+    case 1: /* batch */
+        c->scan_batch = value;
+        break;
+    case 2: /* top */
+        c->top_k = value;
+        break;
+    default: /* max */
+        c->max_tasks = value;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_wss(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_wss_config *c = moeai_ctl_wss(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* interval */
+        c->scan_interval_ms = value;
+        break;
+    case 1: /* batch */
+        c->scan_batch = value;
+        break;
+    default: /* age */
+        c->cold_age_ms = value;
+        break;
+    }
+    return 0;
+}
+
+static int moeai_ctl_set_proactive(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_proactive_config *c = moeai_ctl_proactive(txn);
+
+    if (!c)
+        return -ENODEV;
+    c->enabled = argv[0].b;
+    return 0;
+}
+
+static int moeai_ctl_set_proactive_param(struct moeai_ctl_txn *txn,
+                                         const union moeai_ctl_value *argv)
+{
+    struct moeai_proactive_config *c = moeai_ctl_proactive(txn);
+    unsigned int value = argv[1].u;
+
+    if (!c)
+        return -ENODEV;
+
+    switch (argv[0].key) {
+    case 0: /* interval */
+        c->interval_ms = value;
+        break;
+    case 1: /* step */
+        c->step_kb = value;
+        break;
+    default: /* cost */
+        c->max_cost_permille = value;
+        break;
+    }
+    return 0;
+}
+
+/* ---------------- 动作类命令 ---------------- */
+
+static int moeai_ctl_reclaim(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    long reclaimed = moeai_mem_reclaim(MOEAI_MEM_RECLAIM_MODERATE);
+
+    if (reclaimed < 0)
+        return reclaimed;
+    MOEAI_INFO(MODULE_NAME, "%s %ld KB", lang_get(LANG_CLI_MSG_RECLAIM_COMPLETE), reclaimed);
+    return 0;
+}
+
+/* reclaim node <nid>: 在指定 NUMA 节点上执行定向回收 */
+static int moeai_ctl_reclaim_node(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    struct moeai_mem_monitor_config config;
+    long reclaimed;
+    int ret;
+
+    if (argv[0].u >= MAX_NUMNODES)
+        return -EINVAL;
+
+    ret = moeai_mem_monitor_get_config(&config);
+    if (ret)
+        return ret;
+
+    reclaimed = moeai_mem_reclaim_node(argv[0].u, config.node_reclaim_kb);
+    if (reclaimed < 0)
+        return reclaimed;
+    MOEAI_INFO(MODULE_NAME, "%s %ld KB", lang_get(LANG_CLI_MSG_RECLAIM_COMPLETE), reclaimed);
+    return 0;
+}
+
+static int moeai_ctl_compact(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    int ret = moeai_mem_frag_compact(-1);
+
+    MOEAI_INFO(MODULE_NAME, "%s %d", lang_get(LANG_CLI_MSG_COMPACT_COMPLETE), ret);
+    return ret < 0 ? ret : 0;
+}
+
+static int moeai_ctl_compact_node(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    int ret = moeai_mem_frag_compact(argv[0].u);
+
+    MOEAI_INFO(MODULE_NAME, "%s %d", lang_get(LANG_CLI_MSG_COMPACT_COMPLETE), ret);
+    return ret < 0 ? ret : 0;
+}
+
+/* sample burst <间隔> <时长>，如 "sample burst 1ms 10s" */
+static int moeai_ctl_sample_burst(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    u64 interval_us = argv[0].us, duration_ms = div_u64(argv[1].us, USEC_PER_MSEC);
+    int ret;
+
+    if (interval_us > UINT_MAX || duration_ms > UINT_MAX)
+        return -ERANGE;
+
+    ret = moeai_mem_burst_start(interval_us, duration_ms);
+    if (ret)
+        MOEAI_WARN(MODULE_NAME, "%s %d", lang_get(LANG_MEM_BURST_FAILED), ret);
+    return ret;
+}
+
+static int moeai_ctl_sample_stop(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    moeai_mem_burst_stop();
+    return 0;
+}
+
+static int moeai_ctl_selftest(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    u64 gen;
+    int ret = moeai_trigger_selftest(&gen);
+
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_PROCFS_SELFTEST_QUEUED), gen);
+    return ret;
+}
+
+static int moeai_ctl_set_wss_target(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    int ret = moeai_wss_set_target(argv[0].str, argv[1].b);
+
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_CLI_MSG_SET_WSS_TARGET), argv[0].str,
+                   argv[1].b ? "on" : "off");
+    return ret;
+}
+
+static int moeai_ctl_set_proactive_target(struct moeai_ctl_txn *txn,
+                                          const union moeai_ctl_value *argv)
+{
+    int ret = moeai_proactive_set_target(argv[0].str, argv[1].b);
+
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_CLI_MSG_SET_PROACTIVE_TARGET), argv[0].str,
+                   argv[1].b ? "on" : "off");
+    return ret;
+}
+
+static int moeai_ctl_set_memcg_threshold(struct moeai_ctl_txn *txn,
+                                         const union moeai_ctl_value *argv)
+{
+    int ret = moeai_memcg_set_threshold(argv[0].str, argv[1].u, argv[2].u);
+
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_CLI_MSG_SET_MEMCG_THRESHOLD),
+                   argv[0].str, argv[1].u, argv[2].u);
+    return ret;
+}
+
+/* notify add <fd> <事件>: 登记当前进程的 eventfd，事件发生时计数加一 */
+static int moeai_ctl_notify_add(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    int ret;
+
+    if (argv[0].u > INT_MAX)
+        return -EBADF;
+
+    ret = moeai_event_hub_notify_add(txn->owner, argv[0].u, argv[1].u);
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_CLI_MSG_NOTIFY_ADD), argv[0].u, argv[1].u);
+    return ret;
+}
+
+static int moeai_ctl_notify_del(struct moeai_ctl_txn *txn, const union moeai_ctl_value *argv)
+{
+    int ret;
+
+    if (argv[0].u > INT_MAX)
+        return -EBADF;
+
+    ret = moeai_event_hub_notify_del(txn->owner, argv[0].u);
+    if (ret == 0)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_CLI_MSG_NOTIFY_DEL), argv[0].u);
+    return ret;
+}
+
+/* 内置命令表 */
+static struct moeai_ctl_cmd moeai_ctl_builtin[] = {
+    { .name = "reclaim", .usage = "reclaim",
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_reclaim },
+    { .name = "reclaim node", .usage = "reclaim node <nid>",
+      .args = { MOEAI_CTL_ARG_UINT },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_reclaim_node },
+    { .name = "compact", .usage = "compact",
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_compact },
+    { .name = "compact node", .usage = "compact node <nid>",
+      .args = { MOEAI_CTL_ARG_UINT },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_compact_node },
+    { .name = "sample burst", .usage = "sample burst <interval> <duration>",
+      .args = { MOEAI_CTL_ARG_DURATION, MOEAI_CTL_ARG_DURATION },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_sample_burst },
+    { .name = "sample stop", .usage = "sample stop",
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_sample_stop },
+    { .name = "selftest", .usage = "selftest",
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_selftest },
+    { .name = "notify add", .usage = "notify add <eventfd> <state,reclaim,node_reclaim,log|all>",
+      .args = { MOEAI_CTL_ARG_UINT, MOEAI_CTL_ARG_MASK }, MOEAI_CTL_KEYS(moeai_ctl_event_keys),
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_notify_add },
+    { .name = "notify del", .usage = "notify del <eventfd>",
+      .args = { MOEAI_CTL_ARG_UINT },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_notify_del },
+    { .name = "set threshold", .usage = "set threshold <percent>",
+      .args = { MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_threshold },
+    { .name = "set interval", .usage = "set interval <ms>",
+      .args = { MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_interval },
+    { .name = "set hysteresis", .usage = "set hysteresis <percent>",
+      .args = { MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_hysteresis },
+    { .name = "set dwell", .usage = "set dwell <ms>",
+      .args = { MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_dwell },
+    { .name = "set cooldown", .usage = "set cooldown <gentle|moderate|aggressive> <ms>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_policy_keys),
+      .handler = moeai_ctl_set_cooldown },
+    { .name = "set node_threshold", .usage = "set node_threshold <warn> <critical>",
+      .args = { MOEAI_CTL_ARG_UINT, MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_node_threshold },
+    { .name = "set horizon", .usage = "set horizon <ms>",
+      .args = { MOEAI_CTL_ARG_UINT }, .handler = moeai_ctl_set_horizon },
+    { .name = "set minreclaim", .usage = "set minreclaim <kb>",
+      .args = { MOEAI_CTL_ARG_ULONG }, .handler = moeai_ctl_set_min_reclaim },
+    { .name = "set stall", .usage = "set stall <warn|critical> <us>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_stall_keys),
+      .handler = moeai_ctl_set_stall },
+    { .name = "set wmark", .usage = "set wmark <on|off>",
+      .args = { MOEAI_CTL_ARG_BOOL }, .handler = moeai_ctl_set_wmark },
+    { .name = "set thrash", .usage = "set thrash <swap|refault|activate> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_ULONG }, MOEAI_CTL_KEYS(moeai_ctl_thrash_keys),
+      .handler = moeai_ctl_set_thrash },
+    { .name = "set rate", .usage = "set rate <direct_scan|allocstall|refault> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_ULONG }, MOEAI_CTL_KEYS(moeai_ctl_rate_keys),
+      .handler = moeai_ctl_set_rate },
+    { .name = "set autoreclaim", .usage = "set autoreclaim <on|off>",
+      .args = { MOEAI_CTL_ARG_BOOL }, .handler = moeai_ctl_set_autoreclaim },
+    { .name = "set frag", .usage = "set frag <order|percent|index|cooldown|zones> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_frag_keys),
+      .handler = moeai_ctl_set_frag },
+    { .name = "set policy", .usage = "set policy <adaptive|target|explore> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_mpolicy_keys),
+      .handler = moeai_ctl_set_policy },
+    { .name = "set memcg",
+      .usage = "set memcg <interval|batch|top|warn|critical|psi|max> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_memcg_keys),
+      .handler = moeai_ctl_set_memcg },
+    { .name = "set rss", .usage = "set rss <interval|batch|top|max> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_rss_keys),
+      .handler = moeai_ctl_set_rss },
+    { .name = "set wss", .usage = "set wss <interval|batch|age> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_wss_keys),
+      .handler = moeai_ctl_set_wss },
+    { .name = "set proactive", .usage = "set proactive <on|off>",
+      .args = { MOEAI_CTL_ARG_BOOL }, .handler = moeai_ctl_set_proactive },
+    { .name = "set proactiveparam", .usage = "set proactiveparam <interval|step|cost> <value>",
+      .args = { MOEAI_CTL_ARG_KEY, MOEAI_CTL_ARG_UINT }, MOEAI_CTL_KEYS(moeai_ctl_proactive_keys),
+      .handler = moeai_ctl_set_proactive_param },
+    { .name = "set wsstarget", .usage = "set wsstarget <path> <on|off>",
+      .args = { MOEAI_CTL_ARG_PATH, MOEAI_CTL_ARG_BOOL },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_set_wss_target },
+    { .name = "set proactivetarget", .usage = "set proactivetarget <path> <on|off>",
+      .args = { MOEAI_CTL_ARG_PATH, MOEAI_CTL_ARG_BOOL },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_set_proactive_target },
+    { .name = "set memcgthreshold", .usage = "set memcgthreshold <path> <warn> <critical>",
+      .args = { MOEAI_CTL_ARG_PATH, MOEAI_CTL_ARG_UINT, MOEAI_CTL_ARG_UINT },
+      .flags = MOEAI_CTL_F_ACTION, .handler = moeai_ctl_set_memcg_threshold },
+};
+
+/* ---------------- 解析与执行 ---------------- */
+
+static u32 moeai_ctl_hash(const char *name)
+{
+    return full_name_hash(NULL, name, strlen(name));
+}
+
+static const struct moeai_ctl_cmd *moeai_ctl_find(const char *name)
+{
+    struct moeai_ctl_cmd *cmd;
+    u32 key = moeai_ctl_hash(name);
+
+    hash_for_each_possible(moeai_ctl_table, cmd, node, key) {
+        if (strcmp(cmd->name, name) == 0)
+            return cmd;
+    }
+    return NULL;
+}
+
+/**
+ * 解析带单位的时长，支持 us、ms、s，无单位时按毫秒处理
+ * @str: 输入字符串
+ * @us: 输出时长 (微秒)
+ * 返回值: 0表示成功，负值表示错误
+ */
+static int moeai_ctl_parse_duration_us(const char *str, u64 *us)
+{
+    unsigned long long value;
+    char *end;
+
+    value = simple_strtoull(str, &end, 10);
+    if (end == str)
+        return -EINVAL;
+    if (value > UINT_MAX)
+        return -ERANGE;
+
+    if (strcmp(end, "us") == 0)
+        *us = value;
+    else if (strcmp(end, "ms") == 0 || *end == '\0')
+        *us = value * USEC_PER_MSEC;
+    else if (strcmp(end, "s") == 0)
+        *us = value * USEC_PER_SEC;
+    else
+        return -EINVAL;
+
+    return 0;
+}
+
+/* 解析以逗号分隔的 keys 列表，"all" 表示全部 */
+static int moeai_ctl_parse_mask(const struct moeai_ctl_cmd *cmd, const char *str,
+                                unsigned int *mask)
+{
+    const char *end;
+    unsigned int i;
+    size_t len;
+
+    if (strcmp(str, "all") == 0) {
+        *mask = BIT(cmd->nr_keys) - 1;
+        return 0;
+    }
+
+    *mask = 0;
+    for (;;) {
+        end = strchrnul(str, ',');
+        len = end - str;
+        for (i = 0; i < cmd->nr_keys; i++) {
+            if (strlen(cmd->keys[i]) == len && strncmp(cmd->keys[i], str, len) == 0)
+                break;
+        }
+        if (i == cmd->nr_keys)
+            return -EINVAL;
+        *mask |= BIT(i);
+        if (!*end)
+            return 0;
+        str = end + 1;
+    }
+}
+
+/* 按类型解析一个参数 */
+static int moeai_ctl_parse_arg(const struct moeai_ctl_cmd *cmd, enum moeai_ctl_arg_type type,
+                               const char *tok, union moeai_ctl_value *v)
+{
+    switch (type) {
+    case MOEAI_CTL_ARG_UINT:
+        return kstrtouint(tok, 10, &v->u);
+    case MOEAI_CTL_ARG_ULONG:
+        return kstrtoul(tok, 10, &v->ul);
+    case MOEAI_CTL_ARG_BOOL:
+        return kstrtobool(tok, &v->b);
+    case MOEAI_CTL_ARG_DURATION:
+        return moeai_ctl_parse_duration_us(tok, &v->us);
+    case MOEAI_CTL_ARG_KEY:
+        v->key = match_string(cmd->keys, cmd->nr_keys, tok);
+        return v->key < 0 ? -EINVAL : 0;
+    case MOEAI_CTL_ARG_PATH:
+        if (tok[0] != '/')
+            return -EINVAL;
+        if (strlen(tok) >= MOEAI_MEMCG_PATH_LEN)
+            return -ENAMETOOLONG;
+        v->str = tok;
+        return 0;
+    case MOEAI_CTL_ARG_MASK:
+        return moeai_ctl_parse_mask(cmd, tok, &v->u);
+    default:
+        return -EINVAL;
+    }
+}
+
+/* 以空白分隔单词，返回单词总数，只保存前 max 个 */
+static int moeai_ctl_split(char *text, char **tok, int max)
+{
+    char *t;
+    int n = 0;
+
+    while ((t = strsep(&text, " \t")) != NULL) {
+        if (!*t)
+            continue;
+        if (n < max)
+            tok[n] = t;
+        n++;
+    }
+    return n;
+}
+
+/* 查找命令并解析参数 */
+static int moeai_ctl_parse(char *text, struct moeai_ctl_line *l)
+{
+    char *tok[MOEAI_CTL_MAX_TOKENS];
+    char name[MOEAI_CTL_NAME_LEN];
+    int ntok, first, nargs, i, ret;
+
+    ntok = moeai_ctl_split(text, tok, ARRAY_SIZE(tok));
+    l->word = tok[0];
+
+    /* 先按两个单词查找，如 "set stall"、"reclaim node"，再按一个单词查找 */
+    l->cmd = NULL;
+    if (ntok >= 2 && snprintf(name, sizeof(name), "%s %s", tok[0], tok[1]) < sizeof(name)) {
+        l->cmd = moeai_ctl_find(name);
+        first = 2;
+    }
+    if (!l->cmd) {
+        l->cmd = moeai_ctl_find(tok[0]);
+        first = 1;
+    }
+    if (!l->cmd) {
+        l->status = MOEAI_CTL_UNKNOWN;
+        return l->ret = -EINVAL;
+    }
+
+    for (nargs = 0; nargs < MOEAI_CTL_MAX_ARGS && l->cmd->args[nargs]; nargs++)
+        ;
+    if (ntok - first != nargs) {
+        l->status = MOEAI_CTL_USAGE;
+        return l->ret = -EINVAL;
+    }
+
+    for (i = 0; i < nargs; i++) {
+        ret = moeai_ctl_parse_arg(l->cmd, l->cmd->args[i], tok[first + i], &l->argv[i]);
+        if (ret) {
+            l->status = MOEAI_CTL_USAGE;
+            return l->ret = ret;
+        }
+    }
+    return 0;
+}
+
+/* 将一条命令的执行结果追加到结果缓冲区，失败的命令同时记录到日志 */
+static size_t moeai_ctl_report(const struct moeai_ctl_line *l, char *result,
+                               size_t size, size_t len)
+{
+    char msg[MOEAI_CTL_MSG_LEN];
+
+    switch (l->status) {
+    case MOEAI_CTL_OK:
+        scnprintf(msg, sizeof(msg), lang_get(LANG_PROCFS_CTL_OK), l->lineno, l->cmd->name);
+        break;
+    case MOEAI_CTL_UNKNOWN:
+        scnprintf(msg, sizeof(msg), lang_get(LANG_PROCFS_CTL_UNKNOWN), l->lineno, l->word);
+        break;
+    case MOEAI_CTL_USAGE:
+        scnprintf(msg, sizeof(msg), lang_get(LANG_PROCFS_CTL_USAGE), l->lineno,
+                  l->cmd->name, l->ret, l->cmd->usage);
+        break;
+    case MOEAI_CTL_FAILED:
+        scnprintf(msg, sizeof(msg), lang_get(LANG_PROCFS_CTL_FAILED), l->lineno,
+                  l->cmd->name, l->ret);
+        break;
+    default:
+        /* 同批其他命令出错，本条未执行 */
+        scnprintf(msg, sizeof(msg), lang_get(LANG_PROCFS_CTL_SKIPPED), l->lineno, l->cmd->name);
+        break;
+    }
+
+    if (l->status != MOEAI_CTL_OK && l->status != MOEAI_CTL_PENDING)
+        MOEAI_WARN(MODULE_NAME, "%s", msg);
+    return len + scnprintf(result + len, size - len, "%s\n", msg);
+}
+
+int moeai_control_run(char *batch, char *result, size_t size, const void *owner)
+{
+    struct moeai_ctl_txn *txn;
+    struct moeai_ctl_line *lines, *l;
+    unsigned int nr_lines = 1, n = 0, lineno, nr_config = 0, i;
+    bool rejected = false;
+    size_t len = 0;
+    char *text;
+    int ret = 0, err, failed;
+
+    if (!batch || !result || !size)
+        return -EINVAL;
+    result[0] = '\0';
+
+    for (text = batch; *text; text++) {
+        if (*text == '\n')
+            nr_lines++;
+    }
+
+    lines = kcalloc(nr_lines, sizeof(*lines), GFP_KERNEL);
+    txn = kzalloc(sizeof(*txn), GFP_KERNEL);
+    if (!lines || !txn) {
+        ret = -ENOMEM;
+        goto out_free;
+    }
+
+    txn->owner = owner;
+    mutex_lock(&moeai_ctl_mutex);
+
+    /* 第一步: 解析全部命令，任一条出错则整批不执行 */
+    for (lineno = 1; (text = strsep(&batch, "\n")) != NULL; lineno++) {
+        text = strim(text);
+        if (!*text || *text == '#')
+            continue;
+        l = &lines[n++];
+        l->lineno = lineno;
+        err = moeai_ctl_parse(text, l);
+        if (err && !ret)
+            ret = err;
+    }
+    rejected = ret != 0;
+
+    /* 第二步: 配置类命令依次修改事务中的配置副本 */
+    for (i = 0; !rejected && i < n; i++) {
+        l = &lines[i];
+        if (l->cmd->flags & MOEAI_CTL_F_ACTION)
+            continue;
+        txn->touched = 0;
+        err = l->cmd->handler(txn, l->argv);
+        l->cfgs = txn->touched;
+        if (err) {
+            l->status = MOEAI_CTL_FAILED;
+            l->ret = ret = err;
+            rejected = true;
+        }
+        nr_config++;
+    }
+
+    /* 第三步: 每个模块提交一次配置 */
+    if (!rejected) {
+        err = moeai_ctl_commit(txn, &failed);
+        if (err) {
+            for (i = 0; i < n; i++) {
+                if (lines[i].cfgs & BIT(failed)) {
+                    lines[i].status = MOEAI_CTL_FAILED;
+                    lines[i].ret = err;
+                }
+            }
+            ret = err;
+            rejected = true;
+        } else if (nr_config) {
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_PROCFS_CTL_APPLIED), nr_config);
+        }
+    }
+
+    /* 第四步: 配置生效后依次执行动作类命令 */
+    for (i = 0; !rejected && i < n; i++) {
+        l = &lines[i];
+        if (l->cmd->flags & MOEAI_CTL_F_ACTION) {
+            err = l->cmd->handler(txn, l->argv);
+            if (err) {
+                l->status = MOEAI_CTL_FAILED;
+                l->ret = err;
+                if (!ret)
+                    ret = err;
+                continue;
+            }
+        }
+        l->status = MOEAI_CTL_OK;
+    }
+
+    for (i = 0; i < n; i++)
+        len = moeai_ctl_report(&lines[i], result, size, len);
+
+    mutex_unlock(&moeai_ctl_mutex);
+
+out_free:
+    kfree(txn);
+    kfree(lines);
+    return ret;
+}
+
+int moeai_control_init(void)
+{
+    int i;
+
+    for (i = 0; i < ARRAY_SIZE(moeai_ctl_builtin); i++) {
+        struct moeai_ctl_cmd *cmd = &moeai_ctl_builtin[i];
+
+        if (moeai_ctl_find(cmd->name)) {
+            MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_CTL_DUPLICATE), cmd->name);
+            moeai_control_exit();
+            return -EEXIST;
+        }
+        hash_add(moeai_ctl_table, &cmd->node, moeai_ctl_hash(cmd->name));
+    }
+    return 0;
+}
+
+void moeai_control_exit(void)
+{
+    int i;
+
+    mutex_lock(&moeai_ctl_mutex);
+    for (i = 0; i < ARRAY_SIZE(moeai_ctl_builtin); i++) {
+        if (hash_hashed(&moeai_ctl_builtin[i].node))
+            hash_del(&moeai_ctl_builtin[i].node);
+    }
+    mutex_unlock(&moeai_ctl_mutex);
+}
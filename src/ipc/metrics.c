@@ -0,0 +1,675 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/ipc/metrics.c
+ * 描述: /proc/moeai/metrics 的 Prometheus 文本格式导出
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/slab.h>
+#include <linux/seq_file.h>
+#include <linux/proc_fs.h>
+#include <linux/math64.h>
+#include <linux/time64.h>
+#include "../../include/ipc/metrics.h"
+#include "../../include/modules/mem_monitor.h"
+#include "../../include/modules/mem_frag.h"
+#include "../../include/modules/mem_policy.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/stall_trace.h"
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/modules/mem_proactive.h"
+#include "../../include/utils/logger.h"
+
+/* 标签的最大长度，cgroup 路径转义后最多增长一倍 */
+#define MOEAI_METRICS_LABEL_LEN (MOEAI_MEMCG_PATH_LEN * 2 + 64)
+
+/* 指标族的 HELP 和 TYPE 行 */
+static void metric_family(struct seq_file *m, const char *name, const char *type,
+                          const char *help)
+{
+    seq_printf(m, "# HELP moeai_%s %s\n# TYPE moeai_%s %s\n", name, help, name, type);
+}
+
+/*
+ * 一个样本，value 按 frac 位小数输出 (如毫秒值以 frac=3 输出为秒)
+ * labels 为已格式化的标签，可为 NULL
+ */
+static void metric_value(struct seq_file *m, const char *name, const char *labels,
+                         u64 value, unsigned int frac)
+{
+    static const u32 scale[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    u32 rem;
+
+    if (labels)
+        seq_printf(m, "moeai_%s{%s} ", name, labels);
+    else
+        seq_printf(m, "moeai_%s ", name);
+
+    if (frac == 0 || frac >= ARRAY_SIZE(scale)) {
+        seq_printf(m, "%llu\n", value);
+        return;
+    }
+    rem = do_div(value, scale[frac]);
+    seq_printf(m, "%llu.%0*u\n", value, (int)frac, rem);
+}
+
+/* 只有一个样本的指标族 */
+static void metric_single(struct seq_file *m, const char *name, const char *type,
+                          const char *help, u64 value, unsigned int frac)
+{
+    metric_family(m, name, type, help);
+    metric_value(m, name, NULL, value, frac);
+}
+
+/* 按 Prometheus 文本格式转义标签值 */
+static const char *metric_escape(char *dst, size_t size, const char *src)
+{
+    size_t n = 0;
+
+    for (; *src && n + 2 < size; src++) {
+        switch (*src) {
+        case '\\':
+        case '"':
+            dst[n++] = '\\';
+            dst[n++] = *src;
+            break;
+        case '\n':
+            dst[n++] = '\\';
+            dst[n++] = 'n';
+            break;
+        default:
+            dst[n++] = *src;
+            break;
+        }
+    }
+    dst[n] = '\0';
+    return dst;
+}
+
+/* 内存统计和活动速率 */
+static void metrics_memory(struct seq_file *m)
+{
+    static const struct {
+        const char *event;
+        size_t offset;
+    } rates[] = {
+#define MOEAI_METRICS_RATE(field) { #field, offsetof(struct moeai_mem_rates, field) }
+        MOEAI_METRICS_RATE(pgfault),
+        MOEAI_METRICS_RATE(pgmajfault),
+        MOEAI_METRICS_RATE(pgscan_kswapd),
+        MOEAI_METRICS_RATE(pgscan_direct),
+        MOEAI_METRICS_RATE(pgsteal_kswapd),
+        MOEAI_METRICS_RATE(pgsteal_direct),
+        MOEAI_METRICS_RATE(allocstall),
+        MOEAI_METRICS_RATE(refault),
+        MOEAI_METRICS_RATE(pswpin),
+        MOEAI_METRICS_RATE(pswpout),
+        MOEAI_METRICS_RATE(activate),
+        MOEAI_METRICS_RATE(kswapd_run),
+        MOEAI_METRICS_RATE(kswapd_quick),
+#undef MOEAI_METRICS_RATE
+    };
+    struct moeai_mem_stats stats;
+    char labels[64];
+    int i;
+
+    if (moeai_mem_monitor_get_stats(&stats))
+        return;
+
+    metric_single(m, "memory_total_bytes", "gauge", "Total physical memory.",
+                  (u64)stats.total_ram << 10, 0);
+    metric_single(m, "memory_free_bytes", "gauge", "Free memory.",
+                  (u64)stats.free_ram << 10, 0);
+    metric_single(m, "memory_available_bytes", "gauge", "Estimated available memory.",
+                  (u64)stats.available_ram << 10, 0);
+    metric_single(m, "memory_cached_bytes", "gauge", "Page cache.",
+                  (u64)stats.cached_ram << 10, 0);
+    metric_single(m, "memory_usage_percent", "gauge", "Memory usage.",
+                  stats.mem_usage_percent, 0);
+    metric_single(m, "swap_total_bytes", "gauge", "Total swap space.",
+                  (u64)stats.swap_total << 10, 0);
+    metric_single(m, "swap_free_bytes", "gauge", "Free swap space.",
+                  (u64)stats.swap_free << 10, 0);
+    metric_single(m, "swap_usage_percent", "gauge", "Swap usage.",
+                  stats.swap_usage_percent, 0);
+
+    metric_single(m, "vmstat_rate_interval_seconds", "gauge",
+                  "Sampling interval of the vmstat rates, 0 until two samples exist.",
+                  stats.rates.interval_ms, 3);
+    metric_family(m, "vmstat_rate", "gauge", "Per-second vmstat event rate over the last check interval.");
+    for (i = 0; i < ARRAY_SIZE(rates); i++) {
+        snprintf(labels, sizeof(labels), "event=\"%s\"", rates[i].event);
+        metric_value(m, "vmstat_rate", labels,
+                     *(const unsigned long *)((const char *)&stats.rates + rates[i].offset), 0);
+    }
+}
+
+/* 压力状态机和回收计数 */
+static void metrics_state(struct seq_file *m)
+{
+    struct moeai_mem_state_info info;
+    char labels[64];
+    int i;
+
+    if (moeai_mem_monitor_get_state(&info))
+        return;
+
+    metric_family(m, "memory_state", "gauge", "Current memory pressure state, 1 for the active state.");
+    for (i = 0; i < MOEAI_STATE_MAX; i++) {
+        snprintf(labels, sizeof(labels), "state=\"%s\"", moeai_mem_state_key(i));
+        metric_value(m, "memory_state", labels, info.state == i, 0);
+    }
+    metric_single(m, "memory_state_seconds", "gauge", "Time spent in the current state.",
+                  info.state_ms, 3);
+    metric_single(m, "memory_state_transitions_total", "counter", "State transitions.",
+                  info.transitions, 0);
+    metric_family(m, "memory_state_entries_total", "counter", "Entries into each state.");
+    for (i = 0; i < MOEAI_STATE_MAX; i++) {
+        snprintf(labels, sizeof(labels), "state=\"%s\"", moeai_mem_state_key(i));
+        metric_value(m, "memory_state_entries_total", labels, info.state_entries[i], 0);
+    }
+
+    metric_family(m, "reclaim_runs_total", "counter", "Automatic reclaims run per policy.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_runs_total", labels, info.reclaim_runs[i], 0);
+    }
+    metric_family(m, "reclaim_suppressed_total", "counter", "Reclaims skipped by the policy cooldown.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_suppressed_total", labels, info.reclaim_suppressed[i], 0);
+    }
+    metric_single(m, "reclaim_thrash_suppressed_total", "counter",
+                  "Reclaims abandoned while thrashing.", info.thrash_suppressed, 0);
+    metric_single(m, "reclaim_futile_total", "counter",
+                  "Reclaims abandoned because too little memory was reclaimable.", info.reclaim_futile, 0);
+    metric_single(m, "wmark_low_events_total", "counter",
+                  "Times any zone fell below its low watermark.", info.wmark_low_events, 0);
+}
+
+/* 使用率预测 */
+static void metrics_forecast(struct seq_file *m)
+{
+    struct moeai_mem_forecast_info fc;
+
+    if (moeai_mem_monitor_get_forecast(&fc))
+        return;
+
+    metric_single(m, "forecast_samples", "gauge", "History samples used by the forecast.",
+                  fc.samples, 0);
+    metric_single(m, "forecast_level_percent", "gauge", "Smoothed memory usage.",
+                  fc.level_centi, 2);
+    metric_single(m, "forecast_error_percent", "gauge", "Mean absolute one-step forecast error.",
+                  fc.mae_centi, 2);
+    metric_single(m, "forecast_predictions_total", "counter",
+                  "Predicted threshold crossings.", fc.predictions, 0);
+    metric_single(m, "forecast_hits_total", "counter",
+                  "Predictions followed by a crossing.", fc.hits, 0);
+    metric_single(m, "forecast_false_alarms_total", "counter",
+                  "Predictions not followed by a crossing.", fc.false_alarms, 0);
+    metric_single(m, "forecast_misses_total", "counter",
+                  "Crossings that were not predicted.", fc.misses, 0);
+    metric_single(m, "forecast_triggers_total", "counter",
+                  "Reclaims triggered by a prediction.", fc.triggers, 0);
+}
+
+/* 内存监控配置 */
+static void metrics_config(struct seq_file *m)
+{
+    struct moeai_mem_monitor_config c;
+    char labels[64];
+    int i;
+
+    if (moeai_mem_monitor_get_config(&c))
+        return;
+
+    metric_single(m, "config_check_interval_seconds", "gauge", "Memory check interval.",
+                  c.check_interval_ms, 3);
+    metric_family(m, "config_threshold_percent", "gauge", "Usage thresholds for entering and leaving each state.");
+    metric_value(m, "config_threshold_percent", "state=\"warning\",direction=\"enter\"", c.warn_threshold, 0);
+    metric_value(m, "config_threshold_percent", "state=\"warning\",direction=\"exit\"", c.warn_exit_threshold, 0);
+    metric_value(m, "config_threshold_percent", "state=\"critical\",direction=\"enter\"", c.critical_threshold, 0);
+    metric_value(m, "config_threshold_percent", "state=\"critical\",direction=\"exit\"", c.critical_exit_threshold, 0);
+    metric_value(m, "config_threshold_percent", "state=\"emergency\",direction=\"enter\"", c.emergency_threshold, 0);
+    metric_value(m, "config_threshold_percent", "state=\"emergency\",direction=\"exit\"", c.emergency_exit_threshold, 0);
+    metric_single(m, "config_min_dwell_seconds", "gauge", "Minimum time in a state before stepping down.",
+                  c.min_dwell_ms, 3);
+    metric_family(m, "config_reclaim_cooldown_seconds", "gauge", "Cooldown between reclaims of each policy.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "config_reclaim_cooldown_seconds", labels, c.reclaim_cooldown_ms[i], 3);
+    }
+    metric_family(m, "config_node_threshold_percent", "gauge", "Per-node usage thresholds.");
+    metric_value(m, "config_node_threshold_percent", "state=\"warning\"", c.node_warn_threshold, 0);
+    metric_value(m, "config_node_threshold_percent", "state=\"critical\"", c.node_critical_threshold, 0);
+    metric_single(m, "config_node_reclaim_bytes", "gauge", "Target of one node-targeted reclaim.",
+                  (u64)c.node_reclaim_kb << 10, 0);
+    metric_family(m, "config_rate_threshold", "gauge", "Per-second rate thresholds, 0 when disabled.");
+    metric_value(m, "config_rate_threshold", "event=\"pgscan_direct\"", c.direct_scan_rate_threshold, 0);
+    metric_value(m, "config_rate_threshold", "event=\"allocstall\"", c.allocstall_rate_threshold, 0);
+    metric_value(m, "config_rate_threshold", "event=\"refault\"", c.refault_rate_threshold, 0);
+    metric_value(m, "config_rate_threshold", "event=\"thrash_swap\"", c.thrash_swap_threshold, 0);
+    metric_value(m, "config_rate_threshold", "event=\"thrash_refault\"", c.thrash_refault_threshold, 0);
+    metric_single(m, "config_thrash_activate_percent", "gauge",
+                  "Share of refaults activated that counts as thrashing.", c.thrash_activate_percent, 0);
+    metric_single(m, "config_forecast_horizon_seconds", "gauge",
+                  "Forecast horizon for early reclaim, 0 when disabled.", c.forecast_horizon_ms, 3);
+    metric_single(m, "config_min_reclaimable_bytes", "gauge",
+                  "Minimum reclaimable estimate before reclaiming, 0 when unchecked.",
+                  (u64)c.min_reclaimable_kb << 10, 0);
+    metric_family(m, "config_stall_threshold_seconds", "gauge", "Direct reclaim stall p99 thresholds, 0 when disabled.");
+    metric_value(m, "config_stall_threshold_seconds", "state=\"warning\"", c.stall_warn_us, 6);
+    metric_value(m, "config_stall_threshold_seconds", "state=\"critical\"", c.stall_critical_us, 6);
+    metric_single(m, "config_auto_reclaim", "gauge", "Automatic reclaim enabled.", c.auto_reclaim, 0);
+    metric_single(m, "config_wmark_trigger", "gauge", "Watermark trigger enabled.", c.wmark_trigger, 0);
+}
+
+/* 回收策略的开销和效果 */
+static void metrics_policy(struct seq_file *m)
+{
+    struct moeai_mem_policy_stats *ps;
+    char labels[64];
+    int i, j;
+
+    ps = kmalloc_array(MOEAI_MEM_RECLAIM_MAX, sizeof(*ps), GFP_KERNEL);
+    if (!ps)
+        return;
+    if (moeai_mem_policy_get_stats(ps))
+        goto out;
+
+    metric_family(m, "reclaim_policy_calls_total", "counter", "Reclaim calls per policy, including manual ones.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_policy_calls_total", labels, ps[i].runs, 0);
+    }
+    metric_family(m, "reclaim_policy_freed_bytes_total", "counter", "Increase in available memory after reclaim.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_policy_freed_bytes_total", labels, ps[i].freed_kb << 10, 0);
+    }
+    metric_family(m, "reclaim_policy_latency_seconds_total", "counter", "Wall time spent reclaiming.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_policy_latency_seconds_total", labels, ps[i].latency_us, 6);
+    }
+    metric_family(m, "reclaim_policy_max_latency_seconds", "gauge", "Longest single reclaim.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        snprintf(labels, sizeof(labels), "policy=\"%s\"", moeai_mem_policy_key(i));
+        metric_value(m, "reclaim_policy_max_latency_seconds", labels, ps[i].max_latency_us, 6);
+    }
+
+    /* 决策上下文对应警告、临界、紧急三个压力状态 */
+    metric_family(m, "reclaim_policy_trials_total", "counter", "Settled reclaims per policy and pressure state.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+        for (j = 0; j < MOEAI_MEM_POLICY_NR_CTX; j++) {
+            snprintf(labels, sizeof(labels), "policy=\"%s\",state=\"%s\"", moeai_mem_policy_key(i),
+                     moeai_mem_state_key(MOEAI_STATE_WARNING + j));
+            metric_value(m, "reclaim_policy_trials_total", labels, ps[i].arms[j].trials, 0);
+        }
+    metric_family(m, "reclaim_policy_successes_total", "counter",
+                  "Reclaims that brought usage below the trigger threshold.");
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+        for (j = 0; j < MOEAI_MEM_POLICY_NR_CTX; j++) {
+            snprintf(labels, sizeof(labels), "policy=\"%s\",state=\"%s\"", moeai_mem_policy_key(i),
+                     moeai_mem_state_key(MOEAI_STATE_WARNING + j));
+            metric_value(m, "reclaim_policy_successes_total", labels, ps[i].arms[j].successes, 0);
+        }
+out:
+    kfree(ps);
+}
+
+/* NUMA 节点 */
+static void metrics_nodes(struct seq_file *m)
+{
+    struct moeai_mem_node_stats *nodes;
+    char labels[32];
+    int n, i;
+
+    nodes = kmalloc_array(MOEAI_MEM_MAX_NODES, sizeof(*nodes), GFP_KERNEL);
+    if (!nodes)
+        return;
+    n = moeai_mem_monitor_get_node_stats(nodes, MOEAI_MEM_MAX_NODES);
+    if (n <= 0)
+        goto out;
+
+#define MOEAI_METRICS_NODES(name, type, help, expr, frac)                     \
+    do {                                                                    \
+        metric_family(m, name, type, help);                                 \
+        for (i = 0; i < n; i++) {                                           \
+            snprintf(labels, sizeof(labels), "node=\"%d\"", nodes[i].nid);  \
+            metric_value(m, name, labels, (expr), frac);                    \
+        }                                                                   \
+    } while (0)
+
+    MOEAI_METRICS_NODES("node_memory_total_bytes", "gauge", "Managed memory of the node.",
+                        (u64)nodes[i].total_ram << 10, 0);
+    MOEAI_METRICS_NODES("node_memory_free_bytes", "gauge", "Free memory of the node.",
+                        (u64)nodes[i].free_ram << 10, 0);
+    MOEAI_METRICS_NODES("node_memory_available_bytes", "gauge", "Estimated available memory of the node.",
+                        (u64)nodes[i].available_ram << 10, 0);
+    MOEAI_METRICS_NODES("node_memory_file_bytes", "gauge", "File pages of the node.",
+                        (u64)nodes[i].file_ram << 10, 0);
+    MOEAI_METRICS_NODES("node_memory_anon_bytes", "gauge", "Anonymous pages of the node.",
+                        (u64)nodes[i].anon_ram << 10, 0);
+    MOEAI_METRICS_NODES("node_memory_usage_percent", "gauge", "Memory usage of the node.",
+                        nodes[i].mem_usage_percent, 0);
+    MOEAI_METRICS_NODES("node_memory_state", "gauge",
+                        "Pressure state of the node (0 normal, 1 warning, 2 critical).",
+                        nodes[i].state, 0);
+    MOEAI_METRICS_NODES("node_reclaim_runs_total", "counter", "Node-targeted reclaims.",
+                        nodes[i].reclaim_runs, 0);
+#undef MOEAI_METRICS_NODES
+out:
+    kfree(nodes);
+}
+
+/* 内存区域碎片 */
+static void metrics_zones(struct seq_file *m)
+{
+    struct moeai_frag_zone_stats *zones;
+    char labels[64];
+    int n, i, order;
+
+    zones = kmalloc_array(MOEAI_FRAG_MAX_ZONES, sizeof(*zones), GFP_KERNEL);
+    if (!zones)
+        return;
+    n = moeai_mem_frag_get_stats(zones, MOEAI_FRAG_MAX_ZONES);
+    if (n <= 0)
+        goto out;
+
+#define MOEAI_METRICS_ZONES(name, type, help, expr)                           \
+    do {                                                                    \
+        metric_family(m, name, type, help);                                 \
+        for (i = 0; i < n; i++) {                                           \
+            snprintf(labels, sizeof(labels), "node=\"%d\",zone=\"%s\"",     \
+                     zones[i].nid, zones[i].zone_name);                     \
+            metric_value(m, name, labels, (expr), 0);                       \
+        }                                                                   \
+    } while (0)
+
+    MOEAI_METRICS_ZONES("zone_free_pages", "gauge", "Free pages of the zone.", zones[i].free_pages);
+    MOEAI_METRICS_ZONES("zone_high_order_free_percent", "gauge",
+                        "Share of free memory in blocks of at least the watched order.",
+                        zones[i].high_order_percent);
+    MOEAI_METRICS_ZONES("zone_compact_runs_total", "counter", "Compactions triggered for the zone.",
+                        zones[i].compact_runs);
+#undef MOEAI_METRICS_ZONES
+
+    metric_family(m, "zone_free_blocks", "gauge", "Free blocks per order, as in /proc/buddyinfo.");
+    for (i = 0; i < n; i++)
+        for (order = 0; order < MOEAI_FRAG_NR_ORDERS; order++) {
+            snprintf(labels, sizeof(labels), "node=\"%d\",zone=\"%s\",order=\"%d\"",
+                     zones[i].nid, zones[i].zone_name, order);
+            metric_value(m, "zone_free_blocks", labels, zones[i].nr_free[order], 0);
+        }
+out:
+    kfree(zones);
+}
+
+/* 直接回收停顿，直方图的第 i 个桶统计 [2^(i-1), 2^i) 微秒 */
+static void metrics_stall(struct seq_file *m)
+{
+    struct moeai_stall_summary *s;
+    char labels[32];
+    u64 cumulative = 0, le_s;
+    u32 le_us;
+    int i;
+
+    s = kmalloc(sizeof(*s), GFP_KERNEL);
+    if (!s)
+        return;
+    if (moeai_stall_get_summary(s))
+        goto out;
+
+    metric_single(m, "reclaim_stall_attached", "gauge",
+                  "Whether stall tracking is attached to the vmscan tracepoints.", s->attached, 0);
+    metric_single(m, "reclaim_stall_untracked_total", "counter",
+                  "Stalls not timed because the in-flight table was full.", s->untracked, 0);
+    metric_family(m, "reclaim_stall_seconds", "histogram", "Direct reclaim stall duration.");
+    for (i = 0; i < MOEAI_STALL_BUCKETS; i++) {
+        cumulative += s->buckets[i];
+        le_s = div_u64_rem(1ULL << i, USEC_PER_SEC, &le_us);
+        snprintf(labels, sizeof(labels), "le=\"%llu.%06u\"", le_s, le_us);
+        metric_value(m, "reclaim_stall_seconds_bucket", labels, cumulative, 0);
+    }
+    metric_value(m, "reclaim_stall_seconds_bucket", "le=\"+Inf\"", s->total.count, 0);
+    metric_value(m, "reclaim_stall_seconds_sum", NULL, s->total.total_us, 6);
+    metric_value(m, "reclaim_stall_seconds_count", NULL, s->total.count, 0);
+    metric_single(m, "reclaim_stall_max_seconds", "gauge", "Longest direct reclaim stall.",
+                  s->total.max_us, 6);
+out:
+    kfree(s);
+}
+
+/* cgroup 监控，逐个输出最接近限制的 cgroup */
+static void metrics_memcg(struct seq_file *m)
+{
+    struct moeai_memcg_summary summary;
+    struct moeai_memcg_stats *top;
+    char *labels, *path;
+    int n, i;
+
+    if (moeai_memcg_get_summary(&summary))
+        return;
+
+    metric_single(m, "memcg_available", "gauge", "Whether cgroup v2 with the memory controller was found.",
+                  summary.available, 0);
+    if (!summary.available)
+        return;
+    metric_single(m, "memcg_tracked", "gauge", "Tracked cgroups.", summary.tracked, 0);
+    metric_single(m, "memcg_limited", "gauge", "Tracked cgroups with a memory limit.", summary.limited, 0);
+    metric_family(m, "memcg_pressure_cgroups", "gauge", "Tracked cgroups per pressure state.");
+    metric_value(m, "memcg_pressure_cgroups", "state=\"warning\"", summary.warning, 0);
+    metric_value(m, "memcg_pressure_cgroups", "state=\"critical\"", summary.critical, 0);
+    metric_single(m, "memcg_passes_total", "counter", "Completed cgroup walks.", summary.passes, 0);
+    metric_single(m, "memcg_last_pass_seconds", "gauge", "Duration of the last cgroup walk.",
+                  summary.last_pass_ms, 3);
+    metric_single(m, "memcg_dropped_total", "counter", "Cgroups not tracked because of the limit.",
+                  summary.dropped, 0);
+    metric_single(m, "memcg_events_total", "counter", "Cgroup state changes.", summary.events, 0);
+
+    top = kmalloc_array(MOEAI_MEMCG_MAX_TOP, sizeof(*top), GFP_KERNEL);
+    labels = kmalloc(MOEAI_METRICS_LABEL_LEN * 2, GFP_KERNEL);
+    if (!top || !labels)
+        goto out;
+    path = labels + MOEAI_METRICS_LABEL_LEN;
+    n = moeai_memcg_get_top(top, MOEAI_MEMCG_MAX_TOP);
+
+#define MOEAI_METRICS_MEMCG(name, help, expr, frac)                            \
+    do {                                                                    \
+        metric_family(m, name, "gauge", help);                              \
+        for (i = 0; i < n; i++) {                                           \
+            snprintf(labels, MOEAI_METRICS_LABEL_LEN, "cgroup=\"%s\"",      \
+                     metric_escape(path, MOEAI_METRICS_LABEL_LEN, top[i].path));       \
+            metric_value(m, name, labels, (expr), frac);                    \
+        }                                                                   \
+    } while (0)
+
+    MOEAI_METRICS_MEMCG("memcg_usage_bytes", "memory.current of the cgroup.", top[i].usage_bytes, 0);
+    MOEAI_METRICS_MEMCG("memcg_limit_bytes", "memory.max of the cgroup, 0 when unlimited.",
+                        top[i].limit_bytes, 0);
+    MOEAI_METRICS_MEMCG("memcg_usage_percent", "Usage relative to the limit.", top[i].usage_permyriad, 2);
+    MOEAI_METRICS_MEMCG("memcg_psi_some_percent", "memory.pressure some avg10.", top[i].psi_some_centi, 2);
+    MOEAI_METRICS_MEMCG("memcg_psi_full_percent", "memory.pressure full avg10.", top[i].psi_full_centi, 2);
+    MOEAI_METRICS_MEMCG("memcg_state", "Pressure state of the cgroup (0 normal, 1 warning, 2 critical).",
+                        top[i].state, 0);
+#undef MOEAI_METRICS_MEMCG
+out:
+    kfree(labels);
+    kfree(top);
+}
+
+/* 工作集估算 */
+static void metrics_wss(struct seq_file *m)
+{
+    struct moeai_wss_summary summary;
+    struct moeai_wss_target_stats *targets;
+    char *labels, *path;
+    int n, i;
+
+    if (moeai_wss_get_summary(&summary))
+        return;
+
+    metric_single(m, "wss_available", "gauge", "Whether idle page tracking is available.",
+                  summary.available, 0);
+    if (!summary.available)
+        return;
+    metric_single(m, "wss_targets", "gauge", "Selected cgroups.", summary.nr_targets, 0);
+    metric_single(m, "wss_passes_total", "counter", "Completed full scans.", summary.passes, 0);
+    metric_single(m, "wss_last_pass_seconds", "gauge", "Duration of the last full scan.",
+                  summary.last_pass_ms, 3);
+
+    targets = kmalloc_array(MOEAI_WSS_MAX_TARGETS, sizeof(*targets), GFP_KERNEL);
+    labels = kmalloc(MOEAI_METRICS_LABEL_LEN * 2, GFP_KERNEL);
+    if (!targets || !labels)
+        goto out;
+    path = labels + MOEAI_METRICS_LABEL_LEN;
+    n = moeai_wss_get_targets(targets, MOEAI_WSS_MAX_TARGETS);
+
+#define MOEAI_METRICS_WSS(name, help, field)                                   \
+    do {                                                                    \
+        metric_family(m, name, "gauge", help);                              \
+        for (i = 0; i < n; i++) {                                           \
+            snprintf(labels, MOEAI_METRICS_LABEL_LEN, "cgroup=\"%s\"",      \
+                     metric_escape(path, MOEAI_METRICS_LABEL_LEN, targets[i].path));   \
+            metric_value(m, name, labels, (u64)targets[i].field << 10, 0);  \
+        }                                                                   \
+    } while (0)
+
+    MOEAI_METRICS_WSS("wss_scanned_bytes", "Reclaimable LRU memory of the cgroup.", scanned_kb);
+    MOEAI_METRICS_WSS("wss_bytes", "Memory accessed since the previous scan.", wss_kb);
+    MOEAI_METRICS_WSS("wss_cold_bytes", "Memory idle for at least the cold age.", cold_kb);
+#undef MOEAI_METRICS_WSS
+out:
+    kfree(labels);
+    kfree(targets);
+}
+
+/* 主动回收 */
+static void metrics_proactive(struct seq_file *m)
+{
+    struct moeai_proactive_stats *ps;
+    char *labels, *path;
+    int n, i;
+
+    ps = kmalloc_array(MOEAI_PROACTIVE_MAX_TARGETS, sizeof(*ps), GFP_KERNEL);
+    labels = kmalloc(MOEAI_METRICS_LABEL_LEN * 2, GFP_KERNEL);
+    if (!ps || !labels)
+        goto out;
+    path = labels + MOEAI_METRICS_LABEL_LEN;
+    n = moeai_proactive_get_stats(ps, MOEAI_PROACTIVE_MAX_TARGETS);
+    if (n <= 0)
+        goto out;
+
+#define MOEAI_METRICS_PROACTIVE(name, type, help, expr, frac)                  \
+    do {                                                                    \
+        metric_family(m, name, type, help);                                 \
+        for (i = 0; i < n; i++) {                                           \
+            snprintf(labels, MOEAI_METRICS_LABEL_LEN, "cgroup=\"%s\"",      \
+                     metric_escape(path, MOEAI_METRICS_LABEL_LEN, ps[i].path));        \
+            metric_value(m, name, labels, (expr), frac);                    \
+        }                                                                   \
+    } while (0)
+
+    MOEAI_METRICS_PROACTIVE("proactive_rounds_total", "counter", "Proactive reclaim rounds.",
+                            ps[i].rounds, 0);
+    MOEAI_METRICS_PROACTIVE("proactive_reclaimed_bytes_total", "counter",
+                            "Drop in memory.current caused by proactive reclaim.", ps[i].reclaimed_bytes, 0);
+    MOEAI_METRICS_PROACTIVE("proactive_refault_bytes_total", "counter",
+                            "Refaults since proactive reclaim started.", ps[i].refault_bytes, 0);
+    MOEAI_METRICS_PROACTIVE("proactive_cost_ratio", "gauge",
+                            "Refaults relative to the amount reclaimed in the last round.",
+                            ps[i].cost_permille, 3);
+    MOEAI_METRICS_PROACTIVE("proactive_step_bytes", "gauge", "Amount requested per round.",
+                            (u64)ps[i].step_kb << 10, 0);
+    MOEAI_METRICS_PROACTIVE("proactive_backoffs_total", "counter", "Backoffs because of high cost.",
+                            ps[i].backoffs, 0);
+    MOEAI_METRICS_PROACTIVE("proactive_short_rounds_total", "counter",
+                            "Rounds that reclaimed less than requested.", ps[i].short_rounds, 0);
+#undef MOEAI_METRICS_PROACTIVE
+out:
+    kfree(labels);
+    kfree(ps);
+}
+
+/* 日志系统 */
+static void metrics_logger(struct seq_file *m)
+{
+    struct moeai_logger_stats stats;
+    char labels[32];
+    int i;
+
+    moeai_logger_get_stats(&stats);
+
+    metric_family(m, "log_messages_total", "counter", "Log messages recorded per level.");
+    for (i = 0; i < MOEAI_LOG_LEVELS; i++) {
+        snprintf(labels, sizeof(labels), "level=\"%s\"", moeai_log_level_key(i));
+        metric_value(m, "log_messages_total", labels, stats.messages[i], 0);
+    }
+    metric_single(m, "log_filtered_total", "counter", "Log messages below the minimum level.",
+                  stats.filtered, 0);
+    metric_single(m, "log_lock_contended_total", "counter",
+                  "Log buffer writes that had to wait for the lock.", stats.contended, 0);
+}
+
+/* 按子系统分段输出，seq_file 每次只需容纳一段 */
+static void (* const moeai_metrics_sections[])(struct seq_file *m) = {
+    metrics_memory,
+    metrics_state,
+    metrics_forecast,
+    metrics_config,
+    metrics_policy,
+    metrics_nodes,
+    metrics_zones,
+    metrics_stall,
+    metrics_memcg,
+    metrics_wss,
+    metrics_proactive,
+    metrics_logger,
+};
+
+static void *moeai_metrics_start(struct seq_file *m, loff_t *pos)
+{
+    return *pos < ARRAY_SIZE(moeai_metrics_sections) ?
+           (void *)&moeai_metrics_sections[*pos] : NULL;
+}
+
+static void *moeai_metrics_next(struct seq_file *m, void *v, loff_t *pos)
+{
+    ++*pos;
+    return moeai_metrics_start(m, pos);
+}
+
+static void moeai_metrics_stop(struct seq_file *m, void *v)
+{
+}
+
+static int moeai_metrics_show(struct seq_file *m, void *v)
+{
+    void (* const *section)(struct seq_file *m) = v;
+
+    (*section)(m);
+    return 0;
+}
+
+static const struct seq_operations moeai_metrics_seq_ops = {
+    .start = moeai_metrics_start,
+    .next = moeai_metrics_next,
+    .stop = moeai_metrics_stop,
+    .show = moeai_metrics_show,
+};
+
+static int moeai_metrics_open(struct inode *inode, struct file *file)
+{
+    return seq_open(file, &moeai_metrics_seq_ops);
+}
+
+const struct proc_ops moeai_metrics_fops = {
+    .proc_open = moeai_metrics_open,
+    .proc_read = seq_read,
+    .proc_lseek = seq_lseek,
+    .proc_release = seq_release,
+};
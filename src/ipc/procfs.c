@@ -19,11 +19,32 @@
 #include <linux/version.h>      /* 获取内核版本信息 */
 #include <linux/utsname.h>      /* 获取系统信息 */
 #include <linux/sysinfo.h>      /* 获取系统信息 */
+#include <linux/string.h>
+#include <linux/math64.h>
+#include <linux/poll.h>
+#include <linux/wait.h>
+#include <linux/workqueue.h>
+#include <linux/capability.h>
+#include <linux/user_namespace.h>
 #include "../../include/ipc/procfs_interface.h"
+#include "../../include/ipc/control.h"
+#include "../../include/ipc/metrics.h"
 #include "../../include/modules/mem_monitor.h"
+#include "../../include/modules/mem_frag.h"
+#include "../../include/modules/mem_policy.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/stall_trace.h"
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/modules/mem_proactive.h"
+#include "../../include/modules/rss_tracker.h"
+#include "../../include/data/stats.h"
+#include "../../include/data/live.h"
+#include "../../include/data/selftest.h"
 #include "../../include/utils/logger.h"
 #include "../../include/utils/ring_buffer.h"
+#include "../../include/utils/bench.h"
 #include "../../include/core/version.h"
+#include "../../include/core/event_loop.h"
 #include "../../include/utils/lang.h"
 #include "../../include/utils/lang.h"
 
@@ -36,90 +57,55 @@ static struct proc_dir_entry *status_entry;
 static struct proc_dir_entry *control_entry;
 static struct proc_dir_entry *log_entry;
 static struct proc_dir_entry *selftest_entry;  /* 新增: 自检结果条目 */
+static struct proc_dir_entry *burst_entry;
+static struct proc_dir_entry *top_mem_entry;
+static struct proc_dir_entry *stats_bin_entry;
+static struct proc_dir_entry *metrics_entry;
+static struct proc_dir_entry *events_entry;
+static struct proc_dir_entry *live_entry;
+static struct proc_dir_entry *selftest_bin_entry;
 
 /* Self-test related */
-static char *selftest_buffer = NULL;  /* Self-test results buffer */
-static size_t selftest_len = 0;       /* Self-test results length */
-static bool selftest_done = false;    /* Whether self-test is completed */
+static struct moeai_selftest_run *selftest_current; /* 正在运行的自检，只由工作函数写入记录 */
+static bool selftest_running = false; /* 是否有自检正在运行 */
+static u64 selftest_started;          /* 最近一次开始的运行代数 */
+static u64 selftest_completed;        /* 最近一次完成的运行代数，0表示尚未运行 */
 static DEFINE_MUTEX(selftest_mutex);  /* Self-test mutex lock */
+static DECLARE_WAIT_QUEUE_HEAD(selftest_wait); /* 等待自检完成的 poll 读者 */
 
-/* 自检结果缓冲区追加函数 */
-static void selftest_append(const char *fmt, ...)
-{
-    va_list args;
-    size_t avail_len, written_len;
-    
-    if (!selftest_buffer)
-        return;
-        
-    mutex_lock(&selftest_mutex);
-    
-    avail_len = MOEAI_MAX_SELFTEST_LEN - selftest_len - 1;
-    if (avail_len > 0) {
-        va_start(args, fmt);
-        written_len = vsnprintf(selftest_buffer + selftest_len, avail_len, fmt, args);
-        va_end(args);
-        
-        /* 确保不超出缓冲区 */
-        if (written_len > avail_len)
-            written_len = avail_len;
-            
-        selftest_len += written_len;
-    }
-    
-    mutex_unlock(&selftest_mutex);
-}
-
-/* 清除自检结果 */
-static void selftest_clear(void)
-{
-    mutex_lock(&selftest_mutex);
-    if (selftest_buffer)
-        selftest_buffer[0] = '\0';
-    selftest_len = 0;
-    selftest_done = false;
-    mutex_unlock(&selftest_mutex);
-}
+static void selftest_work_fn(struct work_struct *work);
+static DECLARE_WORK(selftest_work, selftest_work_fn);
 
 /* 自检函数：测试内存监控功能 */
-static moeai_selftest_result_t test_memory_monitor(void)
+static moeai_selftest_result_t test_memory_monitor(struct moeai_selftest_run *run)
 {
     struct moeai_mem_stats stats;
     int ret;
     
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_MEMORY_TEST));
-    
     ret = moeai_mem_monitor_get_stats(&stats);
     if (ret) {
-        selftest_append("%s %d\n", lang_get(LANG_PROCFS_SELFTEST_FAIL), ret);
+        moeai_selftest_error(run, "get_stats", 0, ret);
         return MOEAI_TEST_FAIL;
     }
     
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PASS));
-    
-    if (stats.mem_usage_percent > 90) {
-        selftest_append("%s %u%%\n", lang_get(LANG_PROCFS_SELFTEST_WARN), stats.mem_usage_percent);
+    moeai_selftest_value(run, "mem_usage_percent", stats.mem_usage_percent);
+    if (stats.mem_usage_percent > 90)
         return MOEAI_TEST_WARNING;
-    }
-    
-    selftest_append("%s %u%%\n", lang_get(LANG_PROCFS_SELFTEST_PASS), stats.mem_usage_percent);
     return MOEAI_TEST_PASS;
 }
 
 /* 自检函数：测试环形缓冲区功能 */
-static moeai_selftest_result_t test_ring_buffer(void)
+static moeai_selftest_result_t test_ring_buffer(struct moeai_selftest_run *run)
 {
     struct moeai_ring_buffer *rb;
     const char *test_data = "test_data";
     char buffer[64];
     int ret;
     
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_RINGBUF_TEST));
-    
     /* 创建测试缓冲区 */
     rb = moeai_ring_buffer_create(64, 1); // 创建容量为64，item_size为1的缓冲区
     if (!rb) {
-        selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_FAIL));
+        moeai_selftest_error(run, "create", 0, -ENOMEM);
         return MOEAI_TEST_FAIL;
     }
     
@@ -127,7 +113,7 @@ static moeai_selftest_result_t test_ring_buffer(void)
     for (size_t i = 0; i < strlen(test_data); i++) {
         ret = moeai_ring_buffer_write(rb, &test_data[i]);
         if (ret != 0) {
-            selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_FAIL));
+            moeai_selftest_error(run, "write", 0, ret);
             moeai_ring_buffer_destroy(rb);
             return MOEAI_TEST_FAIL;
         }
@@ -139,7 +125,7 @@ static moeai_selftest_result_t test_ring_buffer(void)
         char ch;
         ret = moeai_ring_buffer_read(rb, &ch);
         if (ret != 0) {
-            selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_FAIL));
+            moeai_selftest_error(run, "read", 0, ret);
             moeai_ring_buffer_destroy(rb);
             return MOEAI_TEST_FAIL;
         }
@@ -147,24 +133,22 @@ static moeai_selftest_result_t test_ring_buffer(void)
     }
     
     if (strcmp(buffer, test_data) != 0) {
-        selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_FAIL));
+        moeai_selftest_error(run, "verify", 0, -EIO);
         moeai_ring_buffer_destroy(rb);
         return MOEAI_TEST_FAIL;
     }
     
     /* 清理 */
     moeai_ring_buffer_destroy(rb);
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PASS));
     return MOEAI_TEST_PASS;
 }
 
 /* 自检函数：测试日志系统 */
-static moeai_selftest_result_t test_logger(void)
+static moeai_selftest_result_t test_logger(struct moeai_selftest_run *run)
 {
     struct moeai_log_entry *entries;
     size_t count;
-    
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_LOGGER_TEST));
+    int ret;
     
     /* 发送测试日志 */
     MOEAI_INFO("selftest", lang_get(LANG_PROCFS_SELFTEST_LOGGER_TEST));
@@ -172,307 +156,853 @@ static moeai_selftest_result_t test_logger(void)
     /* 分配临时缓冲区 */
     entries = kmalloc(sizeof(*entries) * 10, GFP_KERNEL);
     if (!entries) {
-        selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_WARN));
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
         return MOEAI_TEST_WARNING;
     }
     
     /* 获取日志条目 */
-    if (moeai_logger_get_recent_logs(entries, 10, &count)) {
-        selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_FAIL));
-        kfree(entries);
+    ret = moeai_logger_get_recent_logs(entries, 10, &count);
+    kfree(entries);
+    if (ret) {
+        moeai_selftest_error(run, "get_recent_logs", 0, ret);
         return MOEAI_TEST_FAIL;
     }
     
-    selftest_append("%s %zu\n", lang_get(LANG_PROCFS_SELFTEST_PASS), count);
-    kfree(entries);
+    moeai_selftest_value(run, "recent_entries", count);
     return MOEAI_TEST_PASS;
 }
 
-/* 自检函数：测试procfs接口功能 */
-static moeai_selftest_result_t test_procfs_interface(void)
+/* 通过 VFS 读取 /proc/moeai 下一个文件的开头，确认能打开且渲染出内容 */
+static int selftest_read_proc(const char *name, char *buf, size_t size)
 {
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_PROCFS_INTERFACE));
-    
-    /* TODO: Implement procfs interface test */
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_PROCFS_INTERFACE));
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PASS));
-    return MOEAI_TEST_PASS;
+    char path[64];
+    struct file *filp;
+    loff_t pos = 0;
+    ssize_t n;
+
+    snprintf(path, sizeof(path), "/proc/" MOEAI_PROCFS_ROOT "/%s", name);
+    filp = filp_open(path, O_RDONLY, 0);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+    n = kernel_read(filp, buf, size, &pos);
+    filp_close(filp, NULL);
+    if (n < 0)
+        return n;
+    return n ? 0 : -ENODATA;
 }
 
-/* 新增: 自检函数：测试网络防护功能 */
-static moeai_selftest_result_t test_net_guard(void)
+/* 自检函数：测试procfs接口功能，检查条目均已创建，并读取状态和指标文件 */
+static moeai_selftest_result_t test_procfs_interface(struct moeai_selftest_run *run)
 {
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_NET_GUARD));
+    static const char * const readable[] = { MOEAI_PROCFS_STATUS, MOEAI_PROCFS_METRICS };
+    const struct {
+        const char *name;
+        const struct proc_dir_entry *entry;
+    } entries[] = {
+        { MOEAI_PROCFS_STATUS, status_entry },
+        { MOEAI_PROCFS_CONTROL, control_entry },
+        { MOEAI_PROCFS_LOG, log_entry },
+        { MOEAI_PROCFS_SELFTEST, selftest_entry },
+        { MOEAI_PROCFS_BURST, burst_entry },
+        { MOEAI_PROCFS_TOP_MEM, top_mem_entry },
+        { MOEAI_PROCFS_STATS_BIN, stats_bin_entry },
+        { MOEAI_PROCFS_METRICS, metrics_entry },
+        { MOEAI_PROCFS_EVENTS, events_entry },
+        { MOEAI_PROCFS_LIVE, live_entry },
+        { MOEAI_PROCFS_SELFTEST_BIN, selftest_bin_entry },
+    };
+    moeai_selftest_result_t result = MOEAI_TEST_PASS;
+    char *buf;
+    int i, ret;
+
+    for (i = 0; i < ARRAY_SIZE(entries); i++) {
+        if (!entries[i].entry) {
+            moeai_selftest_error(run, entries[i].name, 0, -ENOENT);
+            result = MOEAI_TEST_FAIL;
+        }
+    }
+    if (result != MOEAI_TEST_PASS)
+        return result;
+
+    buf = kmalloc(PAGE_SIZE, GFP_KERNEL);
+    if (!buf) {
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
+        return MOEAI_TEST_WARNING;
+    }
+
+    for (i = 0; i < ARRAY_SIZE(readable); i++) {
+        ret = selftest_read_proc(readable[i], buf, PAGE_SIZE);
+        if (ret) {
+            moeai_selftest_error(run, readable[i], 0, ret);
+            result = MOEAI_TEST_FAIL;
+        }
+    }
 
+    kfree(buf);
+    return result;
+}
+
+/* 新增: 自检函数：测试网络防护功能 */
+static moeai_selftest_result_t test_net_guard(struct moeai_selftest_run *run)
+{
     /* TODO: Complete netguard module test
      * 1. Check if network filter rules can be loaded
      * 2. Try to add test rules and verify
      * 3. Check statistics counters
      */
-     
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_NET_GUARD));
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_NOT_IMPLEMENTED));
     return MOEAI_TEST_SKIP;
 }
 
 /* 新增: 自检函数：测试文件系统日志功能 */
-static moeai_selftest_result_t test_fs_logger(void)
+static moeai_selftest_result_t test_fs_logger(struct moeai_selftest_run *run)
 {
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_FS_LOGGER));
-    
     /* TODO: Complete filesystem logger module test
      * 1. Check if filesystem monitoring points are registered
      * 2. Try to trigger a file access event and verify logging
      * 3. Test log rotation and storage
      */
-    
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_FS_LOGGER));
-    selftest_append("%s\n", lang_get(LANG_PROCFS_TEST_NOT_IMPLEMENTED));
     return MOEAI_TEST_SKIP;
 }
 
-/* 新增: 自检函数：基本性能测试 */
-static moeai_selftest_result_t test_performance(void)
+/* 基准测试的批量读取条目数 */
+#define MOEAI_SELFTEST_BENCH_BATCH  32
+/* 状态渲染较慢，单独使用较少的迭代次数 */
+#define MOEAI_SELFTEST_BENCH_STATUS_ITERATIONS  50
+/* 状态渲染使用的输出缓冲区大小 */
+#define MOEAI_SELFTEST_BENCH_SEQ_SIZE  (64 * 1024)
+
+static int moeai_procfs_status_show(struct seq_file *seq, void *v);
+
+/* 基准测试用例共享的上下文 */
+struct moeai_selftest_bench {
+    struct moeai_ring_buffer *rb;
+    struct moeai_log_entry items[MOEAI_SELFTEST_BENCH_BATCH];
+    struct moeai_mem_stats stats;
+    struct seq_file seq;
+    struct moeai_log_sink log_sink;
+    enum moeai_log_level level;
+    unsigned long sink;
+};
+
+static void bench_noop(void *arg)
 {
+}
+
+static void bench_rb_write(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    /* 缓冲区满时覆盖最旧的条目，与日志系统的用法一致 */
+    moeai_ring_buffer_write(b->rb, &b->items[0]);
+}
+
+static void bench_rb_prepare_read(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_ring_buffer_write(b->rb, &b->items[0]);
+}
+
+static void bench_rb_read(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_ring_buffer_read(b->rb, &b->items[0]);
+}
+
+static void bench_rb_prepare_batch(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
     int i;
-    u64 duration;
-    struct timespec64 ts_start, ts_end;
-    char *test_buf = NULL;
 
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PERF_TEST));
-    
-    /* 分配测试缓冲区 */
-    test_buf = kmalloc(1024 * 1024, GFP_KERNEL); /* 1MB测试缓冲区 */
-    if (!test_buf) {
-        selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_WARN));
+    for (i = 0; i < MOEAI_SELFTEST_BENCH_BATCH; i++)
+        moeai_ring_buffer_write(b->rb, &b->items[i]);
+}
+
+static void bench_rb_read_batch(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+    size_t count;
+
+    moeai_ring_buffer_read_batch(b->rb, b->items, MOEAI_SELFTEST_BENCH_BATCH, &count);
+}
+
+static void bench_log(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_log_to(&b->log_sink, b->level, MODULE_NAME, "bench %u %s", 42U, "message");
+}
+
+static void bench_mem_get_stats(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_mem_monitor_get_stats(&b->stats);
+}
+
+static void bench_status_prepare(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    b->seq.count = 0;
+}
+
+static void bench_status_render(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_procfs_status_show(&b->seq, NULL);
+}
+
+static void bench_lang_get(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    b->sink += (unsigned long)lang_get(LANG_PROCFS_SELFTEST_PASS);
+}
+
+static const struct moeai_bench_case moeai_selftest_bench_cases[] = {
+    { .name = "clock_overhead", .run = bench_noop },
+    { .name = "ring_buffer_write", .run = bench_rb_write },
+    { .name = "ring_buffer_read", .prepare = bench_rb_prepare_read, .run = bench_rb_read },
+    { .name = "ring_buffer_read_batch32", .prepare = bench_rb_prepare_batch,
+      .run = bench_rb_read_batch },
+    { .name = "mem_monitor_get_stats", .run = bench_mem_get_stats },
+    { .name = "status_render", .prepare = bench_status_prepare, .run = bench_status_render,
+      .warmup = 5, .iterations = MOEAI_SELFTEST_BENCH_STATUS_ITERATIONS },
+    { .name = "lang_get", .run = bench_lang_get },
+};
+
+static const struct {
+    const char *name;
+    enum moeai_log_level level;
+} moeai_selftest_bench_log_levels[] = {
+    { "log_debug", MOEAI_LOG_DEBUG },
+    { "log_info", MOEAI_LOG_INFO },
+    { "log_warn", MOEAI_LOG_WARN },
+    { "log_error", MOEAI_LOG_ERROR },
+};
+
+static int bench_report(struct moeai_selftest_run *run, const struct moeai_bench_case *bc,
+                        struct moeai_selftest_bench *b)
+{
+    struct moeai_bench_result res;
+    int ret;
+
+    ret = moeai_bench_run(bc, b, &res);
+    if (ret) {
+        moeai_selftest_error(run, bc->name, 0, ret);
+        return ret;
+    }
+
+    moeai_selftest_bench(run, bc->name, &res);
+    return 0;
+}
+
+/*
+ * 性能测试：对模块自身的热路径做微基准测试，时间单位为纳秒
+ * 日志用例按当前最小级别测量级别过滤和消息格式化，写入不带缓冲区的私有输出目标，
+ * 不改动全局日志配置，也不计入日志计数和事件；写入缓冲区的开销由
+ * 以日志条目为单位的环形缓冲区用例测量
+ */
+static moeai_selftest_result_t test_performance(struct moeai_selftest_run *run)
+{
+    struct moeai_logger_config config;
+    struct moeai_bench_case log_case = { .run = bench_log };
+    struct moeai_selftest_bench *b;
+    moeai_selftest_result_t result = MOEAI_TEST_PASS;
+    int i;
+
+    b = kzalloc(sizeof(*b), GFP_KERNEL);
+    if (!b) {
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
         return MOEAI_TEST_WARNING;
     }
-    
-    /* 测试内存写入性能 */
-    selftest_append("  %s\n", lang_get(LANG_PROCFS_SELFTEST_MEM_WRITE_PERF));
-    ktime_get_real_ts64(&ts_start);
-    
-    for (i = 0; i < 1024 * 1024; i++)
-        test_buf[i] = (char)(i & 0xFF);
-    
-    ktime_get_real_ts64(&ts_end);
-    duration = (ts_end.tv_sec - ts_start.tv_sec) * 1000000000ULL +
-               (ts_end.tv_nsec - ts_start.tv_nsec);
-    
-    selftest_append("    %s %llu.%03llu ms\n", 
-                    lang_get(LANG_PROCFS_SELFTEST_WRITE_TIME),
-                    duration / 1000000, (duration % 1000000) / 1000);
-    
-    /* 测试内存读取性能 */
-    selftest_append("  %s\n", lang_get(LANG_PROCFS_SELFTEST_MEM_READ_PERF));
-    ktime_get_real_ts64(&ts_start);
-    
-    volatile int sum = 0;
-    for (i = 0; i < 1024 * 1024; i++)
-        sum += test_buf[i];
-    
-    ktime_get_real_ts64(&ts_end);
-    duration = (ts_end.tv_sec - ts_start.tv_sec) * 1000000000ULL +
-               (ts_end.tv_nsec - ts_start.tv_nsec);
-    
-    selftest_append("    %s %llu.%03llu ms\n", 
-                    lang_get(LANG_PROCFS_SELFTEST_READ_TIME),
-                    duration / 1000000, (duration % 1000000) / 1000);
-    
-    /* 释放测试缓冲区 */
-    kfree(test_buf);
-    
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PASS));
-    return MOEAI_TEST_PASS;
+
+    b->rb = moeai_ring_buffer_create(MOEAI_SELFTEST_BENCH_BATCH * 4, sizeof(struct moeai_log_entry));
+    b->seq.buf = kvmalloc(MOEAI_SELFTEST_BENCH_SEQ_SIZE, GFP_KERNEL);
+    if (!b->rb || !b->seq.buf) {
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
+        result = MOEAI_TEST_WARNING;
+        goto out;
+    }
+    b->seq.size = MOEAI_SELFTEST_BENCH_SEQ_SIZE;
+    for (i = 0; i < MOEAI_SELFTEST_BENCH_BATCH; i++)
+        snprintf(b->items[i].message, sizeof(b->items[i].message), "bench %d", i);
+
+    for (i = 0; i < ARRAY_SIZE(moeai_selftest_bench_cases); i++) {
+        /* 每个用例从空缓冲区开始 */
+        moeai_ring_buffer_clear(b->rb);
+        if (bench_report(run, &moeai_selftest_bench_cases[i], b))
+            result = MOEAI_TEST_WARNING;
+    }
+
+    if (moeai_logger_get_config(&config))
+        config.min_level = MOEAI_LOG_INFO;
+    moeai_log_sink_init(&b->log_sink, config.min_level, NULL);
+    for (i = 0; i < ARRAY_SIZE(moeai_selftest_bench_log_levels); i++) {
+        log_case.name = moeai_selftest_bench_log_levels[i].name;
+        b->level = moeai_selftest_bench_log_levels[i].level;
+        if (bench_report(run, &log_case, b))
+            result = MOEAI_TEST_WARNING;
+    }
+
+out:
+    moeai_ring_buffer_destroy(b->rb);
+    kvfree(b->seq.buf);
+    kfree(b);
+    return result;
+}
+
+/* 可扩展性测试中每个 CPU 数运行的时间 (毫秒) */
+#define MOEAI_SELFTEST_SCALE_MS  100
+
+/* 可扩展性测试的一个工作负载 */
+struct moeai_selftest_scale_case {
+    const char *name;
+    void (*run)(void *arg);
+    unsigned long (*contended)(void *arg);
+};
+
+static unsigned long scale_rb_contended(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    return moeai_ring_buffer_contended(b->rb);
+}
+
+static void scale_log(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    moeai_log_to(&b->log_sink, MOEAI_LOG_INFO, MODULE_NAME, "bench %u %s", 42U, "message");
+}
+
+static unsigned long scale_log_contended(void *arg)
+{
+    struct moeai_selftest_bench *b = arg;
+
+    return atomic_long_read(&b->log_sink.contended);
+}
+
+static const struct moeai_selftest_scale_case moeai_selftest_scale_cases[] = {
+    { "ring_buffer_write", bench_rb_write, scale_rb_contended },
+    { "log_info", scale_log, scale_log_contended },
+};
+
+/* 在 1, 2, 4 ... N 个 CPU 上同时运行一个工作负载，报告吞吐量、相对单 CPU 的倍数和锁争用 */
+static int scale_report(struct moeai_selftest_run *run, const struct moeai_selftest_scale_case *sc,
+                        struct moeai_selftest_bench *b)
+{
+    struct moeai_bench_parallel_result res;
+    unsigned int max = num_online_cpus();
+    unsigned int nr = 1;
+    unsigned long before, contended;
+    u64 base = 0, scale;
+    int ret;
+
+    for (;;) {
+        before = sc->contended(b);
+        ret = moeai_bench_parallel(sc->run, b, nr, MOEAI_SELFTEST_SCALE_MS, &res);
+        if (ret) {
+            moeai_selftest_error(run, sc->name, nr, ret);
+            return ret;
+        }
+        contended = sc->contended(b) - before;
+
+        if (nr == 1)
+            base = res.ops_per_sec;
+        scale = base ? div64_u64(res.ops_per_sec * 100, base) : 0;
+        moeai_selftest_scale(run, sc->name, res.nr_threads, res.ops_per_sec, scale,
+                             contended, res.ops);
+
+        if (nr == max)
+            break;
+        nr = min(nr * 2, max);
+    }
+    return 0;
+}
+
+/*
+ * 可扩展性测试：每个在线 CPU 一个绑定的内核线程同时运行同一工作负载
+ * 日志用例写入私有输出目标，与日志系统一样先取输出目标的锁再写环形缓冲区，
+ * 测量的是同样的锁争用，不影响 /proc/moeai/log 和全局日志配置
+ */
+static moeai_selftest_result_t test_scalability(struct moeai_selftest_run *run)
+{
+    struct moeai_selftest_bench *b;
+    moeai_selftest_result_t result = MOEAI_TEST_PASS;
+    int i;
+
+    b = kzalloc(sizeof(*b), GFP_KERNEL);
+    if (!b) {
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
+        return MOEAI_TEST_WARNING;
+    }
+
+    b->rb = moeai_ring_buffer_create(MOEAI_SELFTEST_BENCH_BATCH * 4, sizeof(struct moeai_log_entry));
+    if (!b->rb) {
+        moeai_selftest_error(run, "alloc", 0, -ENOMEM);
+        result = MOEAI_TEST_WARNING;
+        goto out;
+    }
+
+    moeai_log_sink_init(&b->log_sink, MOEAI_LOG_INFO, b->rb);
+
+    for (i = 0; i < ARRAY_SIZE(moeai_selftest_scale_cases); i++) {
+        if (scale_report(run, &moeai_selftest_scale_cases[i], b))
+            result = MOEAI_TEST_WARNING;
+    }
+
+out:
+    moeai_ring_buffer_destroy(b->rb);
+    kfree(b);
+    return result;
 }
 
 /* 新增: 自检函数：系统环境信息收集 */
-static moeai_selftest_result_t test_system_info(void)
+static moeai_selftest_result_t test_system_info(struct moeai_selftest_run *run)
 {
     struct sysinfo si;
     
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_SYSINFO_TEST));
-    
-    /* 获取系统信息 */
+    /* 获取系统信息，内核版本记录在运行头中 */
     si_meminfo(&si);
     
-    /* 输出系统内存信息 */
-    selftest_append("  %s:\n", lang_get(LANG_PROCFS_MEMORY_STATUS));
-    selftest_append("    %s: %lu MB\n", lang_get(LANG_PROCFS_SELFTEST_TOTAL), si.totalram >> 10);
-    selftest_append("    %s: %lu MB\n", lang_get(LANG_PROCFS_SELFTEST_FREE), si.freeram >> 10);
-    selftest_append("    %s: %lu MB\n", lang_get(LANG_PROCFS_SELFTEST_SHARED), si.sharedram >> 10);
-    selftest_append("    %s: %lu MB\n", lang_get(LANG_PROCFS_SELFTEST_BUFFER), si.bufferram >> 10);
-    
-    /* 输出内核版本信息 */
-    selftest_append("  %s: %s %s\n", lang_get(LANG_PROCFS_SELFTEST_KERNEL), 
-                   init_utsname()->sysname, init_utsname()->release);
-    
-    /* 输出处理器信息 */
-    selftest_append("  %s: %d\n", lang_get(LANG_PROCFS_SELFTEST_CPUS), num_present_cpus());
-    
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_PASS));
+    moeai_selftest_value(run, "total_ram_mb", ((u64)si.totalram * si.mem_unit) >> 20);
+    moeai_selftest_value(run, "free_ram_mb", ((u64)si.freeram * si.mem_unit) >> 20);
+    moeai_selftest_value(run, "shared_ram_mb", ((u64)si.sharedram * si.mem_unit) >> 20);
+    moeai_selftest_value(run, "buffer_ram_mb", ((u64)si.bufferram * si.mem_unit) >> 20);
+    moeai_selftest_value(run, "cpus", num_present_cpus());
     return MOEAI_TEST_PASS;
 }
 
+/* 各项测试，按运行顺序排列，下标即测试编号 */
+static const struct {
+    int title;
+    moeai_selftest_result_t (*run)(struct moeai_selftest_run *run);
+} selftest_tests[MOEAI_SELFTEST_NR_TESTS] = {
+    [MOEAI_SELFTEST_SYSINFO] = { LANG_PROCFS_SELFTEST_SYSINFO_TEST, test_system_info },
+    [MOEAI_SELFTEST_MEMORY] = { LANG_PROCFS_SELFTEST_MEMORY_TEST, test_memory_monitor },
+    [MOEAI_SELFTEST_NET_GUARD] = { LANG_PROCFS_SELFTEST_NETGUARD_TEST, test_net_guard },
+    [MOEAI_SELFTEST_FS_LOGGER] = { LANG_PROCFS_SELFTEST_FSLOGGER_TEST, test_fs_logger },
+    [MOEAI_SELFTEST_RING_BUFFER] = { LANG_PROCFS_SELFTEST_RINGBUF_TEST, test_ring_buffer },
+    [MOEAI_SELFTEST_LOGGER] = { LANG_PROCFS_SELFTEST_LOGGER_TEST, test_logger },
+    [MOEAI_SELFTEST_PROCFS] = { LANG_PROCFS_SELFTEST_PROCFS_TEST, test_procfs_interface },
+    [MOEAI_SELFTEST_PERFORMANCE] = { LANG_PROCFS_SELFTEST_PERF_TEST, test_performance },
+    [MOEAI_SELFTEST_SCALABILITY] = { LANG_PROCFS_SELFTEST_SCALE_TEST, test_scalability },
+};
+
+/* 结果码对应的标签 */
+static const int selftest_status_str[] = {
+    [MOEAI_TEST_PASS] = LANG_PROCFS_SELFTEST_PASS,
+    [MOEAI_TEST_WARNING] = LANG_PROCFS_SELFTEST_WARN,
+    [MOEAI_TEST_FAIL] = LANG_PROCFS_SELFTEST_FAIL,
+    [MOEAI_TEST_SKIP] = LANG_PROCFS_SELFTEST_SKIP,
+};
+
+/* 统计一次运行中各结果码的测试数 */
+static void selftest_count(const struct moeai_selftest_run *run,
+                           unsigned int count[ARRAY_SIZE(selftest_status_str)])
+{
+    int i;
+
+    memset(count, 0, sizeof(unsigned int) * ARRAY_SIZE(selftest_status_str));
+    for (i = 0; i < MOEAI_SELFTEST_NR_TESTS; i++) {
+        if (run->status[i] < ARRAY_SIZE(selftest_status_str))
+            count[run->status[i]]++;
+    }
+}
+
 /**
- * 主自检函数 - 运行所有测试
+ * 自检工作函数 - 在工作队列中运行所有测试，完成后把结果加入历史记录并唤醒等待的读者
  */
-int moeai_trigger_selftest(void)
-{
-    unsigned int pass = 0, warn = 0, fail = 0, skip = 0;
-    moeai_selftest_result_t result;
-    struct timespec64 ts_start, ts_end;
-    u64 duration_us;
-    
-    /* 清空旧的测试结果 */
-    selftest_clear();
-    
-    /* 分配结果缓冲区（如果还没有分配） */
-    if (!selftest_buffer) {
-        selftest_buffer = kmalloc(MOEAI_MAX_SELFTEST_LEN, GFP_KERNEL);
-        if (!selftest_buffer) {
-            MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ALLOC_BUFFER_FAILED));
-            return -ENOMEM;
-        }
-        selftest_buffer[0] = '\0';
-    }
+static void selftest_work_fn(struct work_struct *work)
+{
+    unsigned int count[ARRAY_SIZE(selftest_status_str)];
+    struct moeai_selftest_run *run;
+    int i;
     
-    /* 记录开始时间 */
-    ktime_get_real_ts64(&ts_start);
+    mutex_lock(&selftest_mutex);
+    run = selftest_current;
+    mutex_unlock(&selftest_mutex);
+    if (!run)
+        return;
     
-    /* 输出自检头部 */
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_HEADER));
-    selftest_append("===================================\n");
-    selftest_append("%s: %lld.%ld\n", lang_get(LANG_PROCFS_SELFTEST_TIMESTAMP),
-                  (long long)ts_start.tv_sec, ts_start.tv_nsec / 1000);
-    {
-        char version_buf[256];
-        moeai_version_info(version_buf, sizeof(version_buf));
-        selftest_append("%s\n", version_buf);
-    }
-    selftest_append("===================================\n\n");
-
-    /* 首先收集系统信息 */
-    result = test_system_info();
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    /* 运行各项测试并统计结果 */
-    result = test_memory_monitor();
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    result = test_net_guard();  /* 新增: 测试网络防护模块 */
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    result = test_fs_logger();  /* 新增: 测试文件系统日志模块 */
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    result = test_ring_buffer();
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    result = test_logger();
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    result = test_procfs_interface();
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-
-    /* 运行性能测试 */
-    result = test_performance();  /* 新增: 执行性能测试 */
-    if (result == MOEAI_TEST_PASS) pass++;
-    else if (result == MOEAI_TEST_WARNING) warn++;
-    else if (result == MOEAI_TEST_FAIL) fail++;
-    else skip++;
-    selftest_append("\n");
-    
-    /* 记录结束时间并计算持续时间 */
-    ktime_get_real_ts64(&ts_end);
-    duration_us = (ts_end.tv_sec - ts_start.tv_sec) * 1000000 +
-                 (ts_end.tv_nsec - ts_start.tv_nsec) / 1000;
-    
-    /* 输出自检结果摘要 */
-    selftest_append("===================================\n");
-    selftest_append("%s\n", lang_get(LANG_PROCFS_SELFTEST_SUMMARY));
-    selftest_append("- %s: %u\n", lang_get(LANG_PROCFS_SELFTEST_PASS), pass);
-    selftest_append("- %s: %u\n", lang_get(LANG_PROCFS_SELFTEST_WARN), warn);
-    selftest_append("- %s: %u\n", lang_get(LANG_PROCFS_SELFTEST_FAIL), fail);
-    selftest_append("- %s: %u\n", lang_get(LANG_PROCFS_SELFTEST_SKIP), skip);
-    selftest_append("- %s: %u\n", lang_get(LANG_PROCFS_SELFTEST_TOTAL), pass + warn + fail + skip);
-    selftest_append("- %s: %llu.%03llu ms\n", lang_get(LANG_PROCFS_SELFTEST_TIME_MS),
-               duration_us / 1000, duration_us % 1000);
-    selftest_append("===================================\n");
+    for (i = 0; i < MOEAI_SELFTEST_NR_TESTS; i++) {
+        moeai_selftest_begin(run, i);
+        moeai_selftest_end(run, i, selftest_tests[i].run(run));
+    }
+    moeai_selftest_finish(run);
     
     /* 记录到日志 */
+    selftest_count(run, count);
     MOEAI_INFO(MODULE_NAME, "%s: %s=%u, %s=%u, %s=%u, %s=%u", 
               lang_get(LANG_PROCFS_SELFTEST_RESULT),
-              lang_get(LANG_PROCFS_SELFTEST_PASS), pass,
-              lang_get(LANG_PROCFS_SELFTEST_WARN), warn,
-              lang_get(LANG_PROCFS_SELFTEST_FAIL), fail,
-              lang_get(LANG_PROCFS_SELFTEST_SKIP), skip);
+              lang_get(LANG_PROCFS_SELFTEST_PASS), count[MOEAI_TEST_PASS],
+              lang_get(LANG_PROCFS_SELFTEST_WARN), count[MOEAI_TEST_WARNING],
+              lang_get(LANG_PROCFS_SELFTEST_FAIL), count[MOEAI_TEST_FAIL],
+              lang_get(LANG_PROCFS_SELFTEST_SKIP), count[MOEAI_TEST_SKIP]);
+    
+    /* 先加入历史记录再更新完成代数，被唤醒的读者一定能看到本次运行 */
+    moeai_selftest_publish(run);
+    
+    mutex_lock(&selftest_mutex);
+    selftest_current = NULL;
+    WRITE_ONCE(selftest_completed, run->gen);
+    selftest_running = false;
+    mutex_unlock(&selftest_mutex);
+    
+    wake_up_interruptible_all(&selftest_wait);
+}
+
+/**
+ * 触发自检 - 在工作队列中异步运行
+ * 已有自检在运行时合并到该次运行，不再重复排队
+ */
+int moeai_trigger_selftest(u64 *gen)
+{
+    struct moeai_selftest_run *run;
+    int ret = 0;
+    
+    mutex_lock(&selftest_mutex);
+    
+    if (selftest_running) {
+        MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_PROCFS_SELFTEST_COALESCED), selftest_started);
+        goto out;
+    }
+    
+    /* 每次运行单独分配，记录数组在运行中按需增长 */
+    run = moeai_selftest_run_alloc(selftest_started + 1);
+    if (!run) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ALLOC_BUFFER_FAILED));
+        ret = -ENOMEM;
+        goto out;
+    }
     
-    /* 标记自检完成 */
-    selftest_done = true;
+    selftest_current = run;
+    selftest_running = true;
+    selftest_started++;
+    queue_work(system_unbound_wq, &selftest_work);
     
+out:
+    if (gen)
+        *gen = selftest_started;
+    mutex_unlock(&selftest_mutex);
+    return ret;
+}
+
+/* 自检文件的读者，读到开头时重新选取最近一次运行，之后的读取都输出同一次运行 */
+struct selftest_reader {
+    u64 seen;                           /* 打开时已完成的运行代数，用于 poll */
+    struct moeai_selftest_run *run;     /* 正在输出的运行 */
+    struct moeai_selftest_run *prev;    /* 用于对比的前一次运行 */
+};
+
+/* 输出位置: 0 为头部，1..NR_TESTS 为各项测试，最后为摘要 */
+#define SELFTEST_POS_SUMMARY (MOEAI_SELFTEST_NR_TESTS + 1)
+
+static void selftest_reader_put(struct selftest_reader *reader)
+{
+    moeai_selftest_run_put(reader->run);
+    moeai_selftest_run_put(reader->prev);
+    reader->run = NULL;
+    reader->prev = NULL;
+}
+
+static void *moeai_procfs_selftest_start(struct seq_file *seq, loff_t *pos)
+{
+    struct selftest_reader *reader = seq->private;
+
+    if (*pos == 0) {
+        selftest_reader_put(reader);
+        reader->run = moeai_selftest_latest(&reader->prev);
+    }
+    if (*pos > SELFTEST_POS_SUMMARY || (*pos > 0 && !reader->run))
+        return NULL;
+    return pos;
+}
+
+static void *moeai_procfs_selftest_next(struct seq_file *seq, void *v, loff_t *pos)
+{
+    ++*pos;
+    return moeai_procfs_selftest_start(seq, pos);
+}
+
+static void moeai_procfs_selftest_stop(struct seq_file *seq, void *v)
+{
+}
+
+/* 输出与前一次运行相比的变化 */
+static void selftest_show_delta(struct seq_file *seq, u64 cur, u64 prev)
+{
+    u64 diff = cur >= prev ? cur - prev : prev - cur;
+    u64 pct;
+
+    if (!prev)
+        return;
+    pct = div64_u64(diff * 10000, prev);
+    seq_printf(seq, "  prev %llu %c%llu.%02llu%%", prev, cur >= prev ? '+' : '-',
+               pct / 100, pct % 100);
+}
+
+static void selftest_show_header(struct seq_file *seq, const struct selftest_reader *reader)
+{
+    const struct moeai_selftest_run *run = reader->run;
+    char version_buf[256];
+    u32 rem;
+    u64 sec;
+
+    mutex_lock(&selftest_mutex);
+    if (selftest_running) {
+        seq_printf(seq, lang_get(LANG_PROCFS_SELFTEST_IN_PROGRESS), selftest_started);
+        seq_puts(seq, "\n");
+    }
+    mutex_unlock(&selftest_mutex);
+
+    if (!run) {
+        seq_puts(seq, lang_get(LANG_PROCFS_SELFTEST_NOT_RUN));
+        seq_puts(seq, "\n");
+        return;
+    }
+
+    sec = div_u64_rem(run->start_ns, NSEC_PER_SEC, &rem);
+    moeai_version_info(version_buf, sizeof(version_buf));
+    seq_printf(seq, "%s\n", lang_get(LANG_PROCFS_SELFTEST_HEADER));
+    seq_puts(seq, "===================================\n");
+    seq_printf(seq, "%s: %llu\n", lang_get(LANG_PROCFS_SELFTEST_RUN), run->gen);
+    seq_printf(seq, "%s: %llu.%06u\n", lang_get(LANG_PROCFS_SELFTEST_TIMESTAMP),
+               sec, rem / 1000);
+    seq_printf(seq, "%s\n", version_buf);
+    seq_printf(seq, "%s: %s\n", lang_get(LANG_PROCFS_SELFTEST_KERNEL), run->release);
+    if (reader->prev) {
+        seq_printf(seq, lang_get(LANG_PROCFS_SELFTEST_COMPARE), reader->prev->gen);
+        seq_puts(seq, "\n");
+    }
+    seq_puts(seq, "===================================\n\n");
+}
+
+static void selftest_show_record(struct seq_file *seq, const struct moeai_selftest_record *rec,
+                                 const struct moeai_selftest_record *old)
+{
+    u64 scale, rate;
+
+    switch (rec->type) {
+    case MOEAI_SELFTEST_REC_VALUE:
+        seq_printf(seq, "  %-26s %llu\n", rec->name, rec->v[0]);
+        break;
+    case MOEAI_SELFTEST_REC_ERROR:
+        if (rec->arg)
+            seq_printf(seq, "  %-18s cpus=%-3u %s %d\n", rec->name, rec->arg,
+                       lang_get(LANG_PROCFS_SELFTEST_FAIL), rec->err);
+        else
+            seq_printf(seq, "  %-26s %s %d\n", rec->name,
+                       lang_get(LANG_PROCFS_SELFTEST_FAIL), rec->err);
+        break;
+    case MOEAI_SELFTEST_REC_BENCH:
+        seq_printf(seq, "  %-26s min %8llu  median %8llu  p99 %8llu  max %8llu  n=%llu",
+                   rec->name, rec->v[0], rec->v[1], rec->v[2], rec->v[3], rec->v[4]);
+        if (old)
+            selftest_show_delta(seq, rec->v[1], old->v[1]);
+        seq_puts(seq, "\n");
+        break;
+    case MOEAI_SELFTEST_REC_SCALE:
+        scale = rec->v[1];
+        /* 争用率: 每万次操作中等待锁的次数，按百分比两位小数输出 */
+        rate = rec->v[3] ? div64_u64(rec->v[2] * 10000, rec->v[3]) : 0;
+        seq_printf(seq, "  %-18s cpus=%-3u ops/s %10llu  x%llu.%02llu  contended %llu (%llu.%02llu%%)",
+                   rec->name, rec->arg, rec->v[0], scale / 100, scale % 100,
+                   rec->v[2], rate / 100, rate % 100);
+        if (old)
+            selftest_show_delta(seq, rec->v[0], old->v[0]);
+        seq_puts(seq, "\n");
+        break;
+    }
+}
+
+static void selftest_show_test(struct seq_file *seq, const struct selftest_reader *reader,
+                               unsigned int test)
+{
+    const struct moeai_selftest_run *run = reader->run;
+    const struct moeai_selftest_record *rec;
+    u8 status = run->status[test];
+    u8 last = MOEAI_SELFTEST_REC_VALUE;
+    unsigned int i;
+
+    seq_printf(seq, "%s\n", lang_get(selftest_tests[test].title));
+
+    for (i = 0; i < run->nr_records; i++) {
+        rec = &run->records[i];
+        if (rec->test != test)
+            continue;
+        /* 每组基准测试或可扩展性记录前输出一次单位说明 */
+        if (rec->type != last && rec->type == MOEAI_SELFTEST_REC_BENCH)
+            seq_printf(seq, "  %s\n", lang_get(LANG_PROCFS_SELFTEST_BENCH_UNIT));
+        else if (rec->type != last && rec->type == MOEAI_SELFTEST_REC_SCALE)
+            seq_printf(seq, "  %s\n", lang_get(LANG_PROCFS_SELFTEST_SCALE_UNIT));
+        if (rec->type != MOEAI_SELFTEST_REC_ERROR)
+            last = rec->type;
+        selftest_show_record(seq, rec, moeai_selftest_find(reader->prev, rec));
+    }
+
+    if (status >= ARRAY_SIZE(selftest_status_str))
+        status = MOEAI_TEST_SKIP;
+    seq_puts(seq, lang_get(selftest_status_str[status]));
+    if (status == MOEAI_TEST_SKIP)
+        seq_puts(seq, lang_get(LANG_PROCFS_TEST_NOT_IMPLEMENTED));
+    seq_puts(seq, "\n\n");
+}
+
+static void selftest_show_summary(struct seq_file *seq, const struct moeai_selftest_run *run)
+{
+    unsigned int count[ARRAY_SIZE(selftest_status_str)];
+    u64 duration_us = div_u64(run->duration_ns, NSEC_PER_USEC);
+    int i;
+
+    selftest_count(run, count);
+    seq_puts(seq, "===================================\n");
+    seq_printf(seq, "%s\n", lang_get(LANG_PROCFS_SELFTEST_SUMMARY));
+    for (i = 0; i < ARRAY_SIZE(selftest_status_str); i++)
+        seq_printf(seq, "- %s: %u\n", lang_get(selftest_status_str[i]), count[i]);
+    seq_puts(seq, "- ");
+    seq_printf(seq, lang_get(LANG_PROCFS_SELFTEST_TOTAL), MOEAI_SELFTEST_NR_TESTS);
+    seq_puts(seq, "\n- ");
+    seq_printf(seq, lang_get(LANG_PROCFS_SELFTEST_TIME_MS), duration_us / 1000, duration_us % 1000);
+    seq_puts(seq, "\n");
+    if (run->dropped) {
+        seq_puts(seq, "- ");
+        seq_printf(seq, lang_get(LANG_PROCFS_SELFTEST_DROPPED), run->dropped);
+        seq_puts(seq, "\n");
+    }
+    seq_puts(seq, "===================================\n");
+}
+
+/**
+ * 自检文件的show回调，每次输出一段，结果再多也不受缓冲区大小限制
+ */
+static int moeai_procfs_selftest_show(struct seq_file *seq, void *v)
+{
+    struct selftest_reader *reader = seq->private;
+    loff_t pos = *(loff_t *)v;
+
+    if (pos == 0)
+        selftest_show_header(seq, reader);
+    else if (pos == SELFTEST_POS_SUMMARY)
+        selftest_show_summary(seq, reader->run);
+    else
+        selftest_show_test(seq, reader, pos - 1);
     return 0;
 }
 
-/**
- * 自检文件的show回调
+static const struct seq_operations moeai_procfs_selftest_seq_ops = {
+    .start = moeai_procfs_selftest_start,
+    .next = moeai_procfs_selftest_next,
+    .stop = moeai_procfs_selftest_stop,
+    .show = moeai_procfs_selftest_show,
+};
+
+/*
+ * 打开时记下已完成的运行代数，poll 在之后有新的运行完成时返回可读，
+ * 因此读者应先打开文件再触发自检，然后 poll 等待结果
  */
-static int moeai_procfs_selftest_show(struct seq_file *seq, void *v)
+static int moeai_procfs_selftest_open(struct inode *inode, struct file *file)
 {
-    mutex_lock(&selftest_mutex);
+    struct selftest_reader *reader;
+
+    reader = __seq_open_private(file, &moeai_procfs_selftest_seq_ops, sizeof(*reader));
+    if (!reader)
+        return -ENOMEM;
+    reader->seen = READ_ONCE(selftest_completed);
+    return 0;
+}
+
+static __poll_t moeai_procfs_selftest_poll(struct file *file, poll_table *wait)
+{
+    struct seq_file *seq = file->private_data;
+    struct selftest_reader *reader = seq->private;
     
-    if (!selftest_done) {
-        seq_puts(seq, lang_get(LANG_PROCFS_SELFTEST_NOT_RUN));
-        seq_puts(seq, "\n");
-    } else if (selftest_buffer) {
-        seq_puts(seq, selftest_buffer);
-    } else {
-        seq_puts(seq, lang_get(LANG_PROCFS_SELFTEST_NO_BUFFER));
-        seq_puts(seq, "\n");
-    }
+    poll_wait(file, &selftest_wait, wait);
     
-    mutex_unlock(&selftest_mutex);
+    if (READ_ONCE(selftest_completed) != reader->seen)
+        return EPOLLIN | EPOLLRDNORM;
     return 0;
 }
 
-static int moeai_procfs_selftest_open(struct inode *inode, struct file *file)
+static int moeai_procfs_selftest_release(struct inode *inode, struct file *file)
 {
-    return single_open(file, moeai_procfs_selftest_show, NULL);
+    struct seq_file *seq = file->private_data;
+
+    selftest_reader_put(seq->private);
+    return seq_release_private(inode, file);
 }
 
 static const struct proc_ops moeai_procfs_selftest_fops = {
     .proc_open = moeai_procfs_selftest_open,
     .proc_read = seq_read,
     .proc_lseek = seq_lseek,
-    .proc_release = single_release,
+    .proc_poll = moeai_procfs_selftest_poll,
+    .proc_release = moeai_procfs_selftest_release,
+};
+
+/* 二进制自检历史的读者，打开时取得保留的全部运行 */
+struct selftest_bin_reader {
+    int nr;
+    struct moeai_selftest_run *runs[MOEAI_SELFTEST_HISTORY];
+};
+
+static void *moeai_procfs_selftest_bin_start(struct seq_file *seq, loff_t *pos)
+{
+    struct selftest_bin_reader *reader = seq->private;
+
+    return *pos < reader->nr ? reader->runs[*pos] : NULL;
+}
+
+static void *moeai_procfs_selftest_bin_next(struct seq_file *seq, void *v, loff_t *pos)
+{
+    ++*pos;
+    return moeai_procfs_selftest_bin_start(seq, pos);
+}
+
+static int moeai_procfs_selftest_bin_show(struct seq_file *seq, void *v)
+{
+    moeai_selftest_encode(seq, v);
+    return 0;
+}
+
+static const struct seq_operations moeai_procfs_selftest_bin_seq_ops = {
+    .start = moeai_procfs_selftest_bin_start,
+    .next = moeai_procfs_selftest_bin_next,
+    .stop = moeai_procfs_selftest_stop,
+    .show = moeai_procfs_selftest_bin_show,
+};
+
+static int moeai_procfs_selftest_bin_open(struct inode *inode, struct file *file)
+{
+    struct selftest_bin_reader *reader;
+
+    reader = __seq_open_private(file, &moeai_procfs_selftest_bin_seq_ops, sizeof(*reader));
+    if (!reader)
+        return -ENOMEM;
+    reader->nr = moeai_selftest_history(reader->runs, MOEAI_SELFTEST_HISTORY);
+    return 0;
+}
+
+static int moeai_procfs_selftest_bin_release(struct inode *inode, struct file *file)
+{
+    struct seq_file *seq = file->private_data;
+    struct selftest_bin_reader *reader = seq->private;
+    int i;
+
+    for (i = 0; i < reader->nr; i++)
+        moeai_selftest_run_put(reader->runs[i]);
+    return seq_release_private(inode, file);
+}
+
+static const struct proc_ops moeai_procfs_selftest_bin_fops = {
+    .proc_open = moeai_procfs_selftest_bin_open,
+    .proc_read = seq_read,
+    .proc_lseek = seq_lseek,
+    .proc_release = moeai_procfs_selftest_bin_release,
 };
 
 /**
@@ -481,8 +1011,9 @@ static const struct proc_ops moeai_procfs_selftest_fops = {
 static int moeai_procfs_status_show(struct seq_file *seq, void *v)
 {
     struct moeai_mem_stats stats;
+    struct moeai_mem_state_info state;
     char version_buf[256];
-    int ret;
+    int ret, i;
     
     /* 获取版本信息 */
     moeai_version_info(version_buf, sizeof(version_buf));
@@ -507,6 +1038,20 @@ static int moeai_procfs_status_show(struct seq_file *seq, void *v)
     seq_printf(seq, "  %s: %lu KB\n", lang_get(LANG_PROCFS_SWAP_FREE), stats.swap_free);
     seq_printf(seq, "  %s: %u%%\n\n", lang_get(LANG_PROCFS_SWAP_USAGE), stats.swap_usage_percent);
     
+    /* 输出内存活动速率 */
+    seq_puts(seq, lang_get(LANG_PROCFS_MEMORY_RATES));
+    seq_printf(seq, " (%u ms):\n", stats.rates.interval_ms);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGFAULT), stats.rates.pgfault);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGMAJFAULT), stats.rates.pgmajfault);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGSCAN_KSWAPD), stats.rates.pgscan_kswapd);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGSCAN_DIRECT), stats.rates.pgscan_direct);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGSTEAL_KSWAPD), stats.rates.pgsteal_kswapd);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_PGSTEAL_DIRECT), stats.rates.pgsteal_direct);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_ALLOCSTALL), stats.rates.allocstall);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_KSWAPD_RUN), stats.rates.kswapd_run);
+    seq_printf(seq, "  %s: %lu/s\n", lang_get(LANG_PROCFS_RATE_KSWAPD_QUICK), stats.rates.kswapd_quick);
+    seq_printf(seq, "  %s: %lu/s\n\n", lang_get(LANG_PROCFS_RATE_REFAULT), stats.rates.refault);
+    
     /* 输出监控配置 */
     {
         struct moeai_mem_monitor_config config;
@@ -518,10 +1063,399 @@ static int moeai_procfs_status_show(struct seq_file *seq, void *v)
         seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_WARN_THRESHOLD), config.warn_threshold);
         seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_CRITICAL_THRESHOLD), config.critical_threshold);
         seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_EMERGENCY_THRESHOLD), config.emergency_threshold);
+        seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_WARN_EXIT_THRESHOLD), config.warn_exit_threshold);
+        seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_CRITICAL_EXIT_THRESHOLD), config.critical_exit_threshold);
+        seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_EMERGENCY_EXIT_THRESHOLD), config.emergency_exit_threshold);
+        seq_printf(seq, "  %s: %u ms\n", lang_get(LANG_PROCFS_MIN_DWELL), config.min_dwell_ms);
+        seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_NODE_WARN_THRESHOLD), config.node_warn_threshold);
+        seq_printf(seq, "  %s: %u%%\n", lang_get(LANG_PROCFS_NODE_CRITICAL_THRESHOLD), config.node_critical_threshold);
+        seq_printf(seq, "  %s: %u KB\n", lang_get(LANG_PROCFS_NODE_RECLAIM_TARGET), config.node_reclaim_kb);
+        seq_printf(seq, "  %s: direct_scan=%lu/s allocstall=%lu/s refault=%lu/s\n",
+                  lang_get(LANG_PROCFS_RATE_THRESHOLDS), config.direct_scan_rate_threshold,
+                  config.allocstall_rate_threshold, config.refault_rate_threshold);
+        seq_printf(seq, "  %s: %u ms\n", lang_get(LANG_PROCFS_FORECAST_HORIZON), config.forecast_horizon_ms);
+        seq_printf(seq, "  %s: swap=%lu/s refault=%lu/s activate=%u%%\n",
+                  lang_get(LANG_PROCFS_THRASH_THRESHOLDS), config.thrash_swap_threshold,
+                  config.thrash_refault_threshold, config.thrash_activate_percent);
+        seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_RECLAIM_COOLDOWN));
+        for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+            seq_printf(seq, " %s=%u ms", moeai_mem_policy_name(i), config.reclaim_cooldown_ms[i]);
+        seq_puts(seq, "\n");
         seq_printf(seq, "  %s: %s\n\n", lang_get(LANG_PROCFS_AUTO_RECLAIM_STATUS), 
                   config.auto_reclaim ? lang_get(LANG_PROCFS_AUTO_RECLAIM_ON) : lang_get(LANG_PROCFS_AUTO_RECLAIM_OFF));
     }
     
+    /* 输出内存压力状态机 */
+    if (moeai_mem_monitor_get_state(&state) == 0) {
+        seq_puts(seq, lang_get(LANG_PROCFS_PRESSURE_STATE));
+        seq_puts(seq, "\n");
+        seq_printf(seq, "  %s: %s\n", lang_get(LANG_PROCFS_CURRENT_STATE),
+                  moeai_mem_state_name(state.state));
+        seq_printf(seq, "  %s: %u ms\n", lang_get(LANG_PROCFS_STATE_DURATION), state.state_ms);
+        seq_printf(seq, "  %s: %llu\n", lang_get(LANG_PROCFS_STATE_TRANSITIONS), state.transitions);
+        seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_STATE_ENTRIES));
+        for (i = 0; i < MOEAI_STATE_MAX; i++)
+            seq_printf(seq, " %s=%llu", moeai_mem_state_name(i), state.state_entries[i]);
+        seq_puts(seq, "\n");
+        seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_RECLAIM_RUNS));
+        for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+            seq_printf(seq, " %s=%llu", moeai_mem_policy_name(i), state.reclaim_runs[i]);
+        seq_puts(seq, "\n");
+        seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_RECLAIM_SUPPRESSED));
+        for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+            seq_printf(seq, " %s=%llu", moeai_mem_policy_name(i), state.reclaim_suppressed[i]);
+        seq_puts(seq, "\n");
+        seq_printf(seq, "  %s (%u ms): pswpin=%lu/s pswpout=%lu/s refault=%lu/s activate=%lu/s\n",
+                  lang_get(LANG_PROCFS_THRASH_WINDOW), state.thrash_window_ms,
+                  state.thrash_rates.pswpin, state.thrash_rates.pswpout,
+                  state.thrash_rates.refault, state.thrash_rates.activate);
+        seq_printf(seq, "  %s: %llu\n", lang_get(LANG_PROCFS_THRASH_SUPPRESSED),
+                  state.thrash_suppressed);
+        seq_printf(seq, "  %s: %llu\n", lang_get(LANG_PROCFS_RECLAIM_FUTILE),
+                  state.reclaim_futile);
+        seq_printf(seq, "  %s: %llu\n\n", lang_get(LANG_PROCFS_WMARK_LOW_EVENTS),
+                  state.wmark_low_events);
+    }
+    
+    /* 输出可回收内存估算 */
+    {
+        struct moeai_mem_reclaimable r;
+        struct moeai_mem_monitor_config config;
+        
+        if (moeai_mem_monitor_get_reclaimable(&r) == 0 &&
+            moeai_mem_monitor_get_config(&config) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_RECLAIMABLE));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  inactive_file=%lu KB active_file=%lu KB dirty=%lu KB slab=%lu KB anon=%lu KB swap_free=%lu KB\n",
+                      r.inactive_file, r.active_file, r.dirty, r.slab_reclaimable,
+                      r.anon, r.swap_free);
+            seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_RECLAIMABLE_ESTIMATE));
+            for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+                seq_printf(seq, " %s=%lu KB", moeai_mem_policy_name(i), r.estimate[i]);
+            seq_printf(seq, "\n  %s: %lu KB\n\n", lang_get(LANG_PROCFS_RECLAIMABLE_MIN),
+                      config.min_reclaimable_kb);
+        }
+    }
+    
+    /* 输出各区域水位 */
+    {
+        static const char * const levels[] = { "ok", "<high", "<low", "<min" };
+        struct moeai_mem_zone_wmark *zones;
+        struct moeai_mem_monitor_config config;
+        int n;
+        
+        zones = kmalloc_array(MOEAI_MEM_MAX_ZONES, sizeof(*zones), GFP_KERNEL);
+        if (zones && moeai_mem_monitor_get_config(&config) == 0) {
+            n = moeai_mem_monitor_get_wmarks(zones, MOEAI_MEM_MAX_ZONES);
+            seq_puts(seq, lang_get(LANG_PROCFS_WMARK));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %s\n", lang_get(LANG_PROCFS_WMARK_TRIGGER),
+                      config.wmark_trigger ? lang_get(LANG_PROCFS_AUTO_RECLAIM_ON) :
+                                             lang_get(LANG_PROCFS_AUTO_RECLAIM_OFF));
+            seq_puts(seq, lang_get(LANG_PROCFS_WMARK_TABLE_HEADER));
+            seq_puts(seq, "\n");
+            for (i = 0; i < n; i++)
+                seq_printf(seq, "  %4d %-8s %12lu %10lu %10lu %10lu  %-5s %8llu\n",
+                          zones[i].nid, zones[i].zone_name, zones[i].free_kb,
+                          zones[i].min_kb, zones[i].low_kb, zones[i].high_kb,
+                          levels[zones[i].level], zones[i].low_events);
+            seq_puts(seq, "\n");
+        }
+        kfree(zones);
+    }
+    
+    /* 输出直接回收停顿延迟 */
+    {
+        struct moeai_stall_summary *stall;
+        struct moeai_mem_monitor_config config;
+        
+        stall = kmalloc(sizeof(*stall), GFP_KERNEL);
+        if (stall && moeai_stall_get_summary(stall) == 0 &&
+            moeai_mem_monitor_get_config(&config) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_STALL));
+            seq_puts(seq, "\n");
+            if (!stall->attached)
+                seq_printf(seq, "  %s\n", lang_get(LANG_PROCFS_STALL_DETACHED));
+            seq_printf(seq, "  %s: count=%llu p50=%llu us p99=%llu us max=%llu us total=%llu us\n",
+                      lang_get(LANG_PROCFS_STALL_TOTAL), stall->total.count,
+                      stall->total.p50_us, stall->total.p99_us, stall->total.max_us,
+                      stall->total.total_us);
+            seq_printf(seq, "  %s (%u ms): count=%llu p50=%llu us p99=%llu us max=%llu us\n",
+                      lang_get(LANG_PROCFS_STALL_WINDOW), stall->window_ms,
+                      stall->window.count, stall->window.p50_us, stall->window.p99_us,
+                      stall->window.max_us);
+            seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_STALL_HISTOGRAM));
+            for (i = 0; i < MOEAI_STALL_BUCKETS; i++) {
+                if (stall->buckets[i])
+                    seq_printf(seq, " <%lluus=%llu", 1ULL << i, stall->buckets[i]);
+            }
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %llu\n", lang_get(LANG_PROCFS_STALL_UNTRACKED),
+                      stall->untracked);
+            seq_printf(seq, "  %s: warn=%u us critical=%u us\n\n",
+                      lang_get(LANG_PROCFS_STALL_THRESHOLDS),
+                      config.stall_warn_us, config.stall_critical_us);
+        }
+        kfree(stall);
+    }
+    
+    /* 输出各回收策略的实测效果 */
+    {
+        struct moeai_mem_policy_stats *pstats;
+        struct moeai_mem_policy_config pconfig;
+        int ctx;
+        
+        pstats = kmalloc_array(MOEAI_MEM_RECLAIM_MAX, sizeof(*pstats), GFP_KERNEL);
+        if (pstats && moeai_mem_policy_get_stats(pstats) == 0 &&
+            moeai_mem_policy_get_config(&pconfig) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_POLICY));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %s target=%u%% explore=%u\n",
+                      lang_get(LANG_PROCFS_POLICY_ADAPTIVE),
+                      pconfig.adaptive ? lang_get(LANG_PROCFS_AUTO_RECLAIM_ON) :
+                                         lang_get(LANG_PROCFS_AUTO_RECLAIM_OFF),
+                      pconfig.target_percent, pconfig.explore_interval);
+            seq_puts(seq, lang_get(LANG_PROCFS_POLICY_TABLE_HEADER));
+            seq_puts(seq, "\n");
+            for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+                u64 runs = max_t(u64, pstats[i].runs, 1);
+                
+                seq_printf(seq, "  %-10s %6llu %12llu %12llu %12llu",
+                          moeai_mem_policy_name(i), pstats[i].runs,
+                          div64_u64(pstats[i].freed_kb, runs),
+                          div64_u64(pstats[i].latency_us, runs),
+                          pstats[i].max_latency_us);
+                for (ctx = 0; ctx < MOEAI_MEM_POLICY_NR_CTX; ctx++)
+                    seq_printf(seq, "  %s=%llu/%llu[%u-%u%%]",
+                              moeai_mem_state_name(MOEAI_STATE_WARNING + ctx),
+                              pstats[i].arms[ctx].successes, pstats[i].arms[ctx].trials,
+                              pstats[i].arms[ctx].lower_percent,
+                              pstats[i].arms[ctx].upper_percent);
+                seq_puts(seq, "\n");
+            }
+            seq_puts(seq, "\n");
+        }
+        kfree(pstats);
+    }
+    
+    /* 输出内存 cgroup 监控，列出最接近限制的 cgroup */
+    {
+        struct moeai_memcg_summary summary;
+        struct moeai_memcg_stats *top;
+        int n;
+        
+        top = kmalloc_array(MOEAI_MEMCG_MAX_TOP, sizeof(*top), GFP_KERNEL);
+        if (top && moeai_memcg_get_summary(&summary) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_MEMCG));
+            seq_puts(seq, "\n");
+            if (!summary.available) {
+                seq_printf(seq, "  %s\n", lang_get(LANG_PROCFS_MEMCG_UNAVAILABLE));
+            } else {
+                seq_printf(seq, "  %s: %u limited=%u warning=%u critical=%u dropped=%llu events=%llu\n",
+                          lang_get(LANG_PROCFS_MEMCG_TRACKED), summary.tracked, summary.limited,
+                          summary.warning, summary.critical, summary.dropped, summary.events);
+                seq_printf(seq, "  %s: %llu (%u ms)\n", lang_get(LANG_PROCFS_MEMCG_PASSES),
+                          summary.passes, summary.last_pass_ms);
+                n = moeai_memcg_get_top(top, MOEAI_MEMCG_MAX_TOP);
+                if (n > 0) {
+                    seq_puts(seq, lang_get(LANG_PROCFS_MEMCG_TABLE_HEADER));
+                    seq_puts(seq, "\n");
+                }
+                for (i = 0; i < n; i++)
+                    seq_printf(seq, "  %9llu  %9llu  %3u.%02u%%  %3u.%02u%%  %-9s  %3u/%-3u    %s\n",
+                              top[i].usage_bytes >> 20, top[i].limit_bytes >> 20,
+                              top[i].usage_permyriad / 100, top[i].usage_permyriad % 100,
+                              top[i].psi_some_centi / 100, top[i].psi_some_centi % 100,
+                              moeai_mem_state_name(top[i].state),
+                              top[i].warn_percent, top[i].critical_percent, top[i].path);
+            }
+            seq_puts(seq, "\n");
+        }
+        kfree(top);
+    }
+    
+    /* 输出工作集估算 */
+    {
+        struct moeai_wss_summary summary;
+        struct moeai_wss_config wconfig;
+        struct moeai_wss_target_stats *targets;
+        int n, b;
+        
+        targets = kmalloc_array(MOEAI_WSS_MAX_TARGETS, sizeof(*targets), GFP_KERNEL);
+        if (targets && moeai_wss_get_summary(&summary) == 0 &&
+            moeai_wss_get_config(&wconfig) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_WSS));
+            seq_puts(seq, "\n");
+            if (!summary.available) {
+                seq_printf(seq, "  %s\n", lang_get(LANG_PROCFS_WSS_UNAVAILABLE));
+            } else {
+                seq_printf(seq, "  %s: %llu (%u ms, %lu pages, %u pages/%u ms)\n",
+                          lang_get(LANG_PROCFS_WSS_PASSES), summary.passes,
+                          summary.last_pass_ms, summary.nr_pfns,
+                          wconfig.scan_batch, wconfig.scan_interval_ms);
+                seq_printf(seq, "  %s: %u ms (%u)\n", lang_get(LANG_PROCFS_WSS_COLD_AGE),
+                          wconfig.cold_age_ms, summary.cold_passes);
+                n = moeai_wss_get_targets(targets, MOEAI_WSS_MAX_TARGETS);
+                if (n > 0) {
+                    seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_WSS_BUCKETS));
+                    for (b = 0; b < MOEAI_WSS_AGE_BUCKETS; b++)
+                        seq_printf(seq, " >=%us", (1U << b) * summary.last_pass_ms / 1000);
+                    seq_puts(seq, "\n");
+                    seq_puts(seq, lang_get(LANG_PROCFS_WSS_TABLE_HEADER));
+                    seq_puts(seq, "\n");
+                }
+                for (i = 0; i < n; i++) {
+                    seq_printf(seq, "  %10lu %9lu %9lu ", targets[i].scanned_kb >> 10,
+                              targets[i].wss_kb >> 10, targets[i].cold_kb >> 10);
+                    for (b = 0; b < MOEAI_WSS_AGE_BUCKETS; b++)
+                        seq_printf(seq, " %lu/%lu", targets[i].anon_kb[b] >> 10,
+                                  targets[i].file_kb[b] >> 10);
+                    seq_printf(seq, "  %s\n", targets[i].path);
+                }
+            }
+            seq_puts(seq, "\n");
+        }
+        kfree(targets);
+    }
+    
+    /* 输出主动回收 */
+    {
+        struct moeai_proactive_config pconfig;
+        struct moeai_proactive_stats *pstats;
+        int n;
+        
+        pstats = kmalloc_array(MOEAI_PROACTIVE_MAX_TARGETS, sizeof(*pstats), GFP_KERNEL);
+        if (pstats && moeai_proactive_get_config(&pconfig) == 0) {
+            seq_puts(seq, lang_get(LANG_PROCFS_PROACTIVE));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %s interval=%u ms step=%u KB max_cost=%u.%u%%\n",
+                      lang_get(LANG_PROCFS_PROACTIVE_STATUS),
+                      pconfig.enabled ? lang_get(LANG_PROCFS_AUTO_RECLAIM_ON) :
+                                        lang_get(LANG_PROCFS_AUTO_RECLAIM_OFF),
+                      pconfig.interval_ms, pconfig.step_kb,
+                      pconfig.max_cost_permille / 10, pconfig.max_cost_permille % 10);
+            n = moeai_proactive_get_stats(pstats, MOEAI_PROACTIVE_MAX_TARGETS);
+            if (n > 0) {
+                seq_puts(seq, lang_get(LANG_PROCFS_PROACTIVE_TABLE_HEADER));
+                seq_puts(seq, "\n");
+            }
+            for (i = 0; i < n; i++)
+                seq_printf(seq, "  %7llu %12llu %10llu %12llu %4u.%u%% %8u %4u %8llu %6llu  %s\n",
+                          pstats[i].rounds, pstats[i].reclaimed_bytes >> 20,
+                          pstats[i].last_reclaimed_bytes >> 10, pstats[i].refault_bytes >> 20,
+                          pstats[i].cost_permille / 10, pstats[i].cost_permille % 10,
+                          pstats[i].step_kb, pstats[i].skip, pstats[i].backoffs,
+                          pstats[i].short_rounds, pstats[i].path);
+            seq_puts(seq, "\n");
+        }
+        kfree(pstats);
+    }
+    
+    /* 输出内存压力预测 */
+    {
+        struct moeai_mem_forecast_info forecast;
+        int trend;
+        
+        if (moeai_mem_monitor_get_forecast(&forecast) == 0) {
+            trend = forecast.trend_centi_per_min;
+            seq_puts(seq, lang_get(LANG_PROCFS_FORECAST));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %u\n", lang_get(LANG_PROCFS_FORECAST_SAMPLES), forecast.samples);
+            seq_printf(seq, "  %s: %u.%02u%%\n", lang_get(LANG_PROCFS_FORECAST_LEVEL),
+                      forecast.level_centi / 100, forecast.level_centi % 100);
+            seq_printf(seq, "  %s: %s%d.%02d%%/min\n", lang_get(LANG_PROCFS_FORECAST_TREND),
+                      trend < 0 ? "-" : "+", abs(trend) / 100, abs(trend) % 100);
+            seq_printf(seq, "  %s:", lang_get(LANG_PROCFS_FORECAST_TIME_TO));
+            for (i = MOEAI_STATE_WARNING; i <= MOEAI_STATE_EMERGENCY; i++) {
+                if (forecast.time_to_ms[i] == MOEAI_MEM_FORECAST_NEVER)
+                    seq_printf(seq, " %s=-", moeai_mem_state_name(i));
+                else
+                    seq_printf(seq, " %s=%u s", moeai_mem_state_name(i), forecast.time_to_ms[i] / 1000);
+            }
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: %u.%02u%%\n", lang_get(LANG_PROCFS_FORECAST_MAE),
+                      forecast.mae_centi / 100, forecast.mae_centi % 100);
+            seq_printf(seq, "  %s: predictions=%llu hits=%llu false_alarms=%llu misses=%llu\n",
+                      lang_get(LANG_PROCFS_FORECAST_ACCURACY), forecast.predictions,
+                      forecast.hits, forecast.false_alarms, forecast.misses);
+            seq_printf(seq, "  %s: %llu\n\n", lang_get(LANG_PROCFS_FORECAST_TRIGGERS), forecast.triggers);
+        }
+    }
+    
+    /* 输出NUMA节点内存状态 */
+    {
+        struct moeai_mem_node_stats *nodes;
+        int nr_nodes;
+        
+        nodes = kmalloc_array(MOEAI_MEM_MAX_NODES, sizeof(*nodes), GFP_KERNEL);
+        if (nodes) {
+            nr_nodes = moeai_mem_monitor_get_node_stats(nodes, MOEAI_MEM_MAX_NODES);
+            if (nr_nodes > 0) {
+                seq_puts(seq, lang_get(LANG_PROCFS_NUMA_NODES));
+                seq_puts(seq, "\n");
+                seq_puts(seq, lang_get(LANG_PROCFS_NUMA_TABLE_HEADER));
+                seq_puts(seq, "\n");
+                for (i = 0; i < nr_nodes; i++)
+                    seq_printf(seq, "  %4d %12lu %12lu %12lu %12lu %12lu %5u%%  %-9s %9llu %14ld\n",
+                              nodes[i].nid, nodes[i].total_ram, nodes[i].free_ram,
+                              nodes[i].available_ram, nodes[i].file_ram, nodes[i].anon_ram,
+                              nodes[i].mem_usage_percent, moeai_mem_state_name(nodes[i].state),
+                              nodes[i].reclaim_runs, nodes[i].last_reclaimed_kb);
+                if (!moeai_mem_node_reclaim_supported())
+                    seq_printf(seq, "%s\n", lang_get(LANG_PROCFS_NODE_RECLAIM_UNSUPPORTED));
+                seq_puts(seq, "\n");
+            }
+            kfree(nodes);
+        }
+    }
+    
+    /* 输出内存碎片状态 */
+    {
+        struct moeai_frag_zone_stats *zones;
+        struct moeai_frag_config frag_config;
+        int nr_zones, o;
+        
+        zones = kmalloc_array(MOEAI_FRAG_MAX_ZONES, sizeof(*zones), GFP_KERNEL);
+        if (zones && moeai_mem_frag_get_config(&frag_config) == 0) {
+            nr_zones = moeai_mem_frag_get_stats(zones, MOEAI_FRAG_MAX_ZONES);
+            seq_puts(seq, lang_get(LANG_PROCFS_FRAGMENTATION));
+            seq_puts(seq, "\n");
+            seq_printf(seq, "  %s: order=%u min_percent=%u%% index=%d cooldown=%u ms zones=%u\n",
+                      lang_get(LANG_PROCFS_FRAG_CONFIG), frag_config.order,
+                      frag_config.min_high_order_percent, frag_config.index_threshold,
+                      frag_config.compact_cooldown_ms, frag_config.max_zones_per_run);
+            for (i = 0; i < nr_zones; i++) {
+                seq_printf(seq, "  Node %d, zone %8s", zones[i].nid, zones[i].zone_name);
+                for (o = 0; o < MOEAI_FRAG_NR_ORDERS; o++)
+                    seq_printf(seq, " %6lu", zones[i].nr_free[o]);
+                seq_puts(seq, "\n");
+                seq_printf(seq, "    %s: %u%%  %s(%u): %d.%03d  %s: %llu (%lu -> %lu)\n",
+                          lang_get(LANG_PROCFS_FRAG_HIGH_ORDER), zones[i].high_order_percent,
+                          lang_get(LANG_PROCFS_FRAG_INDEX), frag_config.order,
+                          zones[i].frag_index[frag_config.order] / 1000,
+                          abs(zones[i].frag_index[frag_config.order]) % 1000,
+                          lang_get(LANG_PROCFS_FRAG_COMPACT_RUNS), zones[i].compact_runs,
+                          zones[i].last_before, zones[i].last_after);
+            }
+            seq_puts(seq, "\n");
+        }
+        kfree(zones);
+    }
+    
+    /* 输出突发采样状态 */
+    {
+        struct moeai_mem_burst_info burst;
+        
+        if (moeai_mem_burst_get_info(&burst) == 0 && burst.capacity > 0) {
+            seq_printf(seq, "%s %s, interval=%u us duration=%u ms samples=%u/%u%s\n",
+                      lang_get(LANG_PROCFS_BURST),
+                      burst.active ? lang_get(LANG_PROCFS_BURST_RUNNING) :
+                                     lang_get(LANG_PROCFS_BURST_FINISHED),
+                      burst.interval_us, burst.duration_ms, burst.samples, burst.capacity,
+                      burst.truncated ? " (truncated)" : "");
+        }
+    }
+    
     return 0;
 }
 
@@ -538,90 +1472,313 @@ static const struct proc_ops moeai_procfs_status_fops = {
 };
 
 /**
- * 控制文件的write回调
+ * 突发采样导出文件的read回调
  */
-static ssize_t moeai_procfs_control_write(struct file *file, const char __user *user_buf,
+static ssize_t moeai_procfs_burst_read(struct file *file, char __user *buf,
+                                       size_t count, loff_t *ppos)
+{
+    return moeai_mem_burst_read(buf, count, ppos);
+}
+
+static const struct proc_ops moeai_procfs_burst_fops = {
+    .proc_read = moeai_procfs_burst_read,
+    .proc_lseek = default_llseek,
+};
+
+/**
+ * 二进制统计文件的show回调
+ * 打开时编码一次，分多次读取也不会读到不同时刻的数据
+ */
+static int moeai_procfs_stats_bin_show(struct seq_file *seq, void *v)
+{
+    struct moeai_stats_blob *blob;
+    int ret;
+
+    blob = kmalloc(sizeof(*blob), GFP_KERNEL);
+    if (!blob)
+        return -ENOMEM;
+
+    ret = moeai_stats_encode(blob);
+    if (ret == 0)
+        seq_write(seq, blob, sizeof(*blob));
+
+    kfree(blob);
+    return ret;
+}
+
+static int moeai_procfs_stats_bin_open(struct inode *inode, struct file *file)
+{
+    return single_open_size(file, moeai_procfs_stats_bin_show, NULL,
+                            sizeof(struct moeai_stats_blob));
+}
+
+static const struct proc_ops moeai_procfs_stats_bin_fops = {
+    .proc_open = moeai_procfs_stats_bin_open,
+    .proc_read = seq_read,
+    .proc_lseek = seq_lseek,
+    .proc_release = single_release,
+};
+
+/* 实时页只能映射，不能读写 */
+static int moeai_procfs_live_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    return moeai_live_mmap(vma);
+}
+
+static const struct proc_ops moeai_procfs_live_fops = {
+    .proc_mmap = moeai_procfs_live_mmap,
+};
+
+/* 一行事件的最大长度，read 的缓冲区至少要能容纳一行 */
+#define MOEAI_EVENTS_LINE_LEN 128
+/* 每次从事件中心取出的事件数 */
+#define MOEAI_EVENTS_BATCH    16
+
+/* 每个打开的事件文件记录已读到的代数，打开之前的事件不会读到 */
+struct moeai_events_reader {
+    struct mutex lock;
+    u64 seen;
+};
+
+/*
+ * 格式化一条事件: "<代数> <时间(ns，单调时钟)> <类型> key=value ..."
+ * 字段固定为英文，便于程序解析
+ */
+static int moeai_events_format(const struct moeai_hub_event *ev, char *buf, size_t size)
+{
+    switch (ev->type) {
+    case MOEAI_HUB_STATE_CHANGE:
+        return scnprintf(buf, size, "%llu %llu state from=%s to=%s usage=%lld\n",
+                         ev->seq, ev->time_ns, moeai_mem_state_key(ev->from),
+                         moeai_mem_state_key(ev->to), ev->value);
+    case MOEAI_HUB_RECLAIM_DONE:
+        return scnprintf(buf, size, "%llu %llu reclaim policy=%s freed_kb=%lld\n",
+                         ev->seq, ev->time_ns, moeai_mem_policy_key(ev->from), ev->value);
+    case MOEAI_HUB_NODE_RECLAIM_DONE:
+        return scnprintf(buf, size, "%llu %llu node_reclaim node=%d freed_kb=%lld\n",
+                         ev->seq, ev->time_ns, ev->from, ev->value);
+    case MOEAI_HUB_LOG_WARN:
+        return scnprintf(buf, size, "%llu %llu log level=%s\n",
+                         ev->seq, ev->time_ns, moeai_log_level_key(ev->from));
+    default:
+        return scnprintf(buf, size, "%llu %llu unknown type=%u\n",
+                         ev->seq, ev->time_ns, ev->type);
+    }
+}
+
+static int moeai_procfs_events_open(struct inode *inode, struct file *file)
+{
+    struct moeai_events_reader *reader;
+
+    reader = kmalloc(sizeof(*reader), GFP_KERNEL);
+    if (!reader)
+        return -ENOMEM;
+
+    mutex_init(&reader->lock);
+    reader->seen = moeai_event_hub_seq();
+    file->private_data = reader;
+    return stream_open(inode, file);
+}
+
+/*
+ * 读取打开以来的新事件，没有新事件时阻塞 (O_NONBLOCK 时返回 -EAGAIN)
+ * 读者落后太多时先输出一行 "<代数> 0 lost count=N"；模块卸载时返回0 (文件结束)
+ */
+static ssize_t moeai_procfs_events_read(struct file *file, char __user *ubuf,
                                         size_t count, loff_t *ppos)
 {
-    char buf[MOEAI_MAX_CMD_LEN];
-    size_t buf_size = min(count, sizeof(buf) - 1);
-    
-    /* 复制用户数据 */
-    if (copy_from_user(buf, user_buf, buf_size))
-        return -EFAULT;
-    
-    /* 确保字符串结束 */
-    buf[buf_size] = '\0';
-    
-    /* 处理命令 */
-    if (strncmp(buf, "reclaim", 7) == 0) {
-        /* 执行内存回收 */
-        long reclaimed = moeai_mem_reclaim(MOEAI_MEM_RECLAIM_MODERATE);
-        MOEAI_INFO(MODULE_NAME, "%s %ld KB", 
-                  lang_get(LANG_CLI_MSG_RECLAIM_COMPLETE), reclaimed);
-    } 
-    else if (strncmp(buf, "selftest", 8) == 0) {
-        /* 执行自检 */
-        moeai_trigger_selftest();
-        MOEAI_INFO(MODULE_NAME, "%s", lang_get(LANG_CLI_MSG_SELFTEST_RESULT));
-    }
-    else if (strncmp(buf, "set threshold ", 13) == 0) {
-        /* 设置阈值 */
-        unsigned int threshold;
-        if (kstrtouint(buf + 13, 10, &threshold) == 0) {
-            struct moeai_mem_monitor_config config;
-            moeai_mem_monitor_get_config(&config);
-            config.warn_threshold = threshold;
-            config.critical_threshold = threshold + 10;
-            config.emergency_threshold = threshold + 20;
-            moeai_mem_monitor_set_config(&config);
-            MOEAI_INFO(MODULE_NAME, "%s %u%%", 
-                      lang_get(LANG_CLI_MSG_SET_THRESHOLD), threshold);
+    struct moeai_events_reader *reader = file->private_data;
+    struct moeai_hub_event events[MOEAI_EVENTS_BATCH];
+    size_t size = min_t(size_t, count, PAGE_SIZE);
+    size_t len = 0;
+    char *kbuf;
+    u64 lost;
+    int n, i;
+    ssize_t ret;
+
+    if (count < MOEAI_EVENTS_LINE_LEN)
+        return -EINVAL;
+
+    kbuf = kmalloc(size, GFP_KERNEL);
+    if (!kbuf)
+        return -ENOMEM;
+
+    mutex_lock(&reader->lock);
+    for (;;) {
+        n = moeai_event_hub_read(reader->seen, events, MOEAI_EVENTS_BATCH, &lost);
+        if (n > 0)
+            break;
+        if (moeai_event_hub_is_shutdown()) {
+            ret = 0;
+            goto out;
         }
-    }
-    else if (strncmp(buf, "set interval ", 13) == 0) {
-        /* 设置检查间隔 */
-        unsigned int interval;
-        if (kstrtouint(buf + 13, 10, &interval) == 0) {
-            struct moeai_mem_monitor_config config;
-            moeai_mem_monitor_get_config(&config);
-            config.check_interval_ms = interval;
-            moeai_mem_monitor_set_config(&config);
-            MOEAI_INFO(MODULE_NAME, "%s %u ms", 
-                      lang_get(LANG_CLI_MSG_SET_INTERVAL), interval);
+        if (file->f_flags & O_NONBLOCK) {
+            ret = -EAGAIN;
+            goto out;
         }
+        ret = moeai_event_hub_wait(reader->seen);
+        if (ret)
+            goto out;
     }
-    else if (strncmp(buf, "set autoreclaim ", 16) == 0) {
-        /* 设置自动回收 */
-        if (strncmp(buf + 16, "on", 2) == 0 || strncmp(buf + 16, "true", 4) == 0) {
-            struct moeai_mem_monitor_config config;
-            moeai_mem_monitor_get_config(&config);
-            config.auto_reclaim = true;
-            moeai_mem_monitor_set_config(&config);
-            MOEAI_INFO(MODULE_NAME, "%s %s", 
-                      lang_get(LANG_CLI_MSG_SET_AUTORECLAIM),
-                      lang_get(LANG_PROCFS_AUTO_RECLAIM_ON));
-        } else if (strncmp(buf + 16, "off", 3) == 0 || strncmp(buf + 16, "false", 5) == 0) {
-            struct moeai_mem_monitor_config config;
-            moeai_mem_monitor_get_config(&config);
-            config.auto_reclaim = false;
-            moeai_mem_monitor_set_config(&config);
-            MOEAI_INFO(MODULE_NAME, "%s %s", 
-                      lang_get(LANG_CLI_MSG_SET_AUTORECLAIM),
-                      lang_get(LANG_PROCFS_AUTO_RECLAIM_OFF));
-        }
+
+    if (lost) {
+        len += scnprintf(kbuf, size, "%llu 0 lost count=%llu\n", events[0].seq - 1, lost);
+        reader->seen = events[0].seq - 1;
+    }
+    for (i = 0; i < n && size - len >= MOEAI_EVENTS_LINE_LEN; i++) {
+        len += moeai_events_format(&events[i], kbuf + len, size - len);
+        reader->seen = events[i].seq;
     }
-    else {
-        MOEAI_WARN(MODULE_NAME, "%s: %s", 
-                  lang_get(LANG_CLI_ERR_UNKNOWN_CMD), buf);
+
+    ret = copy_to_user(ubuf, kbuf, len) ? -EFAULT : len;
+out:
+    mutex_unlock(&reader->lock);
+    kfree(kbuf);
+    return ret;
+}
+
+static __poll_t moeai_procfs_events_poll(struct file *file, poll_table *wait)
+{
+    struct moeai_events_reader *reader = file->private_data;
+
+    return moeai_event_hub_poll(file, wait, READ_ONCE(reader->seen));
+}
+
+static int moeai_procfs_events_release(struct inode *inode, struct file *file)
+{
+    kfree(file->private_data);
+    return 0;
+}
+
+static const struct proc_ops moeai_procfs_events_fops = {
+    .proc_open = moeai_procfs_events_open,
+    .proc_read = moeai_procfs_events_read,
+    .proc_poll = moeai_procfs_events_poll,
+    .proc_release = moeai_procfs_events_release,
+};
+
+/* 输出一张进程排行表 */
+static void moeai_procfs_show_rss(struct seq_file *seq, const struct moeai_rss_entry *entries,
+                                  unsigned int n)
+{
+    unsigned int i;
+    
+    seq_puts(seq, lang_get(LANG_PROCFS_TOP_MEM_TABLE_HEADER));
+    seq_puts(seq, "\n");
+    for (i = 0; i < n; i++)
+        seq_printf(seq, "  %8d  %-16s %12lu %12ld\n", entries[i].pid, entries[i].comm,
+                  entries[i].rss_kb, entries[i].growth_kb_s);
+}
+
+/**
+ * 进程内存排行文件的show回调
+ * 只输出最近一轮遍历发布的排行，读取开销与进程总数无关
+ */
+static int moeai_procfs_top_mem_show(struct seq_file *seq, void *v)
+{
+    struct moeai_rss_top *top;
+    
+    top = kmalloc(sizeof(*top), GFP_KERNEL);
+    if (!top)
+        return -ENOMEM;
+    
+    if (moeai_rss_get_top(top) == 0) {
+        seq_printf(seq, "%s: passes=%llu last_pass=%u ms tracked=%u dropped=%llu\n\n",
+                  lang_get(LANG_PROCFS_TOP_MEM), top->passes, top->last_pass_ms,
+                  top->tracked, top->dropped);
+        if (!top->passes) {
+            seq_printf(seq, "%s\n", lang_get(LANG_PROCFS_TOP_MEM_PENDING));
+        } else {
+            seq_printf(seq, "%s:\n", lang_get(LANG_PROCFS_TOP_MEM_BY_RSS));
+            moeai_procfs_show_rss(seq, top->by_rss, top->nr_rss);
+            seq_printf(seq, "\n%s:\n", lang_get(LANG_PROCFS_TOP_MEM_BY_GROWTH));
+            moeai_procfs_show_rss(seq, top->by_growth, top->nr_growth);
+        }
     }
     
-    /* 返回处理的数据大小 */
-    return count;
+    kfree(top);
+    return 0;
+}
+
+static int moeai_procfs_top_mem_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, moeai_procfs_top_mem_show, NULL);
+}
+
+static const struct proc_ops moeai_procfs_top_mem_fops = {
+    .proc_open = moeai_procfs_top_mem_open,
+    .proc_read = seq_read,
+    .proc_lseek = seq_lseek,
+    .proc_release = single_release,
+};
+
+/**
+ * 控制文件的open回调
+ * 每个打开的文件保存自己最近一次写入的执行结果，读取同一个文件即可得到
+ */
+static int moeai_procfs_control_open(struct inode *inode, struct file *file)
+{
+    file->private_data = kzalloc(MOEAI_CTL_RESULT_LEN, GFP_KERNEL);
+    return file->private_data ? 0 : -ENOMEM;
+}
+
+/**
+ * 控制文件的write回调
+ * 一次写入可包含以换行分隔的多条命令，作为一个批执行
+ */
+static ssize_t moeai_procfs_control_write(struct file *file, const char __user *user_buf,
+                                        size_t count, loff_t *ppos)
+{
+    char *batch;
+    int ret;
+    
+    /*
+     * 命令会回收其他 cgroup 的内存、触发压缩和登记 eventfd，只允许管理员执行。
+     * 检查的是打开文件者的凭据，避免特权进程被诱导写入他人打开的描述符
+     */
+    if (!file_ns_capable(file, &init_user_ns, CAP_SYS_ADMIN))
+        return -EPERM;
+    
+    if (count > MOEAI_CTL_MAX_BATCH)
+        return -E2BIG;
+    
+    batch = memdup_user_nul(user_buf, count);
+    if (IS_ERR(batch))
+        return PTR_ERR(batch);
+    
+    ret = moeai_control_run(batch, file->private_data, MOEAI_CTL_RESULT_LEN, file);
+    kfree(batch);
+    
+    /* 之后的读取从头返回本次的执行结果 */
+    *ppos = 0;
+    return ret ? ret : count;
+}
+
+/**
+ * 控制文件的read回调，返回最近一次写入的逐条执行结果
+ */
+static ssize_t moeai_procfs_control_read(struct file *file, char __user *buf,
+                                         size_t count, loff_t *ppos)
+{
+    const char *result = file->private_data;
+    
+    return simple_read_from_buffer(buf, count, ppos, result, strlen(result));
+}
+
+static int moeai_procfs_control_release(struct inode *inode, struct file *file)
+{
+    /* 通过本文件登记的 eventfd 随文件关闭注销 */
+    moeai_event_hub_notify_release(file);
+    kfree(file->private_data);
+    return 0;
 }
 
 static const struct proc_ops moeai_procfs_control_fops = {
+    .proc_open = moeai_procfs_control_open,
+    .proc_read = moeai_procfs_control_read,
     .proc_write = moeai_procfs_control_write,
+    .proc_lseek = default_llseek,
+    .proc_release = moeai_procfs_control_release,
 };
 
 /**
@@ -714,6 +1871,10 @@ int moeai_procfs_init(void)
     /* 保存根目录指针 */
     moeai_procfs_root = root;
     
+    /* 注册控制命令 */
+    if (moeai_control_init())
+        goto err_status;
+    
     /* 创建状态文件 */
     status_entry = proc_create(MOEAI_PROCFS_STATUS, 0444, root, 
                              &moeai_procfs_status_fops);
@@ -723,7 +1884,7 @@ int moeai_procfs_init(void)
     }
     
     /* 创建控制文件 */
-    control_entry = proc_create(MOEAI_PROCFS_CONTROL, 0222, root,
+    control_entry = proc_create(MOEAI_PROCFS_CONTROL, 0600, root,
                               &moeai_procfs_control_fops);
     if (!control_entry) {
         MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_CONTROL));
@@ -746,9 +1907,76 @@ int moeai_procfs_init(void)
         goto err_selftest;
     }
     
+    /* 创建突发采样导出文件 */
+    burst_entry = proc_create(MOEAI_PROCFS_BURST, 0444, root,
+                             &moeai_procfs_burst_fops);
+    if (!burst_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_BURST));
+        goto err_burst;
+    }
+    
+    /* 创建进程内存排行文件，其中包含所有进程的 pid、命令名和内存用量，只对 root 可读 */
+    top_mem_entry = proc_create(MOEAI_PROCFS_TOP_MEM, 0400, root,
+                               &moeai_procfs_top_mem_fops);
+    if (!top_mem_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_TOP_MEM));
+        goto err_top_mem;
+    }
+    
+    /* 创建二进制统计文件 */
+    stats_bin_entry = proc_create(MOEAI_PROCFS_STATS_BIN, 0444, root,
+                                 &moeai_procfs_stats_bin_fops);
+    if (!stats_bin_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_STATS_BIN));
+        goto err_stats_bin;
+    }
+    
+    /* 创建 Prometheus 指标文件 */
+    metrics_entry = proc_create(MOEAI_PROCFS_METRICS, 0444, root, &moeai_metrics_fops);
+    if (!metrics_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_METRICS));
+        goto err_metrics;
+    }
+    
+    /* 创建事件文件 */
+    events_entry = proc_create(MOEAI_PROCFS_EVENTS, 0444, root, &moeai_procfs_events_fops);
+    if (!events_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_EVENTS));
+        goto err_events;
+    }
+    
+    /* 创建实时共享页文件 */
+    live_entry = proc_create(MOEAI_PROCFS_LIVE, 0444, root, &moeai_procfs_live_fops);
+    if (!live_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_LIVE));
+        goto err_live;
+    }
+    
+    /* 创建二进制自检历史文件 */
+    selftest_bin_entry = proc_create(MOEAI_PROCFS_SELFTEST_BIN, 0444, root,
+                                    &moeai_procfs_selftest_bin_fops);
+    if (!selftest_bin_entry) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_PROCFS_ERR_CREATE_SELFTEST_BIN));
+        goto err_selftest_bin;
+    }
+    
     MOEAI_INFO(MODULE_NAME, "%s", lang_get(LANG_PROCFS_INIT_SUCCESS));
     return 0;
     
+err_selftest_bin:
+    proc_remove(live_entry);
+err_live:
+    proc_remove(events_entry);
+err_events:
+    proc_remove(metrics_entry);
+err_metrics:
+    proc_remove(stats_bin_entry);
+err_stats_bin:
+    proc_remove(top_mem_entry);
+err_top_mem:
+    proc_remove(burst_entry);
+err_burst:
+    proc_remove(selftest_entry);
 err_selftest:
     proc_remove(log_entry);
 err_log:
@@ -756,6 +1984,7 @@ err_log:
 err_control:
     proc_remove(status_entry);
 err_status:
+    moeai_control_exit();
     proc_remove(root);
     moeai_procfs_root = NULL;
     return -ENOMEM;
@@ -769,18 +1998,46 @@ void moeai_procfs_exit(void)
     if (!moeai_procfs_root)
         return;
     
+    /* 等待正在运行的自检结束，唤醒仍在 poll 的读者 */
+    cancel_work_sync(&selftest_work);
+    wake_up_interruptible_all(&selftest_wait);
+    
+    /* 阻塞在事件文件上的读者持有条目的使用引用，先让它们返回，proc_remove 才不会一直等待 */
+    moeai_event_hub_shutdown();
+    
     /* 删除所有条目 */
+    proc_remove(selftest_bin_entry);
+    proc_remove(live_entry);
+    proc_remove(events_entry);
+    proc_remove(metrics_entry);
+    proc_remove(stats_bin_entry);
+    proc_remove(top_mem_entry);
+    proc_remove(burst_entry);
     proc_remove(selftest_entry);
     proc_remove(log_entry);
     proc_remove(control_entry);
     proc_remove(status_entry);
     proc_remove(moeai_procfs_root);
+    moeai_control_exit();
     
     moeai_procfs_root = NULL;
     status_entry = NULL;
     control_entry = NULL;
     log_entry = NULL;
     selftest_entry = NULL;
+    burst_entry = NULL;
+    top_mem_entry = NULL;
+    stats_bin_entry = NULL;
+    metrics_entry = NULL;
+    events_entry = NULL;
+    live_entry = NULL;
+    selftest_bin_entry = NULL;
+    
+    /* 已打开的读者各自持有运行的引用，此处只释放模块自己的引用 */
+    moeai_selftest_run_put(selftest_current);
+    selftest_current = NULL;
+    moeai_selftest_clear_history();
+    selftest_running = false;
     
     MOEAI_INFO(MODULE_NAME, "%s", lang_get(LANG_PROCFS_EXIT_COMPLETE));
 }
@@ -16,6 +16,7 @@
 #include "../include/utils/logger.h"
 #include "../include/ipc/procfs_interface.h"
 #include "../include/utils/lang.h"
+#include "../include/data/live.h"
 
 /* 模块参数 */
 static bool debug_mode = false;
@@ -63,6 +64,13 @@ static int __init moeai_init(void)
         return ret;
     }
     
+    /* 初始化实时共享页，监控启动后每次检查都会更新 */
+    ret = moeai_live_init();
+    if (ret) {
+        pr_err("%s %d\n", lang_get(LANG_ERR_LIVE_INIT_FAILED), ret);
+        goto err_live;
+    }
+    
     /* 初始化内存监控模块 */
     ret = moeai_mem_monitor_init();
     if (ret) {
@@ -92,6 +100,8 @@ err_mem_start:
 err_procfs:
     moeai_mem_monitor_exit();
 err_mem_monitor:
+    moeai_live_exit();
+err_live:
     moeai_logger_exit();
     return ret;
 }
@@ -110,6 +120,9 @@ static void __exit moeai_exit(void)
     /* 清理内存监控模块 */
     moeai_mem_monitor_exit();
     
+    /* 释放实时共享页 */
+    moeai_live_exit();
+    
     /* 清理日志系统 */
     moeai_logger_exit();
     
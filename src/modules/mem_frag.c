@@ -0,0 +1,406 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/mem_frag.c
+ * 描述: 内存碎片监控与主动规整
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/mmzone.h>
+#include <linux/nodemask.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/fs.h>
+#include <linux/math64.h>
+#include "../../include/modules/mem_frag.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "mem_frag"
+
+/* 区域记录，按 [节点][区域] 固定槽位保存，节点上下线不会打乱计数 */
+struct moeai_mem_frag_zone {
+    struct moeai_frag_zone_stats stats;
+    bool present;                   /* 区域存在且有内存 */
+    bool selected;                  /* 已选中等待规整 */
+    bool compacted_once;
+    unsigned long last_compact;     /* 上次规整时间 (jiffies) */
+    unsigned long before;           /* 规整前不低于关注阶数的空闲块数 */
+};
+
+/* 碎片监控私有数据 */
+struct moeai_mem_frag_private {
+    struct moeai_frag_config config;
+    struct moeai_mem_frag_zone zones[MOEAI_FRAG_MAX_NODES][MAX_NR_ZONES];
+    nodemask_t pending;             /* 等待规整的节点 */
+    struct work_struct compact_work; /* 写 sysfs 会睡眠，规整放到工作队列中执行 */
+    spinlock_t lock;
+};
+
+static struct moeai_mem_frag_private *frag_priv;
+
+/*
+ * 碎片化指数，与内核 __fragmentation_index 的定义一致
+ * 接近0表示分配失败是因为内存不足，接近1000表示是因为碎片；
+ * 存在满足要求的空闲块时返回-1000。
+ */
+static int moeai_mem_frag_index(const unsigned long *nr_free, unsigned int order)
+{
+    unsigned long requested = 1UL << order;
+    unsigned long total = 0, suitable = 0, free_pages = 0;
+    unsigned int o;
+
+    for (o = 0; o < MOEAI_FRAG_NR_ORDERS; o++) {
+        total += nr_free[o];
+        free_pages += nr_free[o] << o;
+        if (o >= order)
+            suitable += nr_free[o] << (o - order);
+    }
+
+    if (!total)
+        return 0;
+    if (suitable)
+        return -1000;
+
+    return 1000 - div_u64(1000 + div_u64(free_pages * 1000ULL, requested), total);
+}
+
+/* 不低于指定阶数的空闲块数 */
+static unsigned long moeai_mem_frag_high_blocks(const unsigned long *nr_free, unsigned int order)
+{
+    unsigned long blocks = 0;
+    unsigned int o;
+
+    for (o = order; o < MOEAI_FRAG_NR_ORDERS; o++)
+        blocks += nr_free[o];
+
+    return blocks;
+}
+
+/*
+ * 采集单个区域的空闲块分布
+ * 与 /proc/buddyinfo 不同，这里不持有 zone->lock，读到的是近似值
+ */
+static void moeai_mem_frag_collect_zone(struct moeai_mem_frag_zone *z, int nid,
+                                        struct zone *zone, unsigned int order)
+{
+    struct moeai_frag_zone_stats *st = &z->stats;
+    unsigned long high_pages = 0;
+    unsigned int o;
+
+    st->nid = nid;
+    st->zone_name = zone->name;
+    st->free_pages = 0;
+    for (o = 0; o < MOEAI_FRAG_NR_ORDERS; o++) {
+        st->nr_free[o] = READ_ONCE(zone->free_area[o].nr_free);
+        st->free_pages += st->nr_free[o] << o;
+        if (o >= order)
+            high_pages += st->nr_free[o] << o;
+    }
+    for (o = 0; o < MOEAI_FRAG_NR_ORDERS; o++)
+        st->frag_index[o] = moeai_mem_frag_index(st->nr_free, o);
+
+    st->high_order_percent = st->free_pages ?
+        div64_u64((u64)high_pages * 100, st->free_pages) : 0;
+    z->present = true;
+}
+
+/* 遍历所有在线节点的区域，调用者持有 lock */
+static void moeai_mem_frag_collect(struct moeai_mem_frag_private *priv)
+{
+    int nid, zid;
+
+    for (nid = 0; nid < MOEAI_FRAG_MAX_NODES; nid++) {
+        for (zid = 0; zid < MAX_NR_ZONES; zid++) {
+            struct zone *zone;
+
+            priv->zones[nid][zid].present = false;
+            if (!node_online(nid))
+                continue;
+            zone = &NODE_DATA(nid)->node_zones[zid];
+            if (!populated_zone(zone))
+                continue;
+            moeai_mem_frag_collect_zone(&priv->zones[nid][zid], nid, zone,
+                                        priv->config.order);
+        }
+    }
+}
+
+/*
+ * 判断区域是否需要规整
+ * 高阶可用比例低于阈值，且碎片化指数说明问题出在碎片而不是内存不足
+ */
+static bool moeai_mem_frag_eligible(const struct moeai_mem_frag_private *priv,
+                                    const struct moeai_mem_frag_zone *z)
+{
+    const struct moeai_frag_config *config = &priv->config;
+    int index = z->stats.frag_index[config->order];
+
+    if (!z->present || z->selected)
+        return false;
+    if (z->stats.high_order_percent >= config->min_high_order_percent)
+        return false;
+    if (index >= 0 && index < config->index_threshold)
+        return false;
+    if (z->compacted_once &&
+        time_before(jiffies, z->last_compact + msecs_to_jiffies(config->compact_cooldown_ms)))
+        return false;
+
+    return true;
+}
+
+/*
+ * 选出高阶可用比例最低的若干区域，标记其所在节点等待规整
+ * 返回值: 是否有节点需要规整
+ */
+static bool moeai_mem_frag_select(struct moeai_mem_frag_private *priv)
+{
+    unsigned int picked;
+    bool queue = false;
+
+    for (picked = 0; picked < priv->config.max_zones_per_run; picked++) {
+        struct moeai_mem_frag_zone *worst = NULL;
+        int nid, zid;
+
+        for (nid = 0; nid < MOEAI_FRAG_MAX_NODES; nid++) {
+            for (zid = 0; zid < MAX_NR_ZONES; zid++) {
+                struct moeai_mem_frag_zone *z = &priv->zones[nid][zid];
+
+                if (!moeai_mem_frag_eligible(priv, z))
+                    continue;
+                if (!worst || z->stats.high_order_percent < worst->stats.high_order_percent)
+                    worst = z;
+            }
+        }
+        if (!worst)
+            break;
+
+        worst->selected = true;
+        worst->compacted_once = true;
+        worst->last_compact = jiffies;
+        node_set(worst->stats.nid, priv->pending);
+        queue = true;
+    }
+
+    return queue;
+}
+
+/*
+ * 通过 sysfs/procfs 触发规整
+ * 模块无法直接调用 compact_node，按节点规整写 /sys/devices/system/node/nodeN/compact，
+ * 全局规整或没有节点接口时写 /proc/sys/vm/compact_memory
+ */
+static int moeai_mem_frag_trigger(int nid)
+{
+#ifdef CONFIG_COMPACTION
+    char path[64];
+    struct file *filp;
+    loff_t pos = 0;
+    ssize_t ret;
+
+    if (nid >= 0) {
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/compact", nid);
+        filp = filp_open(path, O_WRONLY, 0);
+        if (!IS_ERR(filp))
+            goto write;
+    }
+
+    filp = filp_open("/proc/sys/vm/compact_memory", O_WRONLY, 0);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+
+write:
+    ret = kernel_write(filp, "1", 1, &pos);
+    filp_close(filp, NULL);
+    return ret < 0 ? ret : 0;
+#else
+    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_COMPACT_NOT_SUPPORTED));
+    return -EOPNOTSUPP;
+#endif
+}
+
+/*
+ * 规整节点并报告前后的高阶空闲块数
+ * @nid: 目标节点，负值表示所有节点
+ * @selected_only: 只报告被自动选中的区域
+ */
+static int moeai_mem_frag_run(struct moeai_mem_frag_private *priv, int nid, bool selected_only)
+{
+    unsigned int order;
+    int n, zid, ret;
+
+    spin_lock_bh(&priv->lock);
+    order = priv->config.order;
+    moeai_mem_frag_collect(priv);
+    for (n = 0; n < MOEAI_FRAG_MAX_NODES; n++) {
+        for (zid = 0; zid < MAX_NR_ZONES; zid++) {
+            struct moeai_mem_frag_zone *z = &priv->zones[n][zid];
+
+            z->before = moeai_mem_frag_high_blocks(z->stats.nr_free, order);
+        }
+    }
+    spin_unlock_bh(&priv->lock);
+
+    ret = moeai_mem_frag_trigger(nid);
+    if (ret)
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_COMPACT_FAILED), nid, ret);
+
+    spin_lock_bh(&priv->lock);
+    moeai_mem_frag_collect(priv);
+    for (n = 0; n < MOEAI_FRAG_MAX_NODES; n++) {
+        if (nid >= 0 && n != nid)
+            continue;
+        for (zid = 0; zid < MAX_NR_ZONES; zid++) {
+            struct moeai_mem_frag_zone *z = &priv->zones[n][zid];
+
+            if (!z->present || (selected_only && !z->selected))
+                continue;
+
+            z->selected = false;
+            if (ret)
+                continue;
+            z->stats.compact_runs++;
+            z->stats.last_before = z->before;
+            z->stats.last_after = moeai_mem_frag_high_blocks(z->stats.nr_free, order);
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_COMPACT_RESULT), n, z->stats.zone_name,
+                    order, z->stats.last_before, z->stats.last_after);
+        }
+    }
+    spin_unlock_bh(&priv->lock);
+
+    return ret;
+}
+
+/**
+ * 规整工作
+ * @work: 工作结构体指针
+ */
+static void moeai_mem_frag_compact_work(struct work_struct *work)
+{
+    struct moeai_mem_frag_private *priv =
+        container_of(work, struct moeai_mem_frag_private, compact_work);
+    nodemask_t pending;
+    int nid;
+
+    spin_lock_bh(&priv->lock);
+    pending = priv->pending;
+    nodes_clear(priv->pending);
+    spin_unlock_bh(&priv->lock);
+
+    for_each_node_mask(nid, pending)
+        moeai_mem_frag_run(priv, nid, true);
+}
+
+void moeai_mem_frag_check(bool allow_compact)
+{
+    bool queue = false;
+
+    if (!frag_priv)
+        return;
+
+    spin_lock_bh(&frag_priv->lock);
+    moeai_mem_frag_collect(frag_priv);
+    if (allow_compact)
+        queue = moeai_mem_frag_select(frag_priv);
+    spin_unlock_bh(&frag_priv->lock);
+
+    if (queue)
+        queue_work(system_unbound_wq, &frag_priv->compact_work);
+}
+
+int moeai_mem_frag_compact(int nid)
+{
+    if (!frag_priv)
+        return -EINVAL;
+    if (nid >= MOEAI_FRAG_MAX_NODES || (nid >= 0 && !node_online(nid)))
+        return -EINVAL;
+
+    return moeai_mem_frag_run(frag_priv, nid, false);
+}
+
+int moeai_mem_frag_get_stats(struct moeai_frag_zone_stats *zones, int max_zones)
+{
+    int nid, zid, count = 0;
+
+    if (!frag_priv || !zones || max_zones <= 0)
+        return -EINVAL;
+
+    spin_lock_bh(&frag_priv->lock);
+    for (nid = 0; nid < MOEAI_FRAG_MAX_NODES && count < max_zones; nid++) {
+        for (zid = 0; zid < MAX_NR_ZONES && count < max_zones; zid++) {
+            if (frag_priv->zones[nid][zid].present)
+                zones[count++] = frag_priv->zones[nid][zid].stats;
+        }
+    }
+    spin_unlock_bh(&frag_priv->lock);
+
+    return count;
+}
+
+int moeai_mem_frag_get_config(struct moeai_frag_config *config)
+{
+    if (!frag_priv || !config)
+        return -EINVAL;
+
+    spin_lock_bh(&frag_priv->lock);
+    *config = frag_priv->config;
+    spin_unlock_bh(&frag_priv->lock);
+    return 0;
+}
+
+int moeai_mem_frag_set_config(const struct moeai_frag_config *config)
+{
+    if (!frag_priv || !config)
+        return -EINVAL;
+    if (config->order >= MOEAI_FRAG_NR_ORDERS || config->min_high_order_percent > 100 ||
+        config->index_threshold > 1000)
+        return -EINVAL;
+
+    spin_lock_bh(&frag_priv->lock);
+    frag_priv->config = *config;
+    spin_unlock_bh(&frag_priv->lock);
+    return 0;
+}
+
+int moeai_mem_frag_init(void)
+{
+    frag_priv = kzalloc(sizeof(*frag_priv), GFP_KERNEL);
+    if (!frag_priv)
+        return -ENOMEM;
+
+    /* 默认关注 2MB 大页 (x86 上为9阶)，与内核 extfrag_threshold 默认值一致 */
+    frag_priv->config.order = min_t(unsigned int, 9, MOEAI_FRAG_NR_ORDERS - 1);
+    frag_priv->config.min_high_order_percent = 10;  /* 10% */
+    frag_priv->config.index_threshold = 500;
+    frag_priv->config.compact_cooldown_ms = 300000; /* 5分钟 */
+    frag_priv->config.max_zones_per_run = 2;
+
+    spin_lock_init(&frag_priv->lock);
+    nodes_clear(frag_priv->pending);
+    INIT_WORK(&frag_priv->compact_work, moeai_mem_frag_compact_work);
+
+    return 0;
+}
+
+void moeai_mem_frag_stop(void)
+{
+    if (frag_priv)
+        cancel_work_sync(&frag_priv->compact_work);
+}
+
+void moeai_mem_frag_exit(void)
+{
+    if (!frag_priv)
+        return;
+
+    moeai_mem_frag_stop();
+    kfree(frag_priv);
+    frag_priv = NULL;
+}
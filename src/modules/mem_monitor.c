@@ -18,129 +18,1469 @@
 #include <linux/spinlock.h>
 #include <linux/compaction.h>
 #include <linux/fs.h>
-#include <linux/writeback.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/mmzone.h>
+#include <linux/nodemask.h>
+#include <linux/gfp.h>
+#include <linux/list.h>
+#include <linux/percpu.h>
+#include <linux/math64.h>
+#include <linux/hrtimer.h>
+#include <linux/ktime.h>
+#include <linux/mutex.h>
+#include <linux/version.h>
+#include <linux/sched.h>
+#include <linux/build_bug.h>
 #include "../../include/modules/mem_monitor.h"
+#include "../../include/modules/mem_frag.h"
+#include "../../include/modules/mem_policy.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/rss_tracker.h"
+#include "../../include/modules/stall_trace.h"
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/modules/mem_proactive.h"
+#include "../../include/core/event_loop.h"
+#include "../../include/data/history.h"
+#include "../../include/data/snapshot.h"
+#include "../../include/data/live.h"
 #include "../../include/utils/logger.h"
 #include "../../include/utils/lang.h"
 
 /* 模块名称 */
 #define MODULE_NAME "mem_monitor"
 
+/* 默认退出阈值与进入阈值之间的差值 (百分比) */
+#define MOEAI_MEM_DEFAULT_HYSTERESIS 5
+
+/* 抖动检测滑动窗口的采样数 */
+#define MOEAI_MEM_THRASH_WINDOW 8
+
+/* 检查间隔内至少有这么多次直接回收停顿，停顿延迟才参与状态判断 */
+#define MOEAI_MEM_STALL_MIN_COUNT 4
+
+/* Holt 平滑系数 (Q16): 水平 0.5，斜率 0.3 */
+#define MOEAI_MEM_FORECAST_ALPHA (MOEAI_FP_ONE / 2)
+#define MOEAI_MEM_FORECAST_BETA  (MOEAI_FP_ONE * 3 / 10)
+
+/* 累计型 vmstat 计数器快照，用于计算速率 */
+struct moeai_mem_vm_counters {
+    unsigned long pgfault;
+    unsigned long pgmajfault;
+    unsigned long pgscan_kswapd;
+    unsigned long pgscan_direct;
+    unsigned long pgsteal_kswapd;
+    unsigned long pgsteal_direct;
+    unsigned long allocstall;
+    unsigned long refault;
+    unsigned long pswpin;
+    unsigned long pswpout;
+    unsigned long activate;
+    unsigned long kswapd_run;
+    unsigned long kswapd_quick;
+};
+
+/* 抖动检测滑动窗口，保存最近若干次采样间的计数器增量 */
+struct moeai_mem_thrash_window {
+    struct moeai_mem_vm_counters delta[MOEAI_MEM_THRASH_WINDOW];
+    unsigned int interval_ms[MOEAI_MEM_THRASH_WINDOW];
+    unsigned int head;
+    unsigned int count;
+    struct moeai_mem_rates rates;   /* 最近一次计算的窗口平均速率，受 stats_lock 保护 */
+    u64 suppressed;                 /* 抖动期间放弃的回收次数 */
+};
+
+/* 内存压力状态机 */
+struct moeai_mem_state_machine {
+    enum moeai_system_state state;  /* 当前状态 */
+    unsigned long state_since;      /* 进入当前状态的时间 (jiffies) */
+    u64 transitions;                /* 状态切换总次数 */
+    u64 state_entries[MOEAI_STATE_MAX];
+    unsigned long last_reclaim[MOEAI_MEM_RECLAIM_MAX]; /* 各策略上次执行时间 (jiffies) */
+    bool reclaimed_once[MOEAI_MEM_RECLAIM_MAX];        /* 策略是否执行过 */
+    u64 reclaim_runs[MOEAI_MEM_RECLAIM_MAX];
+    u64 reclaim_suppressed[MOEAI_MEM_RECLAIM_MAX];
+};
+
+/* 内存压力预测状态 */
+struct moeai_mem_forecast {
+    struct moeai_history history;   /* 使用率采样历史 (定点百分比) */
+    unsigned long last_sample;      /* 上一次采样时间 (jiffies) */
+    bool pending[MOEAI_STATE_MAX];  /* 是否有尚未结算的越线预测 */
+    unsigned long deadline[MOEAI_STATE_MAX]; /* 预测窗口截止时间 (jiffies) */
+    bool above[MOEAI_STATE_MAX];    /* 上一次采样是否已高于该等级进入阈值 */
+    u64 abs_err_sum;                /* 单步预测绝对误差累计 (定点) */
+    u64 err_count;
+    u64 predictions;
+    u64 hits;
+    u64 false_alarms;
+    u64 misses;
+    u64 triggers;
+};
+
+/* 尚未结算的自动回收，下一次检查时根据使用率判断是否有效 */
+struct moeai_mem_reclaim_outcome {
+    bool pending;                   /* 已提交，等待结算 */
+    bool done;                      /* 回收已执行完毕 */
+    int ctx;                        /* 决策上下文 */
+    int policy;
+    unsigned int threshold;         /* 使用率需回到此值以下 (触发状态的退出阈值) */
+};
+
 /* 内存监控私有数据 */
 struct moeai_mem_monitor_private {
     struct moeai_mem_monitor_config config;
     struct moeai_mem_stats current_stats;
+    struct moeai_mem_state_machine sm;
+    struct moeai_mem_forecast forecast;
+    struct moeai_mem_thrash_window thrash;
     struct timer_list check_timer;
+    struct timer_list live_timer;       /* 在两次检查之间刷新实时页的容量字段 */
+    struct work_struct reclaim_work;    /* 定时器处于软中断上下文，回收放到工作队列中执行 */
+    enum moeai_mem_reclaim_policy pending_policy;
+    struct moeai_mem_reclaim_outcome outcome; /* 受 stats_lock 保护 */
+    struct moeai_mem_reclaimable reclaimable; /* 最近一次检查时的可回收内存估算 */
+    u64 reclaim_futile;                 /* 因可回收内存不足而放弃的回收次数 */
+    bool futile_notified;               /* 本次压力期间是否已告警 */
+    struct moeai_mem_zone_wmark wmarks[MOEAI_MEM_MAX_ZONES]; /* 最近一次检查的区域水位 */
+    int nr_wmarks;
+    u64 wmark_low_events;
+    struct moeai_mem_node_stats nodes[MOEAI_MEM_MAX_NODES]; /* 最近一次采样的节点统计 */
+    struct moeai_mem_node_stats node_scratch[MOEAI_MEM_MAX_NODES]; /* 检查任务的采样缓冲，避免占用栈空间 */
+    int nr_nodes;
+    struct moeai_mem_state_info live_scratch; /* 更新实时页用的暂存，受 stats_lock 保护 */
+    unsigned long node_last_reclaim[MOEAI_MEM_MAX_NODES];   /* 节点上次定向回收时间 (jiffies) */
+    nodemask_t node_reclaim_pending;    /* 等待定向回收的节点 */
+    bool node_reclaim_supported;        /* 内核提供按节点回收的接口 */
+    struct work_struct node_reclaim_work;
+    unsigned long swap_total_kb;        /* 交换空间总量 (KB)，由 swap_work 更新 */
+    struct work_struct swap_work;       /* 读取 /proc/meminfo 会睡眠，放到工作队列中执行 */
+    struct moeai_mem_vm_counters prev_counters; /* 上一次采样的计数器，仅由检查任务访问 */
+    unsigned long prev_sample;          /* 上一次采样时间 (jiffies) */
+    bool have_sample;
+    struct hrtimer burst_timer;         /* 突发采样定时器，运行在软中断上下文 */
+    struct moeai_snapshot_buffer burst; /* 突发采样缓冲，采样期间只由定时器写入 */
+    struct mutex burst_mutex;           /* 串行化缓冲区的分配、释放与导出 */
+    struct moeai_mem_vm_counters burst_prev; /* 上一次突发采样的计数器 */
+    ktime_t burst_prev_time;
+    ktime_t burst_end;
+    ktime_t burst_interval;
+    unsigned int burst_duration_ms;
+    bool burst_active;
     spinlock_t stats_lock;
     bool monitoring_active;
 };
 
-/* 全局私有数据 */
-static struct moeai_mem_monitor_private *monitor_priv;
+/* 全局私有数据 */
+static struct moeai_mem_monitor_private *monitor_priv;
+
+/*
+ * 汇总各CPU上的事件计数
+ * all_vm_events() 会获取 CPU 热插拔读锁而可能睡眠，检查任务运行在定时器软中断中，
+ * 因此只对关心的少数事件直接累加每CPU计数。
+ */
+static unsigned long moeai_vm_event_sum(enum vm_event_item item)
+{
+#ifdef CONFIG_VM_EVENT_COUNTERS
+    unsigned long sum = 0;
+    int cpu;
+
+    for_each_possible_cpu(cpu)
+        sum += per_cpu(vm_event_states, cpu).event[item];
+
+    return sum;
+#else
+    return 0;
+#endif
+}
+
+/* 读取当前的累计计数器 */
+static void moeai_mem_read_counters(struct moeai_mem_vm_counters *c)
+{
+    int zid;
+
+    c->pgfault = moeai_vm_event_sum(PGFAULT);
+    c->pgmajfault = moeai_vm_event_sum(PGMAJFAULT);
+    c->pgscan_kswapd = moeai_vm_event_sum(PGSCAN_KSWAPD);
+    c->pgscan_direct = moeai_vm_event_sum(PGSCAN_DIRECT);
+    c->pgsteal_kswapd = moeai_vm_event_sum(PGSTEAL_KSWAPD);
+    c->pgsteal_direct = moeai_vm_event_sum(PGSTEAL_DIRECT);
+
+    /* ALLOCSTALL 按区域分别计数，与内核 __count_zid_vm_events 的下标计算一致 */
+    c->allocstall = 0;
+    for (zid = 0; zid < MAX_NR_ZONES; zid++)
+        c->allocstall += moeai_vm_event_sum(ALLOCSTALL_NORMAL - ZONE_NORMAL + zid);
+
+    c->refault = global_node_page_state(WORKINGSET_REFAULT_ANON) +
+                 global_node_page_state(WORKINGSET_REFAULT_FILE);
+    c->pswpin = moeai_vm_event_sum(PSWPIN);
+    c->pswpout = moeai_vm_event_sum(PSWPOUT);
+    c->activate = global_node_page_state(WORKINGSET_ACTIVATE_ANON) +
+                  global_node_page_state(WORKINGSET_ACTIVATE_FILE);
+
+    /*
+     * 内核没有 kswapd 唤醒计数，kswapd 每次被唤醒执行一次 balance_pgdat (PAGEOUTRUN)，
+     * 以此作为唤醒次数；刚准备睡眠就发现水位又被跌破的次数单独统计
+     */
+    c->kswapd_run = moeai_vm_event_sum(PAGEOUTRUN);
+    c->kswapd_quick = moeai_vm_event_sum(KSWAPD_LOW_WMARK_HIT_QUICKLY) +
+                      moeai_vm_event_sum(KSWAPD_HIGH_WMARK_HIT_QUICKLY);
+}
+
+/* 差值折算为每秒速率；计数器回绕或CPU下线导致的回退按0处理 */
+static unsigned long moeai_mem_rate(unsigned long now, unsigned long prev,
+                                    unsigned int interval_ms)
+{
+    if (now <= prev || interval_ms == 0)
+        return 0;
+
+    return div_u64((u64)(now - prev) * MSEC_PER_SEC, interval_ms);
+}
+
+/* 计数器增量，回退按0处理 */
+static unsigned long moeai_mem_delta(unsigned long now, unsigned long prev)
+{
+    return now > prev ? now - prev : 0;
+}
+
+/* 将一次采样的计数器增量加入抖动检测窗口 */
+static void moeai_mem_thrash_push(struct moeai_mem_thrash_window *w,
+                                  const struct moeai_mem_vm_counters *now,
+                                  const struct moeai_mem_vm_counters *prev,
+                                  unsigned int interval_ms)
+{
+    struct moeai_mem_vm_counters *d = &w->delta[w->head];
+
+    d->refault = moeai_mem_delta(now->refault, prev->refault);
+    d->pswpin = moeai_mem_delta(now->pswpin, prev->pswpin);
+    d->pswpout = moeai_mem_delta(now->pswpout, prev->pswpout);
+    d->activate = moeai_mem_delta(now->activate, prev->activate);
+    w->interval_ms[w->head] = interval_ms;
+
+    w->head = (w->head + 1) % MOEAI_MEM_THRASH_WINDOW;
+    if (w->count < MOEAI_MEM_THRASH_WINDOW)
+        w->count++;
+}
+
+/*
+ * 根据两次采样计算速率，并保存本次计数供下一次使用
+ * 首次采样只记录基线，速率保持为0
+ */
+static void moeai_mem_update_rates(struct moeai_mem_monitor_private *priv,
+                                   struct moeai_mem_rates *rates)
+{
+    struct moeai_mem_vm_counters now, *prev = &priv->prev_counters;
+    unsigned int interval_ms;
+
+    moeai_mem_read_counters(&now);
+    memset(rates, 0, sizeof(*rates));
+
+    interval_ms = jiffies_to_msecs(jiffies - priv->prev_sample);
+    if (priv->have_sample && interval_ms > 0) {
+        rates->interval_ms = interval_ms;
+        rates->pgfault = moeai_mem_rate(now.pgfault, prev->pgfault, interval_ms);
+        rates->pgmajfault = moeai_mem_rate(now.pgmajfault, prev->pgmajfault, interval_ms);
+        rates->pgscan_kswapd = moeai_mem_rate(now.pgscan_kswapd, prev->pgscan_kswapd, interval_ms);
+        rates->pgscan_direct = moeai_mem_rate(now.pgscan_direct, prev->pgscan_direct, interval_ms);
+        rates->pgsteal_kswapd = moeai_mem_rate(now.pgsteal_kswapd, prev->pgsteal_kswapd, interval_ms);
+        rates->pgsteal_direct = moeai_mem_rate(now.pgsteal_direct, prev->pgsteal_direct, interval_ms);
+        rates->allocstall = moeai_mem_rate(now.allocstall, prev->allocstall, interval_ms);
+        rates->refault = moeai_mem_rate(now.refault, prev->refault, interval_ms);
+        rates->pswpin = moeai_mem_rate(now.pswpin, prev->pswpin, interval_ms);
+        rates->pswpout = moeai_mem_rate(now.pswpout, prev->pswpout, interval_ms);
+        rates->activate = moeai_mem_rate(now.activate, prev->activate, interval_ms);
+        rates->kswapd_run = moeai_mem_rate(now.kswapd_run, prev->kswapd_run, interval_ms);
+        rates->kswapd_quick = moeai_mem_rate(now.kswapd_quick, prev->kswapd_quick, interval_ms);
+        moeai_mem_thrash_push(&priv->thrash, &now, prev, interval_ms);
+    }
+
+    *prev = now;
+    priv->prev_sample = jiffies;
+    priv->have_sample = true;
+}
+
+/* 计算窗口内的平均速率，只填充抖动检测相关的字段 */
+static void moeai_mem_thrash_rates(const struct moeai_mem_thrash_window *w,
+                                   struct moeai_mem_rates *rates)
+{
+    struct moeai_mem_vm_counters sum = {0};
+    unsigned int i, window_ms = 0;
+
+    memset(rates, 0, sizeof(*rates));
+    for (i = 0; i < w->count; i++) {
+        sum.refault += w->delta[i].refault;
+        sum.pswpin += w->delta[i].pswpin;
+        sum.pswpout += w->delta[i].pswpout;
+        sum.activate += w->delta[i].activate;
+        window_ms += w->interval_ms[i];
+    }
+    if (window_ms == 0)
+        return;
+
+    rates->interval_ms = window_ms;
+    rates->refault = moeai_mem_rate(sum.refault, 0, window_ms);
+    rates->pswpin = moeai_mem_rate(sum.pswpin, 0, window_ms);
+    rates->pswpout = moeai_mem_rate(sum.pswpout, 0, window_ms);
+    rates->activate = moeai_mem_rate(sum.activate, 0, window_ms);
+}
+
+/*
+ * 判断是否处于抖动
+ * 交换空间使用率高本身不说明问题，换入和换出同时持续进行才说明工作集放不下；
+ * 大量重新缺页且其中多数被立即激活，说明被回收的页面很快又被使用。
+ * 两种情况下继续回收只会加剧抖动。
+ */
+static bool moeai_mem_is_thrashing(const struct moeai_mem_monitor_config *config,
+                                   const struct moeai_mem_rates *rates)
+{
+    bool swapping, refaulting;
+
+    if (rates->interval_ms == 0)
+        return false;
+
+    swapping = config->thrash_swap_threshold &&
+               rates->pswpin >= config->thrash_swap_threshold &&
+               rates->pswpout >= config->thrash_swap_threshold;
+    refaulting = config->thrash_refault_threshold &&
+                 rates->refault >= config->thrash_refault_threshold &&
+                 rates->activate * 100 >= rates->refault * config->thrash_activate_percent;
+
+    return swapping || refaulting;
+}
+
+/*
+ * 从 /proc/meminfo 读取交换空间总量 (KB)，可能睡眠
+ * 模块无法使用未导出的 total_swap_pages，总量只在 swapon/swapoff 时变化，
+ * 每次检查后在工作队列中刷新一次即可
+ */
+static int moeai_mem_read_swap_total(unsigned long *total_kb)
+{
+    size_t size = 2 * PAGE_SIZE;
+    struct file *filp;
+    char *buf, *line;
+    loff_t pos = 0;
+    ssize_t len;
+    int ret = -ENOENT;
+
+    buf = kmalloc(size, GFP_KERNEL);
+    if (!buf)
+        return -ENOMEM;
+
+    filp = filp_open("/proc/meminfo", O_RDONLY, 0);
+    if (IS_ERR(filp)) {
+        kfree(buf);
+        return PTR_ERR(filp);
+    }
+    len = kernel_read(filp, buf, size - 1, &pos);
+    filp_close(filp, NULL);
+    if (len < 0) {
+        kfree(buf);
+        return len;
+    }
+    buf[len] = '\0';
+
+    /* 格式为 "SwapTotal:       8388604 kB" */
+    line = strstr(buf, "\nSwapTotal:");
+    if (line && sscanf(line, "\nSwapTotal: %lu", total_kb) == 1)
+        ret = 0;
+
+    kfree(buf);
+    return ret;
+}
+
+/**
+ * 交换空间总量刷新工作
+ * @work: 工作结构体指针
+ */
+static void moeai_mem_swap_work(struct work_struct *work)
+{
+    struct moeai_mem_monitor_private *priv =
+        container_of(work, struct moeai_mem_monitor_private, swap_work);
+    unsigned long total_kb;
+
+    if (moeai_mem_read_swap_total(&total_kb) == 0)
+        WRITE_ONCE(priv->swap_total_kb, total_kb);
+}
+
+/* 读取瞬时内存状态 */
+static void moeai_mem_read_stats(struct moeai_mem_stats *stats)
+{
+    struct sysinfo info = {};
+    
+    /* 获取系统信息，si_meminfo 不填写交换分区字段 */
+    si_meminfo(&info);
+    
+    /* 记录时间戳 */
+    ktime_get_real_ts64(&stats->timestamp);
+    
+    /* 填充内存信息 */
+    stats->total_ram = info.totalram * (PAGE_SIZE / 1024);
+    stats->free_ram = info.freeram * (PAGE_SIZE / 1024);
+    stats->available_ram = si_mem_available() * (PAGE_SIZE / 1024);
+    stats->cached_ram = global_node_page_state(NR_FILE_PAGES) * (PAGE_SIZE / 1024) -
+                       total_swapcache_pages() * (PAGE_SIZE / 1024);
+    stats->swap_total = monitor_priv ? READ_ONCE(monitor_priv->swap_total_kb) : 0;
+    stats->swap_free = max_t(long, get_nr_swap_pages(), 0) * (PAGE_SIZE / 1024);
+    if (stats->swap_free > stats->swap_total)
+        stats->swap_free = stats->swap_total;
+    
+    /* 计算百分比 */
+    if (stats->total_ram > 0)
+        stats->mem_usage_percent = 100 - ((stats->available_ram * 100) / stats->total_ram);
+    else
+        stats->mem_usage_percent = 0;
+    
+    if (stats->swap_total > 0)
+        stats->swap_usage_percent = 100 - ((stats->swap_free * 100) / stats->swap_total);
+    else
+        stats->swap_usage_percent = 0;
+}
+
+/**
+ * 获取内存状态
+ * @stats: 用于存储内存状态的结构体指针
+ * 返回值: 0表示成功，负值表示错误
+ *
+ * 容量类数据为实时值，速率来自最近一次检查任务的采样。
+ */
+int moeai_mem_monitor_get_stats(struct moeai_mem_stats *stats)
+{
+    if (!stats)
+        return -EINVAL;
+    
+    moeai_mem_read_stats(stats);
+    
+    memset(&stats->rates, 0, sizeof(stats->rates));
+    if (monitor_priv) {
+        spin_lock_bh(&monitor_priv->stats_lock);
+        stats->rates = monitor_priv->current_stats.rates;
+        spin_unlock_bh(&monitor_priv->stats_lock);
+    }
+    
+    return 0;
+}
+
+/* 读取节点级页面计数，与内核 node_page_state_pages 的处理一致 */
+static unsigned long moeai_node_page_state(struct pglist_data *pgdat,
+                                           enum node_stat_item item)
+{
+    long x = atomic_long_read(&pgdat->vm_stat[item]);
+
+    return x < 0 ? 0 : x;
+}
+
+/*
+ * 采集单个节点的内存统计
+ * 可用内存按 si_mem_available 的方法在节点范围内估算
+ */
+static void moeai_mem_collect_node(int nid, struct moeai_mem_node_stats *ns)
+{
+    struct pglist_data *pgdat = NODE_DATA(nid);
+    unsigned long managed = 0, free = 0, wmark_low = 0;
+    unsigned long pagecache, reclaimable, anon;
+    long available;
+    int i;
+
+    for (i = 0; i < MAX_NR_ZONES; i++) {
+        struct zone *zone = &pgdat->node_zones[i];
+
+        if (!populated_zone(zone))
+            continue;
+        managed += zone_managed_pages(zone);
+        free += zone_page_state(zone, NR_FREE_PAGES);
+        wmark_low += low_wmark_pages(zone);
+    }
+
+    pagecache = moeai_node_page_state(pgdat, NR_ACTIVE_FILE) +
+                moeai_node_page_state(pgdat, NR_INACTIVE_FILE);
+    reclaimable = moeai_node_page_state(pgdat, NR_SLAB_RECLAIMABLE_B) +
+                  moeai_node_page_state(pgdat, NR_KERNEL_MISC_RECLAIMABLE);
+    anon = moeai_node_page_state(pgdat, NR_ACTIVE_ANON) +
+           moeai_node_page_state(pgdat, NR_INACTIVE_ANON);
+
+    available = (long)free - (long)wmark_low;
+    available += pagecache - min(pagecache / 2, wmark_low);
+    available += reclaimable - min(reclaimable / 2, wmark_low);
+    if (available < 0)
+        available = 0;
+
+    ns->nid = nid;
+    ns->total_ram = managed * (PAGE_SIZE / 1024);
+    ns->free_ram = free * (PAGE_SIZE / 1024);
+    ns->available_ram = min_t(unsigned long, available, managed) * (PAGE_SIZE / 1024);
+    ns->file_ram = moeai_node_page_state(pgdat, NR_FILE_PAGES) * (PAGE_SIZE / 1024);
+    ns->anon_ram = anon * (PAGE_SIZE / 1024);
+
+    if (ns->total_ram > 0)
+        ns->mem_usage_percent = 100 - ((ns->available_ram * 100) / ns->total_ram);
+    else
+        ns->mem_usage_percent = 0;
+}
+
+/*
+ * 采集所有在线节点的统计
+ * 返回值: 采集的节点数，超出 MOEAI_MEM_MAX_NODES 的节点不计入
+ */
+static int moeai_mem_collect_nodes(struct moeai_mem_node_stats *nodes, int max_nodes)
+{
+    int nid, count = 0;
+
+    for_each_online_node(nid) {
+        if (count >= max_nodes)
+            break;
+        memset(&nodes[count], 0, sizeof(nodes[count]));
+        moeai_mem_collect_node(nid, &nodes[count]);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * 获取各 NUMA 节点的内存状态
+ * @nodes: 用于存储节点统计的数组
+ * @max_nodes: 数组容量
+ * 返回值: 节点数，负值表示错误
+ */
+int moeai_mem_monitor_get_node_stats(struct moeai_mem_node_stats *nodes, int max_nodes)
+{
+    int count, i;
+
+    if (!nodes || max_nodes <= 0)
+        return -EINVAL;
+
+    count = moeai_mem_collect_nodes(nodes, min(max_nodes, MOEAI_MEM_MAX_NODES));
+
+    /* 节点状态与回收计数来自最近一次检查任务 */
+    if (monitor_priv) {
+        spin_lock_bh(&monitor_priv->stats_lock);
+        for (i = 0; i < count && i < monitor_priv->nr_nodes; i++) {
+            if (monitor_priv->nodes[i].nid != nodes[i].nid)
+                continue;
+            nodes[i].state = monitor_priv->nodes[i].state;
+            nodes[i].reclaim_runs = monitor_priv->nodes[i].reclaim_runs;
+            nodes[i].last_reclaimed_kb = monitor_priv->nodes[i].last_reclaimed_kb;
+        }
+        spin_unlock_bh(&monitor_priv->stats_lock);
+    }
+
+    return count;
+}
+
+/*
+ * 采集各区域的空闲页与水位，跌破 low 水位时立即告警
+ * 低于 low 时 kswapd 已被唤醒，低于 min 时分配进入直接回收，分配延迟从这里开始上升，
+ * 比使用率百分比更早反映内核回收的压力。调用者持有 stats_lock。
+ * 返回值: 水位对应的最低压力状态
+ */
+static enum moeai_system_state moeai_mem_update_wmarks(struct moeai_mem_monitor_private *priv)
+{
+    enum moeai_mem_wmark_level prev, worst = MOEAI_MEM_WMARK_OK;
+    struct moeai_mem_zone_wmark *w;
+    unsigned long free;
+    int nid, zid, n = 0;
+
+    for_each_online_node(nid) {
+        for (zid = 0; zid < MAX_NR_ZONES; zid++) {
+            struct zone *zone = &NODE_DATA(nid)->node_zones[zid];
+
+            if (!populated_zone(zone))
+                continue;
+            if (n >= MOEAI_MEM_MAX_ZONES)
+                goto out;
+
+            /* 区域集合只在内存热插拔时变化，位置对应的区域变了就重新计数 */
+            w = &priv->wmarks[n++];
+            if (w->nid != nid || w->zone_name != zone->name) {
+                memset(w, 0, sizeof(*w));
+                w->nid = nid;
+                w->zone_name = zone->name;
+            }
+
+            prev = w->level;
+            free = zone_page_state(zone, NR_FREE_PAGES);
+            w->free_kb = free * (PAGE_SIZE / 1024);
+            w->min_kb = min_wmark_pages(zone) * (PAGE_SIZE / 1024);
+            w->low_kb = low_wmark_pages(zone) * (PAGE_SIZE / 1024);
+            w->high_kb = high_wmark_pages(zone) * (PAGE_SIZE / 1024);
+            if (free < min_wmark_pages(zone))
+                w->level = MOEAI_MEM_WMARK_MIN;
+            else if (free < low_wmark_pages(zone))
+                w->level = MOEAI_MEM_WMARK_LOW;
+            else if (free < high_wmark_pages(zone))
+                w->level = MOEAI_MEM_WMARK_HIGH;
+            else
+                w->level = MOEAI_MEM_WMARK_OK;
+
+            if (w->level >= MOEAI_MEM_WMARK_LOW && prev < MOEAI_MEM_WMARK_LOW) {
+                w->low_events++;
+                priv->wmark_low_events++;
+                MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_WMARK_LOW), nid, zone->name,
+                        w->free_kb, w->low_kb, w->min_kb);
+            }
+            worst = max(worst, w->level);
+        }
+    }
+
+out:
+    priv->nr_wmarks = n;
+    if (!priv->config.wmark_trigger)
+        return MOEAI_STATE_NORMAL;
+    if (worst == MOEAI_MEM_WMARK_MIN)
+        return MOEAI_STATE_CRITICAL;
+    if (worst == MOEAI_MEM_WMARK_LOW)
+        return MOEAI_STATE_WARNING;
+    return MOEAI_STATE_NORMAL;
+}
+
+/**
+ * 获取各区域的水位状态
+ * @zones: 用于存储区域水位的数组
+ * @max_zones: 数组容量
+ * 返回值: 区域数，负值表示错误
+ */
+int moeai_mem_monitor_get_wmarks(struct moeai_mem_zone_wmark *zones, int max_zones)
+{
+    int count;
+
+    if (!monitor_priv || !zones || max_zones <= 0)
+        return -EINVAL;
+
+    spin_lock_bh(&monitor_priv->stats_lock);
+    count = min(max_zones, monitor_priv->nr_wmarks);
+    memcpy(zones, monitor_priv->wmarks, count * sizeof(*zones));
+    spin_unlock_bh(&monitor_priv->stats_lock);
+
+    return count;
+}
+
+/* 每次通过根 cgroup 的 memory.reclaim 请求的上限，占总内存的百分比 */
+#define MOEAI_MEM_RECLAIM_STEP_PERCENT 10
+
+/*
+ * 从根 cgroup 按 LRU 回收，可能睡眠
+ * 请求量取该策略的估算值，但不超过总内存的 MOEAI_MEM_RECLAIM_STEP_PERCENT；
+ * 只有积极回收会换出匿名页，其余策略只回收文件页和 slab
+ */
+static int moeai_mem_reclaim_root(const struct moeai_mem_reclaimable *estimate,
+                                  enum moeai_mem_reclaim_policy policy)
+{
+    u64 limit_kb = (u64)totalram_pages() * (PAGE_SIZE / 1024) *
+                   MOEAI_MEM_RECLAIM_STEP_PERCENT / 100;
+    u64 want_kb = min_t(u64, estimate->estimate[policy], limit_kb);
+    int ret;
+
+    if (!want_kb)
+        return 0;
+
+    if (policy == MOEAI_MEM_RECLAIM_AGGRESSIVE)
+        ret = moeai_memcg_reclaim("/", want_kb << 10);
+    else
+        ret = moeai_memcg_reclaim_file("/", want_kb << 10);
+    /* 回收不足请求量时已回收的部分仍然有效 */
+    return ret == -EAGAIN ? 0 : ret;
+}
+
+/*
+ * 估算各回收策略最多能释放的内存
+ * 温和回收只能丢弃干净的文件页；中等回收在回写脏页后还能释放全部文件页与可回收 slab；
+ * 积极回收还可以把匿名页换出，但受剩余交换空间限制。只读取全局计数，可在定时器上下文调用。
+ */
+static void moeai_mem_estimate_reclaimable(struct moeai_mem_reclaimable *r)
+{
+    unsigned long file, clean, moderate, cold_kb;
+    int i;
+
+    r->inactive_file = global_node_page_state(NR_INACTIVE_FILE);
+    r->active_file = global_node_page_state(NR_ACTIVE_FILE);
+    r->dirty = global_node_page_state(NR_FILE_DIRTY) + global_node_page_state(NR_WRITEBACK);
+    r->slab_reclaimable = global_node_page_state_pages(NR_SLAB_RECLAIMABLE_B) +
+                          global_node_page_state(NR_KERNEL_MISC_RECLAIMABLE);
+    r->anon = global_node_page_state(NR_ACTIVE_ANON) + global_node_page_state(NR_INACTIVE_ANON);
+    r->swap_free = max_t(long, get_nr_swap_pages(), 0);
+
+    file = r->inactive_file + r->active_file;
+    clean = file - min(r->dirty, file);
+    moderate = file + r->slab_reclaimable;
+    r->estimate[MOEAI_MEM_RECLAIM_GENTLE] = clean;
+    r->estimate[MOEAI_MEM_RECLAIM_MODERATE] = moderate;
+    r->estimate[MOEAI_MEM_RECLAIM_AGGRESSIVE] = moderate + min(r->anon, r->swap_free);
+
+    /* 以上均为页数，统一换算为 KB */
+    r->inactive_file *= PAGE_SIZE / 1024;
+    r->active_file *= PAGE_SIZE / 1024;
+    r->dirty *= PAGE_SIZE / 1024;
+    r->slab_reclaimable *= PAGE_SIZE / 1024;
+    r->anon *= PAGE_SIZE / 1024;
+    r->swap_free *= PAGE_SIZE / 1024;
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++)
+        r->estimate[i] *= PAGE_SIZE / 1024;
+
+    /* 有工作集估算时中等回收只回收冷内存 */
+    if (moeai_wss_cold_kb(&cold_kb))
+        r->estimate[MOEAI_MEM_RECLAIM_MODERATE] = min(r->estimate[MOEAI_MEM_RECLAIM_MODERATE], cold_kb);
+}
+
+/**
+ * 获取可回收内存估算
+ * @r: 用于存储估算结果的结构体指针
+ * 返回值: 0表示成功，负值表示错误
+ */
+int moeai_mem_monitor_get_reclaimable(struct moeai_mem_reclaimable *r)
+{
+    if (!r)
+        return -EINVAL;
+
+    moeai_mem_estimate_reclaimable(r);
+    return 0;
+}
+
+/**
+ * 执行内存回收
+ * @policy: 回收策略
+ * 返回值: 回收的内存量 (KB，以可用内存的实际增加量计)，负值表示错误
+ */
+long moeai_mem_reclaim(enum moeai_mem_reclaim_policy policy)
+{
+    unsigned long before, after, freed_kb;
+    struct moeai_mem_reclaimable estimate;
+    int ret = 0;
+    u64 start;
+    
+    if ((unsigned int)policy >= MOEAI_MEM_RECLAIM_MAX) {
+        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_MEM_INVALID_POLICY), policy);
+        return -EINVAL;
+    }
+    
+    moeai_mem_estimate_reclaimable(&estimate);
+    MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_MEM_RECLAIM_ESTIMATE),
+                moeai_mem_policy_name(policy), estimate.estimate[policy]);
+    
+    /* 记录实际效果与耗时 (单调时钟)，供策略选择使用 */
+    before = si_mem_available();
+    start = ktime_get_ns();
+    
+    switch (policy) {
+    case MOEAI_MEM_RECLAIM_GENTLE:
+        /* 按干净文件页的估算量回收文件缓存 */
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_GENTLE_RECLAIM));
+        ret = moeai_mem_reclaim_root(&estimate, policy);
+        break;
+        
+    case MOEAI_MEM_RECLAIM_MODERATE:
+        /* 回收文件缓存和可回收 slab */
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_MODERATE_RECLAIM));
+        /* 有工作集估算时只回收空闲超过 cold_age_ms 的内存，不动工作集 */
+        if (moeai_wss_reclaim_cold() >= 0)
+            break;
+        ret = moeai_mem_reclaim_root(&estimate, policy);
+        break;
+        
+    case MOEAI_MEM_RECLAIM_AGGRESSIVE:
+        /* 按 LRU 回收包括匿名页在内的内存 */
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_AGGRESSIVE_RECLAIM));
+        ret = moeai_mem_reclaim_root(&estimate, policy);
+        break;
+        
+    default:
+        break;
+    }
+    
+    after = si_mem_available();
+    freed_kb = after > before ? (after - before) * (PAGE_SIZE / 1024) : 0;
+    moeai_mem_policy_record_run(policy, freed_kb, ktime_get_ns() - start);
+    moeai_event_hub_publish(MOEAI_HUB_RECLAIM_DONE, policy, 0, freed_kb);
+    
+    /*
+     * 积极回收后空闲页较多，按碎片检查的冷却和每轮区域数上限调度规整；
+     * 规整在工作队列中异步执行，不计入回收耗时
+     */
+    if (policy == MOEAI_MEM_RECLAIM_AGGRESSIVE)
+        moeai_mem_frag_check(true);
+    
+    if (ret)
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_RECLAIM_ACTION_FAILED),
+                   moeai_mem_policy_name(policy), ret);
+    return ret && !freed_kb ? ret : freed_kb;
+}
+
+/* 按节点主动回收的 sysfs 接口 (6.17+)，写入格式与 memory.reclaim 相同 */
+#define MOEAI_MEM_NODE_RECLAIM_PATH "/sys/devices/system/node/node%d/reclaim"
+
+/* 打开节点的回收接口，内核没有该接口时返回 -EOPNOTSUPP */
+static struct file *moeai_mem_node_reclaim_open(int nid)
+{
+    struct file *filp;
+    char path[64];
+
+    snprintf(path, sizeof(path), MOEAI_MEM_NODE_RECLAIM_PATH, nid);
+    filp = filp_open(path, O_WRONLY, 0);
+    if (IS_ERR(filp) && PTR_ERR(filp) == -ENOENT)
+        return ERR_PTR(-EOPNOTSUPP);
+    return filp;
+}
+
+/* 检测内核是否提供按节点回收的接口，可能睡眠 */
+static bool moeai_mem_node_reclaim_probe(void)
+{
+    struct file *filp = moeai_mem_node_reclaim_open(first_online_node);
+
+    if (IS_ERR(filp))
+        return PTR_ERR(filp) != -EOPNOTSUPP;
+    filp_close(filp, NULL);
+    return true;
+}
+
+/**
+ * 是否支持节点定向回收
+ * 返回值: 内核提供按节点回收的接口时为 true
+ */
+bool moeai_mem_node_reclaim_supported(void)
+{
+    return monitor_priv && monitor_priv->node_reclaim_supported;
+}
+
+/**
+ * 节点定向回收
+ * @nid: 目标节点
+ * @target_kb: 期望在该节点上腾出的内存量 (KB)
+ * 返回值: 节点空闲内存的增加量 (KB)，负值表示错误，内核不支持时为 -EOPNOTSUPP
+ *
+ * 模块无法直接调用节点回收，与 memory.reclaim 一样通过按节点的 sysfs 接口请求内核
+ * 只在该节点的 LRU 上回收。较早的内核没有这个接口，此时不做任何回收。
+ */
+long moeai_mem_reclaim_node(int nid, unsigned long target_kb)
+{
+    struct moeai_mem_node_stats before, after;
+    struct file *filp;
+    loff_t pos = 0;
+    char req[24];
+    ssize_t ret;
+    long freed;
+    int len;
+
+    if (nid < 0 || nid >= MAX_NUMNODES || !node_online(nid) || target_kb == 0)
+        return -EINVAL;
+
+    filp = moeai_mem_node_reclaim_open(nid);
+    if (IS_ERR(filp)) {
+        if (PTR_ERR(filp) == -EOPNOTSUPP)
+            MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_NODE_RECLAIM_UNSUPPORTED), nid);
+        return PTR_ERR(filp);
+    }
+
+    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_NODE_RECLAIM), nid, target_kb);
+
+    moeai_mem_collect_node(nid, &before);
+    len = snprintf(req, sizeof(req), "%luK", target_kb);
+    ret = kernel_write(filp, req, len, &pos);
+    filp_close(filp, NULL);
+    moeai_mem_collect_node(nid, &after);
+
+    /* 回收不足请求量时写入返回 -EAGAIN，已回收的部分仍然有效 */
+    if (ret < 0 && ret != -EAGAIN)
+        return ret;
+
+    freed = (long)after.free_ram - (long)before.free_ram;
+    moeai_event_hub_publish(MOEAI_HUB_NODE_RECLAIM_DONE, nid, 0, freed);
+    return freed;
+}
+
+/**
+ * 节点定向回收工作
+ * @work: 工作结构体指针
+ */
+static void moeai_mem_node_reclaim_work(struct work_struct *work)
+{
+    struct moeai_mem_monitor_private *priv =
+        container_of(work, struct moeai_mem_monitor_private, node_reclaim_work);
+    nodemask_t pending;
+    unsigned int target_kb;
+    long freed;
+    int nid, i;
+
+    spin_lock_bh(&priv->stats_lock);
+    pending = priv->node_reclaim_pending;
+    nodes_clear(priv->node_reclaim_pending);
+    target_kb = priv->config.node_reclaim_kb;
+    spin_unlock_bh(&priv->stats_lock);
+
+    for_each_node_mask(nid, pending) {
+        freed = moeai_mem_reclaim_node(nid, target_kb);
+
+        spin_lock_bh(&priv->stats_lock);
+        for (i = 0; i < priv->nr_nodes; i++) {
+            if (priv->nodes[i].nid == nid) {
+                priv->nodes[i].last_reclaimed_kb = freed;
+                break;
+            }
+        }
+        spin_unlock_bh(&priv->stats_lock);
+    }
+}
+
+/*
+ * 计算节点的下一个压力状态
+ * 升级立即生效，降级需要使用率低于进入阈值 MOEAI_MEM_DEFAULT_HYSTERESIS 个百分点
+ */
+static enum moeai_system_state moeai_mem_node_next_state(const struct moeai_mem_monitor_config *config,
+                                                         enum moeai_system_state prev,
+                                                         unsigned int usage)
+{
+    enum moeai_system_state next = MOEAI_STATE_NORMAL;
+
+    if (usage >= config->node_critical_threshold)
+        next = MOEAI_STATE_CRITICAL;
+    else if (usage >= config->node_warn_threshold)
+        next = MOEAI_STATE_WARNING;
+
+    if (next >= prev)
+        return next;
+
+    if (prev == MOEAI_STATE_CRITICAL &&
+        usage + MOEAI_MEM_DEFAULT_HYSTERESIS >= config->node_critical_threshold)
+        return MOEAI_STATE_CRITICAL;
+    if (next == MOEAI_STATE_NORMAL &&
+        usage + MOEAI_MEM_DEFAULT_HYSTERESIS >= config->node_warn_threshold)
+        return MOEAI_STATE_WARNING;
+
+    return next;
+}
+
+/*
+ * 更新节点压力状态，并为达到临界阈值的节点调度定向回收
+ * 同一节点两次定向回收之间沿用 MODERATE 策略的冷却时间
+ */
+static void moeai_mem_update_nodes(struct moeai_mem_monitor_private *priv,
+                                   struct moeai_mem_node_stats *nodes, int count)
+{
+    const struct moeai_mem_monitor_config *config = &priv->config;
+    unsigned long cooldown = msecs_to_jiffies(config->reclaim_cooldown_ms[MOEAI_MEM_RECLAIM_MODERATE]);
+    unsigned long last_reclaim[MOEAI_MEM_MAX_NODES];
+    bool queue = false;
+    int i, j;
+
+    for (i = 0; i < count; i++) {
+        struct moeai_mem_node_stats *ns = &nodes[i];
+        enum moeai_system_state prev = MOEAI_STATE_NORMAL;
+
+        /* 继承上次采样的状态和计数 */
+        last_reclaim[i] = 0;
+        for (j = 0; j < priv->nr_nodes; j++) {
+            if (priv->nodes[j].nid == ns->nid) {
+                prev = priv->nodes[j].state;
+                ns->reclaim_runs = priv->nodes[j].reclaim_runs;
+                ns->last_reclaimed_kb = priv->nodes[j].last_reclaimed_kb;
+                last_reclaim[i] = priv->node_last_reclaim[j];
+                break;
+            }
+        }
+
+        ns->state = moeai_mem_node_next_state(config, prev, ns->mem_usage_percent);
+        if (ns->state != prev)
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_NODE_STATE_CHANGED), ns->nid,
+                    moeai_mem_state_name(prev), moeai_mem_state_name(ns->state),
+                    ns->mem_usage_percent);
+
+        if (ns->state != MOEAI_STATE_CRITICAL || !config->auto_reclaim ||
+            !priv->node_reclaim_supported || priv->sm.state == MOEAI_STATE_THRASHING)
+            continue;
+        if (ns->reclaim_runs && time_before(jiffies, last_reclaim[i] + cooldown))
+            continue;
+
+        node_set(ns->nid, priv->node_reclaim_pending);
+        last_reclaim[i] = jiffies;
+        ns->reclaim_runs++;
+        queue = true;
+    }
+
+    memcpy(priv->nodes, nodes, sizeof(*nodes) * count);
+    memcpy(priv->node_last_reclaim, last_reclaim, sizeof(*last_reclaim) * count);
+    priv->nr_nodes = count;
+
+    if (queue)
+        queue_work(system_unbound_wq, &priv->node_reclaim_work);
+}
+
+/* 状态对应的进入阈值 */
+static unsigned int moeai_mem_enter_threshold(const struct moeai_mem_monitor_config *config,
+                                              enum moeai_system_state state)
+{
+    switch (state) {
+    case MOEAI_STATE_WARNING:
+        return config->warn_threshold;
+    case MOEAI_STATE_CRITICAL:
+        return config->critical_threshold;
+    case MOEAI_STATE_EMERGENCY:
+        return config->emergency_threshold;
+    default:
+        return 0;
+    }
+}
+
+/* 状态对应的退出阈值 */
+static unsigned int moeai_mem_exit_threshold(const struct moeai_mem_monitor_config *config,
+                                             enum moeai_system_state state)
+{
+    switch (state) {
+    case MOEAI_STATE_WARNING:
+        return config->warn_exit_threshold;
+    case MOEAI_STATE_CRITICAL:
+        return config->critical_exit_threshold;
+    case MOEAI_STATE_EMERGENCY:
+        return config->emergency_exit_threshold;
+    default:
+        return 0;
+    }
+}
+
+/* 状态对应的回收策略，NORMAL 状态无需回收 */
+static int moeai_mem_state_policy(enum moeai_system_state state)
+{
+    switch (state) {
+    case MOEAI_STATE_WARNING:
+        return MOEAI_MEM_RECLAIM_GENTLE;
+    case MOEAI_STATE_CRITICAL:
+        return MOEAI_MEM_RECLAIM_MODERATE;
+    case MOEAI_STATE_EMERGENCY:
+        return MOEAI_MEM_RECLAIM_AGGRESSIVE;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * 获取内存状态名称
+ * @state: 系统状态
+ * 返回值: 本地化的状态名称
+ */
+const char *moeai_mem_state_name(enum moeai_system_state state)
+{
+    switch (state) {
+    case MOEAI_STATE_NORMAL:
+        return lang_get(LANG_MEM_STATE_NORMAL);
+    case MOEAI_STATE_WARNING:
+        return lang_get(LANG_MEM_STATE_WARNING);
+    case MOEAI_STATE_CRITICAL:
+        return lang_get(LANG_MEM_STATE_CRITICAL);
+    case MOEAI_STATE_EMERGENCY:
+        return lang_get(LANG_MEM_STATE_EMERGENCY);
+    case MOEAI_STATE_THRASHING:
+        return lang_get(LANG_MEM_STATE_THRASHING);
+    default:
+        return lang_get(LANG_PROCFS_LOG_LEVEL_UNKNOWN);
+    }
+}
+
+/**
+ * 获取内存状态的固定英文标识，供机器解析的接口 (指标、事件) 使用
+ * @state: 系统状态
+ * 返回值: 不随界面语言变化的标识
+ */
+const char *moeai_mem_state_key(enum moeai_system_state state)
+{
+    static const char * const keys[] = {
+        "normal", "warning", "critical", "emergency", "thrashing",
+    };
+
+    static_assert(ARRAY_SIZE(keys) == MOEAI_STATE_MAX);
+    return (unsigned int)state < MOEAI_STATE_MAX ? keys[state] : "unknown";
+}
+
+/**
+ * 获取回收策略的固定英文标识
+ * @policy: 回收策略
+ * 返回值: 不随界面语言变化的标识
+ */
+const char *moeai_mem_policy_key(enum moeai_mem_reclaim_policy policy)
+{
+    static const char * const keys[] = {
+        "gentle", "moderate", "aggressive",
+    };
+
+    static_assert(ARRAY_SIZE(keys) == MOEAI_MEM_RECLAIM_MAX);
+    return (unsigned int)policy < MOEAI_MEM_RECLAIM_MAX ? keys[policy] : "unknown";
+}
+
+/**
+ * 获取回收策略名称
+ * @policy: 回收策略
+ * 返回值: 本地化的策略名称
+ */
+const char *moeai_mem_policy_name(enum moeai_mem_reclaim_policy policy)
+{
+    switch (policy) {
+    case MOEAI_MEM_RECLAIM_GENTLE:
+        return lang_get(LANG_MEM_POLICY_GENTLE);
+    case MOEAI_MEM_RECLAIM_MODERATE:
+        return lang_get(LANG_MEM_POLICY_MODERATE);
+    case MOEAI_MEM_RECLAIM_AGGRESSIVE:
+        return lang_get(LANG_MEM_POLICY_AGGRESSIVE);
+    default:
+        return lang_get(LANG_PROCFS_LOG_LEVEL_UNKNOWN);
+    }
+}
+
+/*
+ * 根据回收活动速率给出状态下限
+ * 直接回收扫描或分配停顿超过阈值说明分配路径已经在同步回收，至少为 WARNING；
+ * 同时伴随大量重新缺页说明被回收的正是工作集，升至 CRITICAL。
+ * 这些信号通常早于使用率越过阈值出现。
+ */
+static enum moeai_system_state moeai_mem_rate_floor(const struct moeai_mem_monitor_config *config,
+                                                    const struct moeai_mem_rates *rates)
+{
+    bool direct, refault;
+
+    if (rates->interval_ms == 0)
+        return MOEAI_STATE_NORMAL;
+
+    direct = (config->direct_scan_rate_threshold &&
+              rates->pgscan_direct >= config->direct_scan_rate_threshold) ||
+             (config->allocstall_rate_threshold &&
+              rates->allocstall >= config->allocstall_rate_threshold);
+    refault = config->refault_rate_threshold &&
+              rates->refault >= config->refault_rate_threshold;
+
+    if (direct && refault)
+        return MOEAI_STATE_CRITICAL;
+    if (direct || refault)
+        return MOEAI_STATE_WARNING;
+    return MOEAI_STATE_NORMAL;
+}
+
+/*
+ * 根据直接回收停顿延迟给出状态下限
+ * 停顿是应用线程在分配路径上实际等待的时间，检查间隔内的99分位越过阈值时抬高状态。
+ * 停顿次数太少时99分位只是单次停顿，不作判断。
+ */
+static enum moeai_system_state moeai_mem_stall_floor(const struct moeai_mem_monitor_config *config,
+                                                     const struct moeai_stall_dist *stall)
+{
+    if (stall->count < MOEAI_MEM_STALL_MIN_COUNT)
+        return MOEAI_STATE_NORMAL;
+    if (config->stall_critical_us && stall->p99_us >= config->stall_critical_us)
+        return MOEAI_STATE_CRITICAL;
+    if (config->stall_warn_us && stall->p99_us >= config->stall_warn_us)
+        return MOEAI_STATE_WARNING;
+    return MOEAI_STATE_NORMAL;
+}
+
+/* 使用率达到的最高进入阈值与速率下限中的较高者 */
+static enum moeai_system_state moeai_mem_usage_target(const struct moeai_mem_monitor_config *config,
+                                                      unsigned int usage,
+                                                      enum moeai_system_state floor)
+{
+    int s;
+
+    for (s = MOEAI_STATE_EMERGENCY; s > floor; s--) {
+        if (usage >= moeai_mem_enter_threshold(config, s))
+            return s;
+    }
+
+    return floor;
+}
+
+/*
+ * 根据使用率计算下一个状态
+ * 升级立即生效：取使用率达到的最高进入阈值与速率下限中的较高者；
+ * 降级需要驻留时间已满，且使用率低于当前等级的退出阈值，可连续下降多级，但不低于速率下限。
+ * 抖动状态由检查任务单独处理。
+ */
+static enum moeai_system_state moeai_mem_next_state(const struct moeai_mem_monitor_config *config,
+                                                    const struct moeai_mem_state_machine *sm,
+                                                    unsigned int usage,
+                                                    enum moeai_system_state floor)
+{
+    enum moeai_system_state target = moeai_mem_usage_target(config, usage, floor);
+    enum moeai_system_state next = sm->state;
+
+    if (target > sm->state)
+        return target;
+
+    if (time_before(jiffies, sm->state_since + msecs_to_jiffies(config->min_dwell_ms)))
+        return sm->state;
+
+    while (next > target && usage < moeai_mem_exit_threshold(config, next))
+        next--;
+
+    return next;
+}
+
+/**
+ * 内存回收工作
+ * @work: 工作结构体指针
+ */
+static void moeai_mem_reclaim_work(struct work_struct *work)
+{
+    struct moeai_mem_monitor_private *priv =
+        container_of(work, struct moeai_mem_monitor_private, reclaim_work);
+
+    moeai_mem_reclaim(READ_ONCE(priv->pending_policy));
+
+    spin_lock_bh(&priv->stats_lock);
+    if (priv->outcome.pending)
+        priv->outcome.done = true;
+    spin_unlock_bh(&priv->stats_lock);
+}
+
+/*
+ * 按需调度指定策略的回收
+ * 进入新状态时立即回收，之后同一策略在冷却期内不会重复执行。
+ * 返回值: 是否提交了回收
+ */
+static bool moeai_mem_schedule_reclaim(struct moeai_mem_monitor_private *priv, int policy)
+{
+    struct moeai_mem_state_machine *sm = &priv->sm;
+    unsigned long cooldown;
+
+    if (policy < 0 || !priv->config.auto_reclaim)
+        return false;
+
+    cooldown = msecs_to_jiffies(priv->config.reclaim_cooldown_ms[policy]);
+    if (sm->reclaimed_once[policy] &&
+        time_before(jiffies, sm->last_reclaim[policy] + cooldown)) {
+        sm->reclaim_suppressed[policy]++;
+        MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_MEM_RECLAIM_COOLDOWN), policy);
+        return false;
+    }
+
+    /*
+     * 上一次回收还在排队时不重复提交，也不能改写它的策略，否则排队中的
+     * 激进回收会被降级，冷却和效果也会记到错误的策略上。
+     * 只有检查定时器提交回收，检查和提交之间不会有别人把工作放进队列。
+     */
+    if (work_pending(&priv->reclaim_work))
+        return false;
+    WRITE_ONCE(priv->pending_policy, policy);
+    if (!queue_work(system_unbound_wq, &priv->reclaim_work))
+        return false;
+
+    sm->last_reclaim[policy] = jiffies;
+    sm->reclaimed_once[policy] = true;
+    sm->reclaim_runs[policy]++;
+    return true;
+}
 
-/**
- * 获取内存状态
- * @stats: 用于存储内存状态的结构体指针
- * 返回值: 0表示成功，负值表示错误
+/*
+ * 判断选定策略是否值得执行
+ * 预计可回收量不足时回收只会白白消耗CPU (例如全部是匿名页且交换空间已满)，
+ * 此时放弃回收，并在本次压力期间告警一次，由用户空间释放内存。
+ * 返回值: 是否放弃回收
  */
-int moeai_mem_monitor_get_stats(struct moeai_mem_stats *stats)
+static bool moeai_mem_reclaim_futile(struct moeai_mem_monitor_private *priv, int policy)
 {
-    struct sysinfo info;
-    
-    if (!stats)
-        return -EINVAL;
-    
-    /* 获取系统信息 */
-    si_meminfo(&info);
-    
-    /* 记录时间戳 */
-    ktime_get_real_ts64(&stats->timestamp);
-    
-    /* 填充内存信息 */
-    stats->total_ram = info.totalram * (PAGE_SIZE / 1024);
-    stats->free_ram = info.freeram * (PAGE_SIZE / 1024);
-    stats->available_ram = si_mem_available() * (PAGE_SIZE / 1024);
-    stats->cached_ram = global_node_page_state(NR_FILE_PAGES) * (PAGE_SIZE / 1024) -
-                       total_swapcache_pages() * (PAGE_SIZE / 1024);
-    stats->swap_total = info.totalswap * (PAGE_SIZE / 1024);
-    stats->swap_free = info.freeswap * (PAGE_SIZE / 1024);
-    
-    /* 计算百分比 */
-    if (stats->total_ram > 0)
-        stats->mem_usage_percent = 100 - ((stats->available_ram * 100) / stats->total_ram);
-    else
-        stats->mem_usage_percent = 0;
-    
-    if (stats->swap_total > 0)
-        stats->swap_usage_percent = 100 - ((stats->swap_free * 100) / stats->swap_total);
-    else
-        stats->swap_usage_percent = 0;
-    
-    return 0;
+    const struct moeai_mem_reclaimable *r = &priv->reclaimable;
+
+    if (policy < 0 || !priv->config.auto_reclaim || !priv->config.min_reclaimable_kb ||
+        r->estimate[policy] >= priv->config.min_reclaimable_kb)
+        return false;
+
+    priv->reclaim_futile++;
+    if (!priv->futile_notified) {
+        priv->futile_notified = true;
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_RECLAIM_FUTILE),
+                moeai_mem_policy_name(policy), r->estimate[policy],
+                r->inactive_file + r->active_file, r->dirty, r->slab_reclaimable,
+                r->anon, r->swap_free);
+    }
+    return true;
 }
 
-/* 
- * 释放页面缓存 - 自定义实现
- * 这是一个简化版本，仅用于演示
+/* 以定点百分比表示的内存使用率，比整数百分比更适合拟合趋势 */
+static s64 moeai_mem_usage_fp(const struct moeai_mem_stats *stats)
+{
+    if (stats->total_ram == 0 || stats->available_ram >= stats->total_ram)
+        return 0;
+
+    return div64_u64((u64)(stats->total_ram - stats->available_ram) * MOEAI_FP(100),
+                     stats->total_ram);
+}
+
+/*
+ * 加入新采样，并结算此前的越线预测
+ * 预测窗口内达到进入阈值记为命中，窗口过期仍未达到记为误报，
+ * 未经预测直接越线记为漏报。提前回收成功阻止越线时也会记为误报。
  */
-static long drop_page_cache(void)
+static void moeai_mem_forecast_update(struct moeai_mem_monitor_private *priv, s64 usage)
 {
-    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_RELEASE_PAGE_CACHE));
-    /* 由于无法直接访问内核内存管理函数，使用间接方法 */
-    /* 在实际应用中，应该通过 sysfs/procfs 接口操作，例如写入 /proc/sys/vm/drop_caches */
-    sync_inodes_sb(NULL);  /* 同步文件系统元数据 */
-    return 0;
+    struct moeai_mem_forecast *fc = &priv->forecast;
+    unsigned int dt_ms = jiffies_to_msecs(jiffies - fc->last_sample);
+    bool crossed;
+    int s;
+
+    if (fc->history.count >= 2) {
+        s64 err = usage - moeai_history_forecast(&fc->history, dt_ms);
+
+        fc->abs_err_sum += err < 0 ? -err : err;
+        fc->err_count++;
+    }
+    moeai_history_add(&fc->history, usage, dt_ms);
+    fc->last_sample = jiffies;
+
+    for (s = MOEAI_STATE_WARNING; s <= MOEAI_STATE_EMERGENCY; s++) {
+        crossed = usage >= MOEAI_FP(moeai_mem_enter_threshold(&priv->config, s));
+        if (fc->pending[s]) {
+            if (crossed) {
+                fc->hits++;
+                fc->pending[s] = false;
+            } else if (time_after(jiffies, fc->deadline[s])) {
+                fc->false_alarms++;
+                fc->pending[s] = false;
+            }
+        } else if (crossed && !fc->above[s]) {
+            fc->misses++;
+        }
+        fc->above[s] = crossed;
+    }
 }
 
 /*
- * 释放slab缓存 - 自定义实现，替代 drop_slab 函数
+ * 根据趋势预测选择提前回收策略
+ * 预计在预测窗口内越过某等级的进入阈值时，使用比该等级低一档的策略提前回收：
+ * 预计进入 EMERGENCY 时执行 MODERATE，预计进入 WARNING/CRITICAL 时执行 GENTLE。
+ * 返回值: 回收策略，无需提前回收时返回-1
  */
-static long drop_slab_cache(void)
+static int moeai_mem_forecast_policy(struct moeai_mem_monitor_private *priv)
 {
-    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_RELEASE_SLAB_CACHE));
-    /* 实际应用中应该使用 kmem_cache_shrink 对各个 slab 进行收缩 */
-    /* 这里仅返回一个示意值 */
-    return 0;
+    struct moeai_mem_forecast *fc = &priv->forecast;
+    unsigned int horizon = priv->config.forecast_horizon_ms;
+    unsigned int ms;
+    int s;
+
+    if (horizon == 0)
+        return -1;
+
+    for (s = MOEAI_STATE_EMERGENCY; s > MOEAI_STATE_NORMAL; s--) {
+        if (fc->above[s])
+            continue;
+        if (moeai_history_time_to(&fc->history,
+                                  MOEAI_FP(moeai_mem_enter_threshold(&priv->config, s)), &ms) ||
+            ms > horizon)
+            continue;
+
+        if (!fc->pending[s]) {
+            fc->pending[s] = true;
+            fc->deadline[s] = jiffies + msecs_to_jiffies(horizon);
+            fc->predictions++;
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_FORECAST_CROSSING),
+                    moeai_mem_state_name(s), ms / 1000);
+        }
+
+        return s == MOEAI_STATE_EMERGENCY ? MOEAI_MEM_RECLAIM_MODERATE : MOEAI_MEM_RECLAIM_GENTLE;
+    }
+
+    return -1;
 }
 
-/**
- * 执行内存回收
- * @policy: 回收策略
- * 返回值: 回收的内存量，负值表示错误
+/* 清空预测历史，重新开始监控时调用 */
+static void moeai_mem_forecast_reset(struct moeai_mem_forecast *fc)
+{
+    moeai_history_reset(&fc->history);
+    memset(fc->pending, 0, sizeof(fc->pending));
+    memset(fc->above, 0, sizeof(fc->above));
+    fc->last_sample = jiffies;
+}
+
+/*
+ * 切换到新状态并输出日志
  */
-long moeai_mem_reclaim(enum moeai_mem_reclaim_policy policy)
+static void moeai_mem_enter_state(struct moeai_mem_monitor_private *priv,
+                                  enum moeai_system_state next, unsigned int usage)
 {
-    long reclaimed = 0;
-    
-    switch (policy) {
-    case MOEAI_MEM_RECLAIM_GENTLE:
-        /* 仅释放文件缓存 */
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_GENTLE_RECLAIM));
-        reclaimed = drop_page_cache();
-        break;
-        
-    case MOEAI_MEM_RECLAIM_MODERATE:
-        /* 释放所有可回收页面 */
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_MODERATE_RECLAIM));
-        reclaimed = drop_page_cache();
-        reclaimed += drop_slab_cache();
+    struct moeai_mem_state_machine *sm = &priv->sm;
+    enum moeai_system_state prev = sm->state;
+
+    sm->state = next;
+    sm->state_since = jiffies;
+    sm->transitions++;
+    sm->state_entries[next]++;
+
+    moeai_event_hub_publish(MOEAI_HUB_STATE_CHANGE, prev, next, usage);
+
+    /* 进入和离开抖动状态的日志由检查任务输出 */
+    if (next == MOEAI_STATE_THRASHING || prev == MOEAI_STATE_THRASHING)
+        return;
+
+    if (next < prev) {
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_STATE_CHANGED),
+                moeai_mem_state_name(prev), moeai_mem_state_name(next), usage);
+        return;
+    }
+
+    switch (next) {
+    case MOEAI_STATE_EMERGENCY:
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_ABOVE_EMERGENCY),
+                usage, priv->config.emergency_threshold);
         break;
-        
-    case MOEAI_MEM_RECLAIM_AGGRESSIVE:
-        /* 强制内存紧急回收，可能触发OOM */
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_AGGRESSIVE_RECLAIM));
-        reclaimed = drop_page_cache();
-        reclaimed += drop_slab_cache();
-        /* 注意：compact_nodes 函数在当前内核中不可用 */
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_COMPACT_NOT_SUPPORTED));
+    case MOEAI_STATE_CRITICAL:
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_ABOVE_CRITICAL),
+                usage, priv->config.critical_threshold);
         break;
-        
     default:
-        MOEAI_ERROR(MODULE_NAME, lang_get(LANG_MEM_INVALID_POLICY), policy);
-        return -EINVAL;
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_ABOVE_WARNING),
+                usage, priv->config.warn_threshold);
+        break;
     }
-    
-    return reclaimed;
+}
+
+/* 汇总状态机信息与累计计数，调用者持有 stats_lock */
+static void moeai_mem_fill_state(struct moeai_mem_monitor_private *priv,
+                                 struct moeai_mem_state_info *info)
+{
+    struct moeai_mem_state_machine *sm = &priv->sm;
+
+    info->state = sm->state;
+    info->state_ms = jiffies_to_msecs(jiffies - sm->state_since);
+    info->transitions = sm->transitions;
+    memcpy(info->state_entries, sm->state_entries, sizeof(info->state_entries));
+    memcpy(info->reclaim_runs, sm->reclaim_runs, sizeof(info->reclaim_runs));
+    memcpy(info->reclaim_suppressed, sm->reclaim_suppressed, sizeof(info->reclaim_suppressed));
+    info->thrash_window_ms = priv->thrash.rates.interval_ms;
+    info->thrash_rates = priv->thrash.rates;
+    info->thrash_suppressed = priv->thrash.suppressed;
+    info->reclaim_futile = priv->reclaim_futile;
+    info->wmark_low_events = priv->wmark_low_events;
+}
+
+/*
+ * 发布到实时页，调用者持有 stats_lock，因此只有一个写者
+ * @stats: 容量类数据与速率，检查任务传入本次结果，刷新定时器传入新读取的容量
+ */
+static void moeai_mem_publish_live(struct moeai_mem_monitor_private *priv,
+                                   const struct moeai_mem_stats *stats)
+{
+    u32 flags = 0;
+
+    if (priv->config.auto_reclaim)
+        flags |= MOEAI_STATS_F_AUTO_RECLAIM;
+    if (priv->config.wmark_trigger)
+        flags |= MOEAI_STATS_F_WMARK_TRIGGER;
+
+    moeai_mem_fill_state(priv, &priv->live_scratch);
+    moeai_live_update(stats, &priv->live_scratch, flags);
+}
+
+/**
+ * 实时页刷新任务
+ * 检查间隔默认60秒，实时页的容量字段改为每 MOEAI_LIVE_REFRESH_MS 读取一次，
+ * 只调用 si_meminfo 等读取全局计数的函数；速率与状态仍沿用最近一次检查的结果
+ * @t: 定时器指针
+ */
+static void moeai_mem_live_task(struct timer_list *t)
+{
+    struct moeai_mem_monitor_private *priv = from_timer(priv, t, live_timer);
+    struct moeai_mem_stats stats;
+
+    moeai_mem_read_stats(&stats);
+
+    spin_lock(&priv->stats_lock);
+    stats.rates = priv->current_stats.rates;
+    moeai_mem_publish_live(priv, &stats);
+    spin_unlock(&priv->stats_lock);
+
+    if (priv->monitoring_active)
+        mod_timer(&priv->live_timer, jiffies + msecs_to_jiffies(MOEAI_LIVE_REFRESH_MS));
 }
 
 /**
@@ -151,42 +1491,122 @@ static void moeai_mem_check_task(struct timer_list *t)
 {
     struct moeai_mem_monitor_private *priv = from_timer(priv, t, check_timer);
     struct moeai_mem_stats stats;
-    int ret;
+    struct moeai_mem_reclaimable reclaimable;
+    struct moeai_stall_dist stall;
+    enum moeai_system_state next, floor, rate_floor, stall_floor;
+    struct moeai_mem_rates *thrash_rates;
+    int nr_nodes, policy, forecast_policy, ctx;
+    bool thrashing, allow_compact = false;
     
-    /* 获取当前内存状态 */
-    ret = moeai_mem_monitor_get_stats(&stats);
-    if (ret)
-        goto reschedule;
+    /* 获取当前内存状态与活动速率 */
+    moeai_mem_read_stats(&stats);
+    moeai_mem_update_rates(priv, &stats.rates);
+    moeai_mem_estimate_reclaimable(&reclaimable);
+    moeai_stall_sample(&stall);
+    nr_nodes = moeai_mem_collect_nodes(priv->node_scratch, MOEAI_MEM_MAX_NODES);
     
-    /* 更新当前统计信息 */
     spin_lock(&priv->stats_lock);
+
+    /* 更新当前统计信息 */
     memcpy(&priv->current_stats, &stats, sizeof(stats));
-    spin_unlock(&priv->stats_lock);
+    priv->reclaimable = reclaimable;
     
-    /* 检查阈值并采取行动 */
-    if (stats.mem_usage_percent >= priv->config.emergency_threshold) {
-        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_ABOVE_EMERGENCY),
-                stats.mem_usage_percent, priv->config.emergency_threshold);
-                
-        if (priv->config.auto_reclaim)
-            moeai_mem_reclaim(MOEAI_MEM_RECLAIM_AGGRESSIVE);
-            
-    } else if (stats.mem_usage_percent >= priv->config.critical_threshold) {
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_ABOVE_CRITICAL),
-                stats.mem_usage_percent, priv->config.critical_threshold);
-                
-        if (priv->config.auto_reclaim)
-            moeai_mem_reclaim(MOEAI_MEM_RECLAIM_MODERATE);
-            
-    } else if (stats.mem_usage_percent >= priv->config.warn_threshold) {
-        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_ABOVE_WARNING),
-                stats.mem_usage_percent, priv->config.warn_threshold);
-                
-        if (priv->config.auto_reclaim)
-            moeai_mem_reclaim(MOEAI_MEM_RECLAIM_GENTLE);
+    /* 抖动检测优先于普通压力判断 */
+    thrash_rates = &priv->thrash.rates;
+    moeai_mem_thrash_rates(&priv->thrash, thrash_rates);
+    thrashing = moeai_mem_is_thrashing(&priv->config, thrash_rates);
+    rate_floor = moeai_mem_rate_floor(&priv->config, &stats.rates);
+    stall_floor = moeai_mem_stall_floor(&priv->config, &stall);
+    floor = max3(rate_floor, stall_floor, moeai_mem_update_wmarks(priv));
+    moeai_mem_forecast_update(priv, moeai_mem_usage_fp(&stats));
+
+    /* 结算上一次自动回收的效果 */
+    if (priv->outcome.pending && priv->outcome.done) {
+        moeai_mem_policy_record_outcome(priv->outcome.ctx, priv->outcome.policy,
+                                        stats.mem_usage_percent < priv->outcome.threshold);
+        priv->outcome.pending = false;
+    }
+
+    if (priv->sm.state == MOEAI_STATE_THRASHING) {
+        /* 抖动消失且驻留时间已满后，直接回到使用率对应的状态 */
+        if (!thrashing && time_after_eq(jiffies, priv->sm.state_since +
+                                        msecs_to_jiffies(priv->config.min_dwell_ms))) {
+            next = moeai_mem_usage_target(&priv->config, stats.mem_usage_percent, floor);
+            moeai_mem_enter_state(priv, next, stats.mem_usage_percent);
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_THRASHING_CLEARED),
+                    moeai_mem_state_name(next));
+        }
+    } else if (thrashing) {
+        moeai_mem_enter_state(priv, MOEAI_STATE_THRASHING, stats.mem_usage_percent);
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_THRASHING_DETECTED),
+                thrash_rates->pswpin, thrash_rates->pswpout,
+                thrash_rates->refault, thrash_rates->activate);
+        /* 尚未开始执行的回收也一并取消 */
+        if (cancel_work(&priv->reclaim_work)) {
+            priv->thrash.suppressed++;
+            priv->outcome.pending = false;
+        }
+    }
+
+    if (priv->sm.state == MOEAI_STATE_THRASHING) {
+        /* 抖动时回收只会换出马上又要用到的页面，停止一切自动回收 */
+        if (priv->config.auto_reclaim &&
+            moeai_mem_state_policy(moeai_mem_usage_target(&priv->config,
+                                   stats.mem_usage_percent, floor)) >= 0)
+            priv->thrash.suppressed++;
+        moeai_mem_update_nodes(priv, priv->node_scratch, nr_nodes);
+        moeai_mem_publish_live(priv, &priv->current_stats);
+        spin_unlock(&priv->stats_lock);
+        goto reschedule;
+    }
+
+    /* 推进状态机，仅在需要时调度回收 */
+    next = moeai_mem_next_state(&priv->config, &priv->sm, stats.mem_usage_percent, floor);
+    if (next != priv->sm.state) {
+        if (next > priv->sm.state && next <= rate_floor)
+            MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_RATE_PRESSURE),
+                    stats.rates.pgscan_direct, stats.rates.allocstall, stats.rates.refault);
+        else if (next > priv->sm.state && next <= stall_floor)
+            MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEM_STALL_PRESSURE),
+                    stall.p99_us, stall.max_us, stall.count);
+        moeai_mem_enter_state(priv, next, stats.mem_usage_percent);
+    }
+
+    /* 趋势预测可能要求比当前状态更早开始回收 */
+    policy = moeai_mem_state_policy(priv->sm.state);
+    forecast_policy = moeai_mem_forecast_policy(priv);
+    if (policy < 0)
+        priv->futile_notified = false;
+    if (forecast_policy > policy) {
+        if (!moeai_mem_reclaim_futile(priv, forecast_policy) &&
+            moeai_mem_schedule_reclaim(priv, forecast_policy))
+            priv->forecast.triggers++;
+    } else if (policy >= 0 && priv->config.auto_reclaim) {
+        /* 按实测效果在各策略间选择，结果在下一次检查时结算 */
+        ctx = moeai_mem_policy_ctx(priv->sm.state);
+        policy = moeai_mem_policy_select(ctx, policy);
+        if (!moeai_mem_reclaim_futile(priv, policy) &&
+            moeai_mem_schedule_reclaim(priv, policy) && !priv->outcome.pending) {
+            priv->outcome.pending = true;
+            priv->outcome.done = false;
+            priv->outcome.ctx = ctx;
+            priv->outcome.policy = policy;
+            priv->outcome.threshold = moeai_mem_exit_threshold(&priv->config, priv->sm.state);
+        }
     }
 
+    /* 全局使用率可能掩盖单个节点耗尽，逐节点评估 */
+    moeai_mem_update_nodes(priv, priv->node_scratch, nr_nodes);
+    allow_compact = priv->config.auto_reclaim;
+    moeai_mem_publish_live(priv, &priv->current_stats);
+
+    spin_unlock(&priv->stats_lock);
+
 reschedule:
+    /* 高阶空闲块不足时主动规整，抖动期间只采集不规整 */
+    moeai_mem_frag_check(allow_compact);
+    queue_work(system_unbound_wq, &priv->swap_work);
+
     /* 重新调度检查任务 */
     if (priv->monitoring_active) {
         mod_timer(&priv->check_timer, 
@@ -194,12 +1614,115 @@ reschedule:
     }
 }
 
+/* 差值折算为每秒速率 (纳秒间隔)，供突发采样使用 */
+static u64 moeai_mem_rate_ns(unsigned long now, unsigned long prev, u64 interval_ns)
+{
+    if (now <= prev || interval_ns == 0)
+        return 0;
+
+    return div64_u64((u64)(now - prev) * NSEC_PER_SEC, interval_ns);
+}
+
+/* 采集一条突发采样记录，速率相对上一条记录计算 */
+static void moeai_mem_burst_sample(struct moeai_mem_monitor_private *priv,
+                                   struct moeai_snapshot_record *rec, ktime_t now)
+{
+    struct moeai_mem_vm_counters c, *prev = &priv->burst_prev;
+    struct moeai_mem_stats stats;
+    u64 interval_ns = ktime_to_ns(ktime_sub(now, priv->burst_prev_time));
+
+    moeai_mem_read_stats(&stats);
+    moeai_mem_read_counters(&c);
+
+    rec->timestamp_ns = timespec64_to_ns(&stats.timestamp);
+    rec->total_kb = stats.total_ram;
+    rec->free_kb = stats.free_ram;
+    rec->available_kb = stats.available_ram;
+    rec->cached_kb = stats.cached_ram;
+    rec->swap_total_kb = stats.swap_total;
+    rec->swap_free_kb = stats.swap_free;
+    rec->mem_usage_percent = stats.mem_usage_percent;
+    rec->swap_usage_percent = stats.swap_usage_percent;
+    rec->rate_interval_us = div_u64(interval_ns, NSEC_PER_USEC);
+    rec->reserved = 0;
+    rec->pgfault = moeai_mem_rate_ns(c.pgfault, prev->pgfault, interval_ns);
+    rec->pgmajfault = moeai_mem_rate_ns(c.pgmajfault, prev->pgmajfault, interval_ns);
+    rec->pgscan_kswapd = moeai_mem_rate_ns(c.pgscan_kswapd, prev->pgscan_kswapd, interval_ns);
+    rec->pgscan_direct = moeai_mem_rate_ns(c.pgscan_direct, prev->pgscan_direct, interval_ns);
+    rec->pgsteal_kswapd = moeai_mem_rate_ns(c.pgsteal_kswapd, prev->pgsteal_kswapd, interval_ns);
+    rec->pgsteal_direct = moeai_mem_rate_ns(c.pgsteal_direct, prev->pgsteal_direct, interval_ns);
+    rec->allocstall = moeai_mem_rate_ns(c.allocstall, prev->allocstall, interval_ns);
+    rec->refault = moeai_mem_rate_ns(c.refault, prev->refault, interval_ns);
+    rec->pswpin = moeai_mem_rate_ns(c.pswpin, prev->pswpin, interval_ns);
+    rec->pswpout = moeai_mem_rate_ns(c.pswpout, prev->pswpout, interval_ns);
+    rec->activate = moeai_mem_rate_ns(c.activate, prev->activate, interval_ns);
+
+    *prev = c;
+    priv->burst_prev_time = now;
+}
+
+/*
+ * 突发采样定时器回调
+ * 与检查任务相互独立，到时或缓冲区写满后停止，常规检查的节奏不受影响。
+ * 回调错过的周期由 hrtimer_forward_now 跳过，不补采。
+ */
+static enum hrtimer_restart moeai_mem_burst_timer(struct hrtimer *timer)
+{
+    struct moeai_mem_monitor_private *priv =
+        container_of(timer, struct moeai_mem_monitor_private, burst_timer);
+    struct moeai_snapshot_record *rec;
+    ktime_t now = ktime_get();
+
+    rec = moeai_snapshot_next(&priv->burst);
+    if (!rec) {
+        priv->burst.header.flags |= MOEAI_SNAPSHOT_F_TRUNCATED;
+        goto done;
+    }
+
+    moeai_mem_burst_sample(priv, rec, now);
+    moeai_snapshot_commit(&priv->burst);
+
+    if (!ktime_before(now, priv->burst_end))
+        goto done;
+
+    hrtimer_forward_now(timer, priv->burst_interval);
+    return HRTIMER_RESTART;
+
+done:
+    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_BURST_FINISHED), priv->burst.count);
+    priv->burst.header.flags &= ~MOEAI_SNAPSHOT_F_RUNNING;
+    WRITE_ONCE(priv->burst_active, false);
+    return HRTIMER_NORESTART;
+}
+
+/*
+ * 规范化退出阈值：退出阈值必须低于对应的进入阈值
+ */
+static void moeai_mem_normalize_config(struct moeai_mem_monitor_config *config)
+{
+    if (config->warn_exit_threshold >= config->warn_threshold)
+        config->warn_exit_threshold = config->warn_threshold > MOEAI_MEM_DEFAULT_HYSTERESIS ?
+            config->warn_threshold - MOEAI_MEM_DEFAULT_HYSTERESIS : 0;
+    if (config->critical_exit_threshold >= config->critical_threshold)
+        config->critical_exit_threshold = config->critical_threshold > MOEAI_MEM_DEFAULT_HYSTERESIS ?
+            config->critical_threshold - MOEAI_MEM_DEFAULT_HYSTERESIS : 0;
+    if (config->emergency_exit_threshold >= config->emergency_threshold)
+        config->emergency_exit_threshold = config->emergency_threshold > MOEAI_MEM_DEFAULT_HYSTERESIS ?
+            config->emergency_threshold - MOEAI_MEM_DEFAULT_HYSTERESIS : 0;
+    if (config->node_critical_threshold > 100)
+        config->node_critical_threshold = 100;
+    if (config->node_warn_threshold > config->node_critical_threshold)
+        config->node_warn_threshold = config->node_critical_threshold;
+}
+
 /**
  * 初始化内存监控模块
  * 返回值: 0表示成功，负值表示错误
  */
 int moeai_mem_monitor_init(void)
 {
+    int ret;
+    
     /* 分配私有数据 */
     monitor_priv = kzalloc(sizeof(struct moeai_mem_monitor_private), GFP_KERNEL);
     if (!monitor_priv)
@@ -210,16 +1733,101 @@ int moeai_mem_monitor_init(void)
     monitor_priv->config.warn_threshold = 70;       /* 70% */
     monitor_priv->config.critical_threshold = 80;   /* 80% */
     monitor_priv->config.emergency_threshold = 90;  /* 90% */
+    monitor_priv->config.warn_exit_threshold = 65;      /* 65% */
+    monitor_priv->config.critical_exit_threshold = 75;  /* 75% */
+    monitor_priv->config.emergency_exit_threshold = 85; /* 85% */
+    monitor_priv->config.min_dwell_ms = 120000;     /* 120秒 */
+    monitor_priv->config.reclaim_cooldown_ms[MOEAI_MEM_RECLAIM_GENTLE] = 300000;    /* 5分钟 */
+    monitor_priv->config.reclaim_cooldown_ms[MOEAI_MEM_RECLAIM_MODERATE] = 180000;  /* 3分钟 */
+    monitor_priv->config.reclaim_cooldown_ms[MOEAI_MEM_RECLAIM_AGGRESSIVE] = 60000; /* 1分钟 */
+    monitor_priv->config.node_warn_threshold = 85;      /* 85% */
+    monitor_priv->config.node_critical_threshold = 95;  /* 95% */
+    monitor_priv->config.node_reclaim_kb = 65536;       /* 64MB */
+    monitor_priv->config.direct_scan_rate_threshold = 25600; /* 100MB/s (4K页) */
+    monitor_priv->config.allocstall_rate_threshold = 10;     /* 10次/秒 */
+    monitor_priv->config.refault_rate_threshold = 12800;     /* 50MB/s (4K页) */
+    monitor_priv->config.forecast_horizon_ms = 30000;       /* 30秒 */
+    monitor_priv->config.thrash_swap_threshold = 2560;      /* 10MB/s (4K页) */
+    monitor_priv->config.thrash_refault_threshold = 25600;  /* 100MB/s (4K页) */
+    monitor_priv->config.thrash_activate_percent = 50;      /* 50% */
+    monitor_priv->config.min_reclaimable_kb = 65536;        /* 64MB */
+    monitor_priv->config.wmark_trigger = true;
+    monitor_priv->config.stall_warn_us = 10000;             /* 10ms */
+    monitor_priv->config.stall_critical_us = 100000;        /* 100ms */
     monitor_priv->config.auto_reclaim = false;      /* 默认不自动回收 */
     
     spin_lock_init(&monitor_priv->stats_lock);
     monitor_priv->monitoring_active = false;
+    monitor_priv->sm.state = MOEAI_STATE_NORMAL;
+    monitor_priv->sm.state_since = jiffies;
+    moeai_history_init(&monitor_priv->forecast.history,
+                       MOEAI_MEM_FORECAST_ALPHA, MOEAI_MEM_FORECAST_BETA);
     
-    /* 初始化定时器 */
+    /* 初始化定时器与回收工作 */
     timer_setup(&monitor_priv->check_timer, moeai_mem_check_task, 0);
+    timer_setup(&monitor_priv->live_timer, moeai_mem_live_task, 0);
+    INIT_WORK(&monitor_priv->reclaim_work, moeai_mem_reclaim_work);
+    INIT_WORK(&monitor_priv->node_reclaim_work, moeai_mem_node_reclaim_work);
+    INIT_WORK(&monitor_priv->swap_work, moeai_mem_swap_work);
+    nodes_clear(monitor_priv->node_reclaim_pending);
+    moeai_mem_swap_work(&monitor_priv->swap_work);
+    /* 打开 sysfs 文件会睡眠，在这里检测一次，定时器据此决定是否调度节点回收 */
+    monitor_priv->node_reclaim_supported = moeai_mem_node_reclaim_probe();
+    if (!monitor_priv->node_reclaim_supported)
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_NODE_RECLAIM_DISABLED));
+    
+    /* 初始化突发采样定时器 */
+    mutex_init(&monitor_priv->burst_mutex);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 13, 0)
+    hrtimer_setup(&monitor_priv->burst_timer, moeai_mem_burst_timer,
+                  CLOCK_MONOTONIC, HRTIMER_MODE_REL_SOFT);
+#else
+    hrtimer_init(&monitor_priv->burst_timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL_SOFT);
+    monitor_priv->burst_timer.function = moeai_mem_burst_timer;
+#endif
+    
+    /* 初始化碎片监控、策略选择、cgroup 监控、进程RSS排行、停顿统计、工作集估算与主动回收 */
+    ret = moeai_mem_frag_init();
+    if (ret)
+        goto err_frag;
+    ret = moeai_mem_policy_init();
+    if (ret)
+        goto err_policy;
+    ret = moeai_memcg_init();
+    if (ret)
+        goto err_memcg;
+    ret = moeai_rss_init();
+    if (ret)
+        goto err_rss;
+    ret = moeai_stall_init();
+    if (ret)
+        goto err_stall;
+    ret = moeai_wss_init();
+    if (ret)
+        goto err_wss;
+    ret = moeai_proactive_init();
+    if (ret)
+        goto err_proactive;
     
     MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_INIT_COMPLETE));
     return 0;
+
+err_proactive:
+    moeai_wss_exit();
+err_wss:
+    moeai_stall_exit();
+err_stall:
+    moeai_rss_exit();
+err_rss:
+    moeai_memcg_exit();
+err_memcg:
+    moeai_mem_policy_exit();
+err_policy:
+    moeai_mem_frag_exit();
+err_frag:
+    kfree(monitor_priv);
+    monitor_priv = NULL;
+    return ret;
 }
 
 /**
@@ -232,6 +1840,15 @@ void moeai_mem_monitor_exit(void)
     
     /* 确保定时器已停止 */
     moeai_mem_monitor_stop();
+    moeai_mem_burst_stop();
+    moeai_snapshot_free(&monitor_priv->burst);
+    moeai_proactive_exit();
+    moeai_wss_exit();
+    moeai_stall_exit();
+    moeai_rss_exit();
+    moeai_memcg_exit();
+    moeai_mem_policy_exit();
+    moeai_mem_frag_exit();
     
     kfree(monitor_priv);
     monitor_priv = NULL;
@@ -251,12 +1868,25 @@ int moeai_mem_monitor_start(void)
     if (monitor_priv->monitoring_active)
         return 0; /* 已经启动 */
     
-    /* 标记为活动状态 */
+    /* 标记为活动状态，速率从下一次采样重新建立基线 */
+    spin_lock_bh(&monitor_priv->stats_lock);
+    monitor_priv->have_sample = false;
+    moeai_mem_forecast_reset(&monitor_priv->forecast);
+    monitor_priv->thrash.head = 0;
+    monitor_priv->thrash.count = 0;
+    monitor_priv->outcome.pending = false;
+    spin_unlock_bh(&monitor_priv->stats_lock);
     monitor_priv->monitoring_active = true;
     
     /* 启动定时器 */
     mod_timer(&monitor_priv->check_timer, 
              jiffies + msecs_to_jiffies(monitor_priv->config.check_interval_ms));
+    mod_timer(&monitor_priv->live_timer, jiffies + msecs_to_jiffies(MOEAI_LIVE_REFRESH_MS));
+    moeai_memcg_start();
+    moeai_rss_start();
+    moeai_stall_start(); /* 跟踪点不可用时只是缺少停顿统计，不影响其余监控 */
+    moeai_wss_start();
+    moeai_proactive_start();
     
     MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_STARTED), 
               monitor_priv->config.check_interval_ms);
@@ -278,8 +1908,18 @@ void moeai_mem_monitor_stop(void)
     /* 标记为非活动状态 */
     monitor_priv->monitoring_active = false;
     
-    /* 删除定时器 */
+    /* 删除定时器，并等待已排队的回收完成 */
     del_timer_sync(&monitor_priv->check_timer);
+    del_timer_sync(&monitor_priv->live_timer);
+    cancel_work_sync(&monitor_priv->reclaim_work);
+    cancel_work_sync(&monitor_priv->node_reclaim_work);
+    cancel_work_sync(&monitor_priv->swap_work);
+    moeai_mem_frag_stop();
+    moeai_memcg_stop();
+    moeai_rss_stop();
+    moeai_stall_stop();
+    moeai_proactive_stop();
+    moeai_wss_stop();
     
     MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_STOPPED));
 }
@@ -294,7 +1934,9 @@ int moeai_mem_monitor_get_config(struct moeai_mem_monitor_config *config)
     if (!monitor_priv || !config)
         return -EINVAL;
     
+    spin_lock_bh(&monitor_priv->stats_lock);
     *config = monitor_priv->config;
+    spin_unlock_bh(&monitor_priv->stats_lock);
     return 0;
 }
 
@@ -309,7 +1951,10 @@ int moeai_mem_monitor_set_config(const struct moeai_mem_monitor_config *config)
         return -EINVAL;
     
     /* 复制新的配置 */
+    spin_lock_bh(&monitor_priv->stats_lock);
     monitor_priv->config = *config;
+    moeai_mem_normalize_config(&monitor_priv->config);
+    spin_unlock_bh(&monitor_priv->stats_lock);
     
     /* 如果监控已启动，重新调度定时器使用新的间隔 */
     if (monitor_priv->monitoring_active) {
@@ -320,3 +1965,189 @@ int moeai_mem_monitor_set_config(const struct moeai_mem_monitor_config *config)
     MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_CONFIG_UPDATED));
     return 0;
 }
+
+/**
+ * 获取内存压力状态机信息
+ * @info: 存储状态信息的结构体指针
+ * 返回值: 0表示成功，负值表示错误
+ */
+int moeai_mem_monitor_get_state(struct moeai_mem_state_info *info)
+{
+    if (!monitor_priv || !info)
+        return -EINVAL;
+
+    spin_lock_bh(&monitor_priv->stats_lock);
+    moeai_mem_fill_state(monitor_priv, info);
+    spin_unlock_bh(&monitor_priv->stats_lock);
+
+    return 0;
+}
+
+/* 定点百分比转换为 0.01% 单位 */
+static s64 moeai_mem_fp_to_centi(s64 v)
+{
+    return (v * 100) >> MOEAI_FP_SHIFT;
+}
+
+/**
+ * 获取内存压力预测信息
+ * @info: 存储预测信息的结构体指针
+ * 返回值: 0表示成功，负值表示错误
+ */
+int moeai_mem_monitor_get_forecast(struct moeai_mem_forecast_info *info)
+{
+    struct moeai_mem_forecast *fc;
+    unsigned int ms;
+    int s;
+
+    if (!monitor_priv || !info)
+        return -EINVAL;
+
+    fc = &monitor_priv->forecast;
+
+    spin_lock_bh(&monitor_priv->stats_lock);
+    info->samples = fc->history.count;
+    info->level_centi = max_t(s64, moeai_mem_fp_to_centi(fc->history.level), 0);
+    info->trend_centi_per_min = moeai_mem_fp_to_centi(fc->history.trend * 60);
+    for (s = 0; s < MOEAI_STATE_MAX; s++) {
+        info->time_to_ms[s] = MOEAI_MEM_FORECAST_NEVER;
+        if (s != MOEAI_STATE_NORMAL && s != MOEAI_STATE_THRASHING &&
+            moeai_history_time_to(&fc->history,
+                                  MOEAI_FP(moeai_mem_enter_threshold(&monitor_priv->config, s)),
+                                  &ms) == 0)
+            info->time_to_ms[s] = ms;
+    }
+    info->mae_centi = fc->err_count ?
+        moeai_mem_fp_to_centi(div64_u64(fc->abs_err_sum, fc->err_count)) : 0;
+    info->predictions = fc->predictions;
+    info->hits = fc->hits;
+    info->false_alarms = fc->false_alarms;
+    info->misses = fc->misses;
+    info->triggers = fc->triggers;
+    spin_unlock_bh(&monitor_priv->stats_lock);
+
+    return 0;
+}
+
+/**
+ * 启动突发采样
+ * @interval_us: 采样间隔 (微秒)
+ * @duration_ms: 采样时长 (毫秒)
+ * 返回值: 0表示成功，负值表示错误
+ *
+ * 缓冲区在启动时一次性分配，上一次的采样结果随之丢弃。
+ */
+int moeai_mem_burst_start(unsigned int interval_us, unsigned int duration_ms)
+{
+    struct moeai_mem_monitor_private *priv = monitor_priv;
+    u64 capacity;
+    int ret;
+
+    if (!priv)
+        return -EINVAL;
+
+    if (interval_us < MOEAI_MEM_BURST_MIN_INTERVAL_US || duration_ms == 0 ||
+        duration_ms > MOEAI_MEM_BURST_MAX_DURATION_MS)
+        return -EINVAL;
+
+    /* 第 k 次采样不早于启动后 k 个间隔，到时即停，因此记录数不会超过该值 */
+    capacity = DIV_ROUND_UP_ULL((u64)duration_ms * USEC_PER_MSEC, interval_us);
+    if (capacity > MOEAI_SNAPSHOT_MAX_RECORDS)
+        return -E2BIG;
+
+    mutex_lock(&priv->burst_mutex);
+    if (READ_ONCE(priv->burst_active)) {
+        ret = -EBUSY;
+        goto out;
+    }
+
+    /* 等待可能仍在返回途中的上一次回调 */
+    hrtimer_cancel(&priv->burst_timer);
+    moeai_snapshot_free(&priv->burst);
+    ret = moeai_snapshot_alloc(&priv->burst, capacity);
+    if (ret)
+        goto out;
+
+    priv->burst.header.interval_ns = (u64)interval_us * NSEC_PER_USEC;
+    priv->burst.header.start_ns = ktime_get_real_ns();
+    priv->burst.header.flags = MOEAI_SNAPSHOT_F_RUNNING;
+    priv->burst_interval = us_to_ktime(interval_us);
+    priv->burst_duration_ms = duration_ms;
+    moeai_mem_read_counters(&priv->burst_prev);
+    priv->burst_prev_time = ktime_get();
+    priv->burst_end = ktime_add_ms(priv->burst_prev_time, duration_ms);
+    WRITE_ONCE(priv->burst_active, true);
+
+    hrtimer_start(&priv->burst_timer, priv->burst_interval, HRTIMER_MODE_REL_SOFT);
+    MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_BURST_STARTED), interval_us, duration_ms);
+
+out:
+    mutex_unlock(&priv->burst_mutex);
+    return ret;
+}
+
+/**
+ * 提前结束突发采样，已记录的快照保留
+ */
+void moeai_mem_burst_stop(void)
+{
+    struct moeai_mem_monitor_private *priv = monitor_priv;
+
+    if (!priv)
+        return;
+
+    mutex_lock(&priv->burst_mutex);
+    if (hrtimer_cancel(&priv->burst_timer)) {
+        priv->burst.header.flags &= ~MOEAI_SNAPSHOT_F_RUNNING;
+        WRITE_ONCE(priv->burst_active, false);
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEM_BURST_STOPPED), priv->burst.count);
+    }
+    mutex_unlock(&priv->burst_mutex);
+}
+
+/**
+ * 获取突发采样状态
+ * @info: 存储状态的结构体指针
+ * 返回值: 0表示成功，负值表示错误
+ */
+int moeai_mem_burst_get_info(struct moeai_mem_burst_info *info)
+{
+    struct moeai_mem_monitor_private *priv = monitor_priv;
+
+    if (!priv || !info)
+        return -EINVAL;
+
+    mutex_lock(&priv->burst_mutex);
+    info->active = READ_ONCE(priv->burst_active);
+    info->truncated = priv->burst.header.flags & MOEAI_SNAPSHOT_F_TRUNCATED;
+    info->interval_us = div_u64(priv->burst.header.interval_ns, NSEC_PER_USEC);
+    info->duration_ms = priv->burst_duration_ms;
+    info->samples = smp_load_acquire(&priv->burst.count);
+    info->capacity = priv->burst.capacity;
+    mutex_unlock(&priv->burst_mutex);
+
+    return 0;
+}
+
+/**
+ * 以二进制格式导出突发采样结果
+ * @buf: 用户缓冲区
+ * @count: 用户缓冲区大小
+ * @ppos: 文件偏移
+ * 返回值: 复制的字节数，负值表示错误
+ *
+ * 格式见 include/data/snapshot.h；采样进行中读取时只包含已完成的记录。
+ */
+ssize_t moeai_mem_burst_read(char __user *buf, size_t count, loff_t *ppos)
+{
+    ssize_t ret;
+
+    if (!monitor_priv)
+        return -EINVAL;
+
+    mutex_lock(&monitor_priv->burst_mutex);
+    ret = moeai_snapshot_read(&monitor_priv->burst, buf, count, ppos);
+    mutex_unlock(&monitor_priv->burst_mutex);
+
+    return ret;
+}
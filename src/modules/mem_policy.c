@@ -0,0 +1,280 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/mem_policy.c
+ * 描述: 基于实测效果的回收策略选择
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/math64.h>
+#include <linux/log2.h>
+#include "../../include/modules/mem_policy.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "mem_policy"
+
+/* 结算次数达到此值后才可能被视为可靠 */
+#define MOEAI_MEM_POLICY_MIN_TRIALS 3
+
+/* 单个上下文中某策略的学习状态 */
+struct moeai_mem_policy_ctx_arm {
+    u64 trials;
+    u64 successes;
+};
+
+/* 单个策略的开销累计 */
+struct moeai_mem_policy_cost {
+    u64 runs;
+    u64 freed_kb;
+    u64 latency_ns;
+    u64 max_latency_ns;
+};
+
+/* 策略选择私有数据 */
+struct moeai_mem_policy_private {
+    struct moeai_mem_policy_config config;
+    struct moeai_mem_policy_cost cost[MOEAI_MEM_RECLAIM_MAX];
+    struct moeai_mem_policy_ctx_arm arms[MOEAI_MEM_POLICY_NR_CTX][MOEAI_MEM_RECLAIM_MAX];
+    u64 ctx_trials[MOEAI_MEM_POLICY_NR_CTX];
+    unsigned int decisions[MOEAI_MEM_POLICY_NR_CTX];
+    spinlock_t lock;
+};
+
+static struct moeai_mem_policy_private *policy_priv;
+
+/*
+ * 成功率的置信半径 (百分比)，即 Hoeffding 界 sqrt(ln(t) / 2n)
+ * ln(t) 用 ilog2(t) * 0.693 近似: 100 * sqrt(0.693 * ilog2(t) / 2n) = sqrt(3465 * ilog2(t) / n)
+ */
+static unsigned int moeai_mem_policy_radius(u64 trials, u64 ctx_trials)
+{
+    unsigned int log_t = max_t(unsigned int, 1, ilog2(ctx_trials + 1));
+
+    return int_sqrt(div64_u64(3465ULL * log_t, trials));
+}
+
+/* 计算成功率及其置信区间 */
+static void moeai_mem_policy_bounds(const struct moeai_mem_policy_ctx_arm *arm, u64 ctx_trials,
+                                    unsigned int *rate, unsigned int *lower, unsigned int *upper)
+{
+    unsigned int r;
+
+    if (arm->trials == 0) {
+        *rate = 0;
+        *lower = 0;
+        *upper = 100;
+        return;
+    }
+
+    *rate = div64_u64(arm->successes * 100, arm->trials);
+    r = moeai_mem_policy_radius(arm->trials, ctx_trials);
+    *lower = *rate > r ? *rate - r : 0;
+    *upper = min(*rate + r, 100U);
+}
+
+/*
+ * 判断策略 a 的开销是否低于 b
+ * 两者都有实测数据时比较平均耗时，否则假定越积极的策略开销越高。
+ */
+static bool moeai_mem_policy_cheaper(const struct moeai_mem_policy_private *priv, int a, int b)
+{
+    const struct moeai_mem_policy_cost *ca = &priv->cost[a], *cb = &priv->cost[b];
+    u64 mean_a, mean_b;
+
+    if (!ca->runs || !cb->runs)
+        return a < b;
+
+    mean_a = div64_u64(ca->latency_ns, ca->runs);
+    mean_b = div64_u64(cb->latency_ns, cb->runs);
+    if (mean_a != mean_b)
+        return mean_a < mean_b;
+    return a < b;
+}
+
+/* 按开销从低到高排列策略 */
+static void moeai_mem_policy_order(const struct moeai_mem_policy_private *priv, int *order)
+{
+    int i, j, p;
+
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        p = i;
+        for (j = i; j > 0 && moeai_mem_policy_cheaper(priv, p, order[j - 1]); j--)
+            order[j] = order[j - 1];
+        order[j] = p;
+    }
+}
+
+int moeai_mem_policy_select(int ctx, int default_policy)
+{
+    struct moeai_mem_policy_private *priv = policy_priv;
+    unsigned int rate[MOEAI_MEM_RECLAIM_MAX], lower[MOEAI_MEM_RECLAIM_MAX];
+    unsigned int upper[MOEAI_MEM_RECLAIM_MAX];
+    int order[MOEAI_MEM_RECLAIM_MAX];
+    int i, p, choice = -1;
+
+    if (!priv || ctx < 0 || ctx >= MOEAI_MEM_POLICY_NR_CTX ||
+        default_policy < 0 || default_policy >= MOEAI_MEM_RECLAIM_MAX)
+        return default_policy;
+
+    spin_lock_bh(&priv->lock);
+
+    if (!priv->config.adaptive) {
+        choice = default_policy;
+        goto out;
+    }
+
+    priv->decisions[ctx]++;
+    for (p = 0; p < MOEAI_MEM_RECLAIM_MAX; p++)
+        moeai_mem_policy_bounds(&priv->arms[ctx][p], priv->ctx_trials[ctx],
+                                &rate[p], &lower[p], &upper[p]);
+    moeai_mem_policy_order(priv, order);
+
+    /* 已被证明可靠的策略中开销最低的一个 */
+    for (i = 0; i < MOEAI_MEM_RECLAIM_MAX; i++) {
+        p = order[i];
+        if (priv->arms[ctx][p].trials >= MOEAI_MEM_POLICY_MIN_TRIALS &&
+            lower[p] >= priv->config.target_percent) {
+            choice = p;
+            break;
+        }
+    }
+
+    if (choice >= 0) {
+        /* 定期尝试更便宜且尚未被证明不可靠的策略，紧急状态下不冒险 */
+        if (priv->config.explore_interval &&
+            ctx != moeai_mem_policy_ctx(MOEAI_STATE_EMERGENCY) &&
+            priv->decisions[ctx] % priv->config.explore_interval == 0) {
+            for (i = 0; order[i] != choice; i++) {
+                if (upper[order[i]] >= priv->config.target_percent) {
+                    choice = order[i];
+                    break;
+                }
+            }
+        }
+    } else {
+        /* 没有可靠策略时选择置信上界最高的，并列时优先默认策略，其次更积极的策略 */
+        choice = default_policy;
+        for (p = MOEAI_MEM_RECLAIM_MAX - 1; p >= 0; p--) {
+            if (upper[p] > upper[choice])
+                choice = p;
+        }
+    }
+
+    if (choice != default_policy)
+        MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_MEM_POLICY_SELECTED),
+                    moeai_mem_policy_name(choice), moeai_mem_policy_name(default_policy),
+                    rate[choice], priv->arms[ctx][choice].trials);
+
+out:
+    spin_unlock_bh(&priv->lock);
+    return choice;
+}
+
+void moeai_mem_policy_record_run(int policy, unsigned long freed_kb, u64 latency_ns)
+{
+    struct moeai_mem_policy_cost *c;
+
+    if (!policy_priv || policy < 0 || policy >= MOEAI_MEM_RECLAIM_MAX)
+        return;
+
+    spin_lock_bh(&policy_priv->lock);
+    c = &policy_priv->cost[policy];
+    c->runs++;
+    c->freed_kb += freed_kb;
+    c->latency_ns += latency_ns;
+    c->max_latency_ns = max(c->max_latency_ns, latency_ns);
+    spin_unlock_bh(&policy_priv->lock);
+}
+
+void moeai_mem_policy_record_outcome(int ctx, int policy, bool success)
+{
+    if (!policy_priv || ctx < 0 || ctx >= MOEAI_MEM_POLICY_NR_CTX ||
+        policy < 0 || policy >= MOEAI_MEM_RECLAIM_MAX)
+        return;
+
+    spin_lock_bh(&policy_priv->lock);
+    policy_priv->arms[ctx][policy].trials++;
+    if (success)
+        policy_priv->arms[ctx][policy].successes++;
+    policy_priv->ctx_trials[ctx]++;
+    spin_unlock_bh(&policy_priv->lock);
+}
+
+int moeai_mem_policy_get_stats(struct moeai_mem_policy_stats *stats)
+{
+    const struct moeai_mem_policy_cost *c;
+    int p, ctx;
+
+    if (!policy_priv || !stats)
+        return -EINVAL;
+
+    spin_lock_bh(&policy_priv->lock);
+    for (p = 0; p < MOEAI_MEM_RECLAIM_MAX; p++) {
+        c = &policy_priv->cost[p];
+        stats[p].runs = c->runs;
+        stats[p].freed_kb = c->freed_kb;
+        stats[p].latency_us = div_u64(c->latency_ns, NSEC_PER_USEC);
+        stats[p].max_latency_us = div_u64(c->max_latency_ns, NSEC_PER_USEC);
+        for (ctx = 0; ctx < MOEAI_MEM_POLICY_NR_CTX; ctx++) {
+            struct moeai_mem_policy_arm *arm = &stats[p].arms[ctx];
+
+            arm->trials = policy_priv->arms[ctx][p].trials;
+            arm->successes = policy_priv->arms[ctx][p].successes;
+            moeai_mem_policy_bounds(&policy_priv->arms[ctx][p], policy_priv->ctx_trials[ctx],
+                                    &arm->success_percent, &arm->lower_percent,
+                                    &arm->upper_percent);
+        }
+    }
+    spin_unlock_bh(&policy_priv->lock);
+
+    return 0;
+}
+
+int moeai_mem_policy_get_config(struct moeai_mem_policy_config *config)
+{
+    if (!policy_priv || !config)
+        return -EINVAL;
+
+    spin_lock_bh(&policy_priv->lock);
+    *config = policy_priv->config;
+    spin_unlock_bh(&policy_priv->lock);
+    return 0;
+}
+
+int moeai_mem_policy_set_config(const struct moeai_mem_policy_config *config)
+{
+    if (!policy_priv || !config || config->target_percent > 100)
+        return -EINVAL;
+
+    spin_lock_bh(&policy_priv->lock);
+    policy_priv->config = *config;
+    spin_unlock_bh(&policy_priv->lock);
+    return 0;
+}
+
+int moeai_mem_policy_init(void)
+{
+    policy_priv = kzalloc(sizeof(*policy_priv), GFP_KERNEL);
+    if (!policy_priv)
+        return -ENOMEM;
+
+    policy_priv->config.adaptive = true;
+    policy_priv->config.target_percent = 80;    /* 80% */
+    policy_priv->config.explore_interval = 8;
+
+    spin_lock_init(&policy_priv->lock);
+    return 0;
+}
+
+void moeai_mem_policy_exit(void)
+{
+    kfree(policy_priv);
+    policy_priv = NULL;
+}
@@ -0,0 +1,346 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/mem_proactive.c
+ * 描述: 针对选中 cgroup 的主动冷内存回收
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/string.h>
+#include <linux/math64.h>
+#include "../../include/modules/mem_proactive.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "mem_proactive"
+
+/* 退避时每轮请求量的下限 (KB) */
+#define MOEAI_PROACTIVE_MIN_STEP_KB 1024
+
+/* 连续退避时跳过的轮数上限 */
+#define MOEAI_PROACTIVE_MAX_SKIP 8
+
+/* memory.stat 中的重新缺页计数，5.9 起按匿名与文件拆分 */
+static const char * const moeai_proactive_refault_keys[] = {
+    "workingset_refault_anon",
+    "workingset_refault_file",
+    "workingset_refault",
+};
+
+/* 选中的 cgroup */
+struct moeai_proactive_target {
+    struct moeai_proactive_stats stats;
+    u64 prev_refault;               /* 上一轮读到的重新缺页页数 */
+    bool have_refault;
+    unsigned int streak;            /* 连续退避次数 */
+    bool used;
+};
+
+/* 主动回收私有数据 */
+struct moeai_proactive_private {
+    struct moeai_proactive_config config;
+    struct moeai_proactive_target targets[MOEAI_PROACTIVE_MAX_TARGETS];
+    struct moeai_proactive_target scratch; /* 工作线程在锁外处理的副本 */
+    bool active;
+    struct delayed_work work;       /* 写 memory.reclaim 会同步回收，放到工作队列中执行 */
+    struct mutex lock;              /* 保护配置与选中列表 */
+};
+
+static struct moeai_proactive_private *proactive_priv;
+
+/* 读取 cgroup 的重新缺页页数 */
+static int moeai_proactive_read_refault(const char *path, u64 *pages)
+{
+    u64 values[ARRAY_SIZE(moeai_proactive_refault_keys)];
+    int ret, i;
+
+    ret = moeai_memcg_read_stat(path, moeai_proactive_refault_keys, values,
+                                ARRAY_SIZE(moeai_proactive_refault_keys));
+    if (ret)
+        return ret;
+
+    *pages = 0;
+    for (i = 0; i < ARRAY_SIZE(values); i++)
+        *pages += values[i];
+    return 0;
+}
+
+/*
+ * 根据上一轮回收之后的重新缺页量调整节奏
+ * 代价 = 重新缺页量 / 上一轮回收量。超过上限说明回收的是还要用的页，
+ * 请求量减半并跳过若干轮 (连续退避时跳过的轮数翻倍)；否则请求量逐步恢复。
+ */
+static void moeai_proactive_pace(const struct moeai_proactive_config *config,
+                                 struct moeai_proactive_target *t, u64 refault_bytes)
+{
+    struct moeai_proactive_stats *st = &t->stats;
+
+    if (!st->last_reclaimed_bytes)
+        return;
+
+    st->cost_permille = min_t(u64, div64_u64(refault_bytes * 1000, st->last_reclaimed_bytes),
+                              UINT_MAX);
+    if (st->cost_permille > config->max_cost_permille) {
+        st->backoffs++;
+        st->step_kb = max_t(unsigned int, st->step_kb / 2, MOEAI_PROACTIVE_MIN_STEP_KB);
+        st->skip = min_t(unsigned int, 1U << min(t->streak, 3U), MOEAI_PROACTIVE_MAX_SKIP);
+        t->streak++;
+        MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_PROACTIVE_BACKOFF), st->path,
+                    st->cost_permille, st->step_kb, st->skip);
+    } else {
+        t->streak = 0;
+        st->step_kb = min(st->step_kb + max(config->step_kb / 4, 1U), config->step_kb);
+    }
+}
+
+/* 对一个 cgroup 执行一轮，可能睡眠 */
+static void moeai_proactive_round(const struct moeai_proactive_config *config,
+                                  struct moeai_proactive_target *t)
+{
+    struct moeai_proactive_stats *st = &t->stats;
+    u64 refault, refault_bytes = 0, before, after, request;
+    unsigned long cold_kb;
+    int ret;
+
+    /* 重新缺页量每轮都读取，退避期间的增量不会算到下一次回收头上 */
+    if (moeai_proactive_read_refault(st->path, &refault) == 0) {
+        if (t->have_refault && refault > t->prev_refault)
+            refault_bytes = (refault - t->prev_refault) * PAGE_SIZE;
+        t->prev_refault = refault;
+        t->have_refault = true;
+    }
+    if (st->rounds)
+        st->refault_bytes += refault_bytes;
+    moeai_proactive_pace(config, t, refault_bytes);
+    st->last_reclaimed_bytes = 0;
+
+    if (st->skip) {
+        st->skip--;
+        return;
+    }
+
+    /* 工作集估算覆盖了该 cgroup 时，回收量不超过其冷内存 */
+    request = (u64)st->step_kb * 1024;
+    if (moeai_wss_target_cold_kb(st->path, &cold_kb))
+        request = min_t(u64, request, (u64)cold_kb * 1024);
+    if (!request)
+        return;
+
+    if (moeai_memcg_read_value(st->path, "memory.current", &before))
+        return;
+    ret = moeai_memcg_reclaim(st->path, request);
+    if (ret == -EAGAIN) {
+        st->short_rounds++;
+    } else if (ret) {
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_PROACTIVE_FAILED), st->path, ret);
+        return;
+    }
+    if (moeai_memcg_read_value(st->path, "memory.current", &after))
+        return;
+
+    st->rounds++;
+    st->last_reclaimed_bytes = before > after ? before - after : 0;
+    st->reclaimed_bytes += st->last_reclaimed_bytes;
+}
+
+static struct moeai_proactive_target *moeai_proactive_find(struct moeai_proactive_private *priv,
+                                                          const char *path)
+{
+    int i;
+
+    for (i = 0; i < MOEAI_PROACTIVE_MAX_TARGETS; i++) {
+        if (priv->targets[i].used && strcmp(priv->targets[i].stats.path, path) == 0)
+            return &priv->targets[i];
+    }
+    return NULL;
+}
+
+/* 依次处理各 cgroup，回收期间不持有锁，统计可以随时读取 */
+static void moeai_proactive_work(struct work_struct *work)
+{
+    struct moeai_proactive_private *priv =
+        container_of(to_delayed_work(work), struct moeai_proactive_private, work);
+    struct moeai_proactive_config config;
+    struct moeai_proactive_target *t;
+    int i;
+
+    for (i = 0; i < MOEAI_PROACTIVE_MAX_TARGETS; i++) {
+        mutex_lock(&priv->lock);
+        config = priv->config;
+        if (!config.enabled || !priv->targets[i].used) {
+            mutex_unlock(&priv->lock);
+            continue;
+        }
+        priv->scratch = priv->targets[i];
+        mutex_unlock(&priv->lock);
+
+        moeai_proactive_round(&config, &priv->scratch);
+
+        /* 回收期间该 cgroup 可能已被取消选中 */
+        mutex_lock(&priv->lock);
+        t = moeai_proactive_find(priv, priv->scratch.stats.path);
+        if (t)
+            *t = priv->scratch;
+        mutex_unlock(&priv->lock);
+        cond_resched();
+    }
+
+    mutex_lock(&priv->lock);
+    config = priv->config;
+    mutex_unlock(&priv->lock);
+    if (config.enabled && READ_ONCE(priv->active))
+        queue_delayed_work(system_unbound_wq, &priv->work,
+                           msecs_to_jiffies(config.interval_ms));
+}
+
+/* 开启时调度下一轮 */
+static void moeai_proactive_kick(struct moeai_proactive_private *priv, bool enabled)
+{
+    if (enabled && READ_ONCE(priv->active))
+        queue_delayed_work(system_unbound_wq, &priv->work, 0);
+}
+
+int moeai_proactive_set_target(const char *path, bool enable)
+{
+    struct moeai_proactive_target *t;
+    u64 value;
+    int i, ret = 0;
+
+    if (!proactive_priv || !path || path[0] != '/' || strlen(path) >= MOEAI_MEMCG_PATH_LEN)
+        return -EINVAL;
+
+    /* 未启用内存控制器的 cgroup 无法主动回收 */
+    if (enable && moeai_memcg_read_value(path, "memory.current", &value))
+        return -ENOENT;
+
+    mutex_lock(&proactive_priv->lock);
+    t = moeai_proactive_find(proactive_priv, path);
+    if (!enable) {
+        if (t)
+            t->used = false;
+    } else if (!t) {
+        for (i = 0; !t && i < MOEAI_PROACTIVE_MAX_TARGETS; i++) {
+            if (!proactive_priv->targets[i].used)
+                t = &proactive_priv->targets[i];
+        }
+        if (t) {
+            memset(t, 0, sizeof(*t));
+            strscpy(t->stats.path, path, sizeof(t->stats.path));
+            t->stats.step_kb = proactive_priv->config.step_kb;
+            t->used = true;
+        } else {
+            ret = -ENOSPC;
+        }
+    }
+    mutex_unlock(&proactive_priv->lock);
+
+    return ret;
+}
+
+int moeai_proactive_get_stats(struct moeai_proactive_stats *out, int max)
+{
+    int i, count = 0;
+
+    if (!proactive_priv || !out || max <= 0)
+        return -EINVAL;
+
+    mutex_lock(&proactive_priv->lock);
+    for (i = 0; i < MOEAI_PROACTIVE_MAX_TARGETS && count < max; i++) {
+        if (proactive_priv->targets[i].used)
+            out[count++] = proactive_priv->targets[i].stats;
+    }
+    mutex_unlock(&proactive_priv->lock);
+
+    return count;
+}
+
+int moeai_proactive_get_config(struct moeai_proactive_config *config)
+{
+    if (!proactive_priv || !config)
+        return -EINVAL;
+
+    mutex_lock(&proactive_priv->lock);
+    *config = proactive_priv->config;
+    mutex_unlock(&proactive_priv->lock);
+    return 0;
+}
+
+int moeai_proactive_set_config(const struct moeai_proactive_config *config)
+{
+    int i;
+
+    if (!proactive_priv || !config)
+        return -EINVAL;
+    if (config->interval_ms == 0 || config->step_kb < MOEAI_PROACTIVE_MIN_STEP_KB)
+        return -EINVAL;
+
+    mutex_lock(&proactive_priv->lock);
+    proactive_priv->config = *config;
+    for (i = 0; i < MOEAI_PROACTIVE_MAX_TARGETS; i++) {
+        struct moeai_proactive_stats *st = &proactive_priv->targets[i].stats;
+
+        st->step_kb = min(st->step_kb, config->step_kb);
+    }
+    mutex_unlock(&proactive_priv->lock);
+
+    moeai_proactive_kick(proactive_priv, config->enabled);
+    return 0;
+}
+
+void moeai_proactive_start(void)
+{
+    struct moeai_proactive_config config;
+
+    if (!proactive_priv || READ_ONCE(proactive_priv->active))
+        return;
+
+    WRITE_ONCE(proactive_priv->active, true);
+    moeai_proactive_get_config(&config);
+    moeai_proactive_kick(proactive_priv, config.enabled);
+}
+
+void moeai_proactive_stop(void)
+{
+    if (!proactive_priv)
+        return;
+
+    WRITE_ONCE(proactive_priv->active, false);
+    cancel_delayed_work_sync(&proactive_priv->work);
+}
+
+int moeai_proactive_init(void)
+{
+    proactive_priv = kzalloc(sizeof(*proactive_priv), GFP_KERNEL);
+    if (!proactive_priv)
+        return -ENOMEM;
+
+    proactive_priv->config.enabled = false;            /* 默认关闭 */
+    proactive_priv->config.interval_ms = 30000;        /* 30秒 */
+    proactive_priv->config.step_kb = 16384;            /* 16MB */
+    proactive_priv->config.max_cost_permille = 20;     /* 2% */
+
+    mutex_init(&proactive_priv->lock);
+    INIT_DELAYED_WORK(&proactive_priv->work, moeai_proactive_work);
+    return 0;
+}
+
+void moeai_proactive_exit(void)
+{
+    if (!proactive_priv)
+        return;
+
+    moeai_proactive_stop();
+    kfree(proactive_priv);
+    proactive_priv = NULL;
+}
@@ -0,0 +1,895 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/memcg_monitor.c
+ * 描述: 内存 cgroup 压力监控
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/fs.h>
+#include <linux/list.h>
+#include <linux/hashtable.h>
+#include <linux/jhash.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/string.h>
+#include <linux/sort.h>
+#include <linux/math64.h>
+#include <linux/version.h>
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/modules/mem_monitor.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "memcg"
+
+/* 路径哈希表大小 (2^8 个桶) */
+#define MOEAI_MEMCG_HASH_BITS 8
+
+/* 读取 memory.* 文件的缓冲区大小，memory.pressure 两行约130字节 */
+#define MOEAI_MEMCG_FILE_LEN 256
+
+/* filldir 回调的返回值在 6.1 由 int 改为 bool */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 1, 0)
+#define MOEAI_FILLDIR_RET      bool
+#define MOEAI_FILLDIR_CONTINUE true
+#define MOEAI_FILLDIR_STOP     false
+#else
+#define MOEAI_FILLDIR_RET      int
+#define MOEAI_FILLDIR_CONTINUE 0
+#define MOEAI_FILLDIR_STOP     -ENOSPC
+#endif
+
+/* memory.reclaim 在 6.11 开始接受 swappiness 参数，为0时只回收文件页 */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 11, 0)
+#define MOEAI_MEMCG_RECLAIM_FILE_ARGS " swappiness=0"
+#else
+#define MOEAI_MEMCG_RECLAIM_FILE_ARGS ""
+#endif
+
+/* 跟踪中的 cgroup */
+struct moeai_memcg_entry {
+    struct list_head node;          /* 遍历顺序 (广度优先) */
+    struct hlist_node hash;         /* 按路径查找 */
+    struct moeai_memcg_stats stats;
+    u64 seen_pass;                  /* 最近一次被父目录列出的遍历轮次 */
+    int heap_idx;                   /* 在最小堆中的位置，-1表示不在堆中 */
+    bool has_memory;                /* 是否启用了内存控制器 */
+    bool override;                  /* 是否单独设置了阈值 */
+};
+
+/* 单独设置的阈值 */
+struct moeai_memcg_override {
+    char path[MOEAI_MEMCG_PATH_LEN];
+    unsigned int warn_percent;
+    unsigned int critical_percent;
+    bool used;
+};
+
+/* 目录遍历上下文，子目录名依次以 '\0' 分隔存入缓冲区 */
+struct moeai_memcg_dir_ctx {
+    struct dir_context ctx;
+    char *buf;
+    size_t len;
+    size_t size;
+    bool full;
+};
+
+/* cgroup 监控私有数据 */
+struct moeai_memcg_private {
+    struct moeai_memcg_config config;
+    struct list_head entries;
+    DECLARE_HASHTABLE(table, MOEAI_MEMCG_HASH_BITS);
+    struct moeai_memcg_entry *root;
+    struct moeai_memcg_entry *cursor;   /* 下一个要访问的条目，NULL表示本轮已结束 */
+    struct moeai_memcg_entry *heap[MOEAI_MEMCG_MAX_TOP]; /* 按使用比例排列的最小堆 */
+    unsigned int heap_size;
+    struct moeai_memcg_override overrides[MOEAI_MEMCG_MAX_OVERRIDES];
+    unsigned int tracked;
+    u64 pass;                       /* 当前遍历轮次 */
+    u64 passes;
+    unsigned long pass_start;       /* 本轮开始时间 (jiffies) */
+    unsigned int last_pass_ms;
+    u64 dropped;
+    u64 events;
+    bool available;
+    bool active;
+    char *name_buf;                 /* 子目录名缓冲 (一页) */
+    char file_buf[MOEAI_MEMCG_FILE_LEN];
+    char path_buf[sizeof(MOEAI_MEMCG_ROOT) + MOEAI_MEMCG_PATH_LEN + 32];
+    struct delayed_work scan_work;  /* 读取 cgroup 文件会睡眠，遍历放到工作队列中执行 */
+    struct mutex lock;              /* 保护条目的增删与统计，遍历工作是唯一的修改者 */
+};
+
+static struct moeai_memcg_private *memcg_priv;
+
+/* 读取 cgroup 目录下的一个文件到 file_buf */
+static int moeai_memcg_read_file(struct moeai_memcg_private *priv, const char *path,
+                                 const char *name)
+{
+    struct file *filp;
+    loff_t pos = 0;
+    ssize_t len;
+
+    snprintf(priv->path_buf, sizeof(priv->path_buf), MOEAI_MEMCG_ROOT "%s/%s", path, name);
+    filp = filp_open(priv->path_buf, O_RDONLY, 0);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+
+    len = kernel_read(filp, priv->file_buf, sizeof(priv->file_buf) - 1, &pos);
+    filp_close(filp, NULL);
+    if (len < 0)
+        return len;
+
+    priv->file_buf[len] = '\0';
+    return 0;
+}
+
+/* 解析 "avg10=X.YY" 形式的压力值，返回 0.01% 单位 */
+static unsigned int moeai_memcg_parse_psi(const char *buf, const char *prefix)
+{
+    unsigned int whole, frac;
+    const char *p = strstr(buf, prefix);
+
+    if (!p || sscanf(p + strlen(prefix), "%u.%u", &whole, &frac) != 2)
+        return 0;
+
+    return whole * 100 + frac;
+}
+
+/*
+ * 读取 cgroup 的内存用量、限制和压力
+ * 没有 memory.current 说明该 cgroup 未启用内存控制器
+ */
+static int moeai_memcg_read_stats(struct moeai_memcg_private *priv, const char *path,
+                                  struct moeai_memcg_stats *s)
+{
+    int ret;
+
+    ret = moeai_memcg_read_file(priv, path, "memory.current");
+    if (ret)
+        return ret;
+    if (kstrtou64(strim(priv->file_buf), 10, &s->usage_bytes))
+        return -EINVAL;
+
+    s->limit_bytes = 0;
+    if (moeai_memcg_read_file(priv, path, "memory.max") == 0 &&
+        strncmp(priv->file_buf, "max", 3) != 0 &&
+        kstrtou64(strim(priv->file_buf), 10, &s->limit_bytes))
+        s->limit_bytes = 0;
+
+    s->psi_some_centi = 0;
+    s->psi_full_centi = 0;
+    if (moeai_memcg_read_file(priv, path, "memory.pressure") == 0) {
+        s->psi_some_centi = moeai_memcg_parse_psi(priv->file_buf, "some avg10=");
+        s->psi_full_centi = moeai_memcg_parse_psi(priv->file_buf, "full avg10=");
+    }
+
+    return 0;
+}
+
+/* 最小堆: 堆顶是列表中离限制最远的 cgroup，新候选只需与堆顶比较 */
+static unsigned int moeai_memcg_key(const struct moeai_memcg_private *priv, unsigned int i)
+{
+    return priv->heap[i]->stats.usage_permyriad;
+}
+
+static void moeai_memcg_heap_swap(struct moeai_memcg_private *priv, unsigned int i, unsigned int j)
+{
+    swap(priv->heap[i], priv->heap[j]);
+    priv->heap[i]->heap_idx = i;
+    priv->heap[j]->heap_idx = j;
+}
+
+static void moeai_memcg_heap_sift_up(struct moeai_memcg_private *priv, unsigned int i)
+{
+    unsigned int parent;
+
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (moeai_memcg_key(priv, i) >= moeai_memcg_key(priv, parent))
+            break;
+        moeai_memcg_heap_swap(priv, i, parent);
+        i = parent;
+    }
+}
+
+static void moeai_memcg_heap_sift_down(struct moeai_memcg_private *priv, unsigned int i)
+{
+    unsigned int l, r, min;
+
+    for (;;) {
+        l = 2 * i + 1;
+        r = l + 1;
+        min = i;
+        if (l < priv->heap_size && moeai_memcg_key(priv, l) < moeai_memcg_key(priv, min))
+            min = l;
+        if (r < priv->heap_size && moeai_memcg_key(priv, r) < moeai_memcg_key(priv, min))
+            min = r;
+        if (min == i)
+            break;
+        moeai_memcg_heap_swap(priv, i, min);
+        i = min;
+    }
+}
+
+static void moeai_memcg_heap_remove(struct moeai_memcg_private *priv, struct moeai_memcg_entry *e)
+{
+    unsigned int i = e->heap_idx, last = --priv->heap_size;
+
+    e->heap_idx = -1;
+    if (i == last)
+        return;
+
+    priv->heap[i] = priv->heap[last];
+    priv->heap[i]->heap_idx = i;
+    moeai_memcg_heap_sift_up(priv, i);
+    moeai_memcg_heap_sift_down(priv, priv->heap[i]->heap_idx);
+}
+
+/*
+ * 使用比例变化后调整条目在堆中的位置
+ * 每轮遍历会访问所有条目，被挤出堆的条目在下一次访问时重新参与比较，
+ * 因此一轮之后堆中一定是最接近限制的 top_n 个 cgroup。
+ */
+static void moeai_memcg_heap_update(struct moeai_memcg_private *priv, struct moeai_memcg_entry *e)
+{
+    unsigned int key = e->stats.usage_permyriad;
+
+    if (e->heap_idx >= 0) {
+        if (!key) {
+            moeai_memcg_heap_remove(priv, e);
+            return;
+        }
+        moeai_memcg_heap_sift_up(priv, e->heap_idx);
+        moeai_memcg_heap_sift_down(priv, e->heap_idx);
+        return;
+    }
+
+    /* 没有限制的 cgroup 不参与排名 */
+    if (!key || !priv->config.top_n)
+        return;
+
+    if (priv->heap_size < priv->config.top_n) {
+        priv->heap[priv->heap_size] = e;
+        e->heap_idx = priv->heap_size++;
+        moeai_memcg_heap_sift_up(priv, e->heap_idx);
+    } else if (key > moeai_memcg_key(priv, 0)) {
+        priv->heap[0]->heap_idx = -1;
+        priv->heap[0] = e;
+        e->heap_idx = 0;
+        moeai_memcg_heap_sift_down(priv, 0);
+    }
+}
+
+/* 按当前配置重建堆 */
+static void moeai_memcg_heap_rebuild(struct moeai_memcg_private *priv)
+{
+    struct moeai_memcg_entry *e;
+
+    list_for_each_entry(e, &priv->entries, node)
+        e->heap_idx = -1;
+    priv->heap_size = 0;
+    list_for_each_entry(e, &priv->entries, node)
+        moeai_memcg_heap_update(priv, e);
+}
+
+/* 查找单独设置的阈值 */
+static struct moeai_memcg_override *moeai_memcg_find_override(struct moeai_memcg_private *priv,
+                                                              const char *path)
+{
+    int i;
+
+    for (i = 0; i < MOEAI_MEMCG_MAX_OVERRIDES; i++) {
+        if (priv->overrides[i].used && strcmp(priv->overrides[i].path, path) == 0)
+            return &priv->overrides[i];
+    }
+    return NULL;
+}
+
+/* 为条目设置生效的阈值 */
+static void moeai_memcg_apply_thresholds(struct moeai_memcg_private *priv,
+                                         struct moeai_memcg_entry *e)
+{
+    struct moeai_memcg_override *o = moeai_memcg_find_override(priv, e->stats.path);
+
+    e->override = o != NULL;
+    e->stats.warn_percent = o ? o->warn_percent : priv->config.warn_percent;
+    e->stats.critical_percent = o ? o->critical_percent : priv->config.critical_percent;
+}
+
+static struct moeai_memcg_entry *moeai_memcg_lookup(struct moeai_memcg_private *priv,
+                                                    const char *path)
+{
+    struct moeai_memcg_entry *e;
+    u32 key = jhash(path, strlen(path), 0);
+
+    hash_for_each_possible(priv->table, e, hash, key) {
+        if (strcmp(e->stats.path, path) == 0)
+            return e;
+    }
+    return NULL;
+}
+
+static struct moeai_memcg_entry *moeai_memcg_add(struct moeai_memcg_private *priv,
+                                                 const char *path)
+{
+    struct moeai_memcg_entry *e;
+
+    e = kzalloc(sizeof(*e), GFP_KERNEL);
+    if (!e)
+        return NULL;
+
+    strscpy(e->stats.path, path, sizeof(e->stats.path));
+    e->stats.state = MOEAI_STATE_NORMAL;
+    e->heap_idx = -1;
+    moeai_memcg_apply_thresholds(priv, e);
+    list_add_tail(&e->node, &priv->entries);
+    hash_add(priv->table, &e->hash, jhash(path, strlen(path), 0));
+    priv->tracked++;
+    return e;
+}
+
+static void moeai_memcg_remove(struct moeai_memcg_private *priv, struct moeai_memcg_entry *e)
+{
+    if (e->heap_idx >= 0)
+        moeai_memcg_heap_remove(priv, e);
+    hash_del(&e->hash);
+    list_del(&e->node);
+    priv->tracked--;
+    kfree(e);
+}
+
+/* 根据使用比例和压力判断 cgroup 的状态 */
+static enum moeai_system_state moeai_memcg_eval(const struct moeai_memcg_private *priv,
+                                                const struct moeai_memcg_stats *s)
+{
+    if (s->limit_bytes && s->usage_permyriad >= s->critical_percent * 100)
+        return MOEAI_STATE_CRITICAL;
+    if (s->limit_bytes && s->usage_permyriad >= s->warn_percent * 100)
+        return MOEAI_STATE_WARNING;
+    if (priv->config.psi_threshold_centi &&
+        s->psi_some_centi >= priv->config.psi_threshold_centi)
+        return MOEAI_STATE_WARNING;
+    return MOEAI_STATE_NORMAL;
+}
+
+/* 更新条目的统计，状态变化时记录事件，调用者持有 lock */
+static void moeai_memcg_update(struct moeai_memcg_private *priv, struct moeai_memcg_entry *e,
+                               const struct moeai_memcg_stats *s)
+{
+    struct moeai_memcg_stats *cur = &e->stats;
+    enum moeai_system_state old = cur->state;
+
+    cur->usage_bytes = s ? s->usage_bytes : 0;
+    cur->limit_bytes = s ? s->limit_bytes : 0;
+    cur->psi_some_centi = s ? s->psi_some_centi : 0;
+    cur->psi_full_centi = s ? s->psi_full_centi : 0;
+    cur->usage_permyriad = cur->limit_bytes ?
+        min_t(u64, div64_u64(cur->usage_bytes * 10000, cur->limit_bytes), UINT_MAX) : 0;
+
+    cur->state = moeai_memcg_eval(priv, cur);
+    if (cur->state != old) {
+        cur->events++;
+        priv->events++;
+        if (cur->state > old)
+            MOEAI_WARN(MODULE_NAME, lang_get(LANG_MEMCG_STATE_CHANGED), cur->path[0] ? cur->path : "/",
+                       moeai_mem_state_name(old), moeai_mem_state_name(cur->state),
+                       cur->usage_permyriad / 100, cur->usage_permyriad % 100,
+                       cur->psi_some_centi / 100, cur->psi_some_centi % 100);
+        else
+            MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEMCG_STATE_CHANGED), cur->path[0] ? cur->path : "/",
+                       moeai_mem_state_name(old), moeai_mem_state_name(cur->state),
+                       cur->usage_permyriad / 100, cur->usage_permyriad % 100,
+                       cur->psi_some_centi / 100, cur->psi_some_centi % 100);
+    }
+
+    moeai_memcg_heap_update(priv, e);
+}
+
+static MOEAI_FILLDIR_RET moeai_memcg_filldir(struct dir_context *ctx, const char *name, int namlen,
+                                             loff_t offset, u64 ino, unsigned int d_type)
+{
+    struct moeai_memcg_dir_ctx *d = container_of(ctx, struct moeai_memcg_dir_ctx, ctx);
+
+    if (d_type != DT_DIR || (namlen == 1 && name[0] == '.') ||
+        (namlen == 2 && name[0] == '.' && name[1] == '.'))
+        return MOEAI_FILLDIR_CONTINUE;
+
+    /* 缓冲区已满时停止，未写入的目录项留到下一次 iterate_dir */
+    if (d->len + namlen + 1 > d->size) {
+        d->full = true;
+        return MOEAI_FILLDIR_STOP;
+    }
+
+    memcpy(d->buf + d->len, name, namlen);
+    d->buf[d->len + namlen] = '\0';
+    d->len += namlen + 1;
+    return MOEAI_FILLDIR_CONTINUE;
+}
+
+/* 登记一批子目录，已知的标记为本轮可见，新的追加到遍历队列末尾 */
+static void moeai_memcg_add_children(struct moeai_memcg_private *priv,
+                                     const struct moeai_memcg_entry *parent,
+                                     const char *names, size_t len)
+{
+    char path[MOEAI_MEMCG_PATH_LEN];
+    struct moeai_memcg_entry *e;
+    size_t off;
+
+    mutex_lock(&priv->lock);
+    for (off = 0; off < len; off += strlen(names + off) + 1) {
+        if (snprintf(path, sizeof(path), "%s/%s", parent->stats.path, names + off) >= sizeof(path))
+            continue;
+
+        e = moeai_memcg_lookup(priv, path);
+        if (!e) {
+            if (priv->tracked >= priv->config.max_cgroups) {
+                priv->dropped++;
+                continue;
+            }
+            e = moeai_memcg_add(priv, path);
+            if (!e)
+                break;
+        }
+        e->seen_pass = priv->pass;
+    }
+    mutex_unlock(&priv->lock);
+}
+
+/* 枚举 cgroup 的子目录 */
+static void moeai_memcg_scan_children(struct moeai_memcg_private *priv,
+                                      const struct moeai_memcg_entry *parent)
+{
+    struct moeai_memcg_dir_ctx d = {
+        .ctx.actor = moeai_memcg_filldir,
+        .buf = priv->name_buf,
+        .size = PAGE_SIZE,
+    };
+    struct file *dir;
+
+    snprintf(priv->path_buf, sizeof(priv->path_buf), MOEAI_MEMCG_ROOT "%s", parent->stats.path);
+    dir = filp_open(priv->path_buf, O_RDONLY | O_DIRECTORY, 0);
+    if (IS_ERR(dir))
+        return;
+
+    do {
+        d.len = 0;
+        d.full = false;
+        if (iterate_dir(dir, &d.ctx) < 0)
+            break;
+        moeai_memcg_add_children(priv, parent, d.buf, d.len);
+    } while (d.full && d.len);
+
+    filp_close(dir, NULL);
+}
+
+/* 访问一个 cgroup: 更新统计并登记子目录 */
+static void moeai_memcg_visit(struct moeai_memcg_private *priv, struct moeai_memcg_entry *e)
+{
+    struct moeai_memcg_stats s;
+
+    /* 根 cgroup 没有 memory.current，只枚举子目录 */
+    if (e != priv->root) {
+        e->has_memory = moeai_memcg_read_stats(priv, e->stats.path, &s) == 0;
+
+        mutex_lock(&priv->lock);
+        moeai_memcg_update(priv, e, e->has_memory ? &s : NULL);
+        mutex_unlock(&priv->lock);
+
+        /* 未启用内存控制器的 cgroup，其子孙也不可能启用 */
+        if (!e->has_memory)
+            return;
+    }
+
+    moeai_memcg_scan_children(priv, e);
+}
+
+/* 结束一轮遍历: 删除本轮未被父目录列出的 cgroup，从根重新开始 */
+static void moeai_memcg_end_pass(struct moeai_memcg_private *priv)
+{
+    struct moeai_memcg_entry *e, *tmp;
+
+    mutex_lock(&priv->lock);
+    list_for_each_entry_safe(e, tmp, &priv->entries, node) {
+        if (e != priv->root && e->seen_pass != priv->pass)
+            moeai_memcg_remove(priv, e);
+    }
+
+    priv->passes++;
+    priv->last_pass_ms = jiffies_to_msecs(jiffies - priv->pass_start);
+    priv->pass++;
+    priv->pass_start = jiffies;
+    priv->root->seen_pass = priv->pass;
+    priv->cursor = priv->root;
+    mutex_unlock(&priv->lock);
+}
+
+/*
+ * 遍历工作: 每次最多访问 scan_batch 个 cgroup
+ * 开销与 cgroup 总数无关，cgroup 越多，完成一轮所需的批数越多。
+ */
+static void moeai_memcg_scan_work(struct work_struct *work)
+{
+    struct moeai_memcg_private *priv =
+        container_of(to_delayed_work(work), struct moeai_memcg_private, scan_work);
+    struct moeai_memcg_entry *e;
+    unsigned int i, batch = READ_ONCE(priv->config.scan_batch);
+
+    for (i = 0; i < batch; i++) {
+        e = priv->cursor;
+        if (!e) {
+            moeai_memcg_end_pass(priv);
+            break;
+        }
+
+        /* 访问过程中追加的子目录排在队尾，本轮之内就会被访问 */
+        moeai_memcg_visit(priv, e);
+        priv->cursor = list_is_last(&e->node, &priv->entries) ? NULL :
+                       list_next_entry(e, node);
+    }
+
+    if (READ_ONCE(priv->active))
+        queue_delayed_work(system_unbound_wq, &priv->scan_work,
+                           msecs_to_jiffies(READ_ONCE(priv->config.scan_interval_ms)));
+}
+
+/* 检测 cgroup v2 内存控制器 */
+static bool moeai_memcg_detect(struct moeai_memcg_private *priv)
+{
+    return moeai_memcg_read_file(priv, "", "cgroup.controllers") == 0 &&
+           strstr(priv->file_buf, "memory") != NULL;
+}
+
+static int moeai_memcg_cmp(const void *a, const void *b)
+{
+    const struct moeai_memcg_stats *x = a, *y = b;
+
+    if (x->usage_permyriad != y->usage_permyriad)
+        return x->usage_permyriad > y->usage_permyriad ? -1 : 1;
+    return strcmp(x->path, y->path);
+}
+
+int moeai_memcg_get_top(struct moeai_memcg_stats *out, int max)
+{
+    int i, count;
+
+    if (!memcg_priv || !out || max <= 0)
+        return -EINVAL;
+
+    mutex_lock(&memcg_priv->lock);
+    count = min_t(int, memcg_priv->heap_size, max);
+    for (i = 0; i < count; i++)
+        out[i] = memcg_priv->heap[i]->stats;
+    mutex_unlock(&memcg_priv->lock);
+
+    /* 堆只保证堆顶最小，输出前排序 */
+    sort(out, count, sizeof(*out), moeai_memcg_cmp, NULL);
+    return count;
+}
+
+int moeai_memcg_get_summary(struct moeai_memcg_summary *summary)
+{
+    struct moeai_memcg_entry *e;
+
+    if (!memcg_priv || !summary)
+        return -EINVAL;
+
+    memset(summary, 0, sizeof(*summary));
+    mutex_lock(&memcg_priv->lock);
+    summary->available = memcg_priv->available;
+    list_for_each_entry(e, &memcg_priv->entries, node) {
+        if (e == memcg_priv->root || !e->has_memory)
+            continue;
+        summary->tracked++;
+        if (e->stats.limit_bytes)
+            summary->limited++;
+        if (e->stats.state == MOEAI_STATE_WARNING)
+            summary->warning++;
+        else if (e->stats.state == MOEAI_STATE_CRITICAL)
+            summary->critical++;
+    }
+    summary->passes = memcg_priv->passes;
+    summary->last_pass_ms = memcg_priv->last_pass_ms;
+    summary->dropped = memcg_priv->dropped;
+    summary->events = memcg_priv->events;
+    mutex_unlock(&memcg_priv->lock);
+
+    return 0;
+}
+
+int moeai_memcg_get_config(struct moeai_memcg_config *config)
+{
+    if (!memcg_priv || !config)
+        return -EINVAL;
+
+    mutex_lock(&memcg_priv->lock);
+    *config = memcg_priv->config;
+    mutex_unlock(&memcg_priv->lock);
+    return 0;
+}
+
+int moeai_memcg_set_config(const struct moeai_memcg_config *config)
+{
+    struct moeai_memcg_entry *e;
+
+    if (!memcg_priv || !config)
+        return -EINVAL;
+    if (config->scan_interval_ms == 0 || config->scan_batch == 0 ||
+        config->top_n > MOEAI_MEMCG_MAX_TOP || config->critical_percent > 100 ||
+        config->warn_percent > config->critical_percent)
+        return -EINVAL;
+
+    mutex_lock(&memcg_priv->lock);
+    memcg_priv->config = *config;
+    list_for_each_entry(e, &memcg_priv->entries, node)
+        moeai_memcg_apply_thresholds(memcg_priv, e);
+    moeai_memcg_heap_rebuild(memcg_priv);
+    mutex_unlock(&memcg_priv->lock);
+    return 0;
+}
+
+int moeai_memcg_set_threshold(const char *path, unsigned int warn_percent,
+                              unsigned int critical_percent)
+{
+    struct moeai_memcg_override *o;
+    struct moeai_memcg_entry *e;
+    bool remove = warn_percent == 0 && critical_percent == 0;
+    int i, ret = 0;
+
+    if (!memcg_priv || !path || strlen(path) >= MOEAI_MEMCG_PATH_LEN)
+        return -EINVAL;
+    if (!remove && (critical_percent > 100 || warn_percent > critical_percent))
+        return -EINVAL;
+
+    /* 根目录写作 "/"，内部以空串表示 */
+    if (strcmp(path, "/") == 0)
+        path = "";
+
+    mutex_lock(&memcg_priv->lock);
+    o = moeai_memcg_find_override(memcg_priv, path);
+    if (remove) {
+        if (o)
+            o->used = false;
+    } else {
+        for (i = 0; !o && i < MOEAI_MEMCG_MAX_OVERRIDES; i++) {
+            if (!memcg_priv->overrides[i].used) {
+                o = &memcg_priv->overrides[i];
+                strscpy(o->path, path, sizeof(o->path));
+                o->used = true;
+            }
+        }
+        if (o) {
+            o->warn_percent = warn_percent;
+            o->critical_percent = critical_percent;
+        } else {
+            ret = -ENOSPC;
+        }
+    }
+
+    /* 状态在下一次访问该 cgroup 时按新阈值重新判断 */
+    e = moeai_memcg_lookup(memcg_priv, path);
+    if (e)
+        moeai_memcg_apply_thresholds(memcg_priv, e);
+    mutex_unlock(&memcg_priv->lock);
+
+    return ret;
+}
+
+/* 打开 cgroup 目录下的文件，"/" 表示根 cgroup */
+static struct file *moeai_memcg_open(const char *path, const char *name, int flags)
+{
+    struct file *filp;
+    char *file_path;
+
+    if (strcmp(path, "/") == 0)
+        path = "";
+
+    file_path = kasprintf(GFP_KERNEL, MOEAI_MEMCG_ROOT "%s/%s", path, name);
+    if (!file_path)
+        return ERR_PTR(-ENOMEM);
+    filp = filp_open(file_path, flags, 0);
+    kfree(file_path);
+
+    return filp;
+}
+
+int moeai_memcg_read_value(const char *path, const char *name, u64 *value)
+{
+    struct file *filp;
+    char buf[32];
+    loff_t pos = 0;
+    ssize_t len;
+
+    if (!path || !name || !value)
+        return -EINVAL;
+
+    filp = moeai_memcg_open(path, name, O_RDONLY);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+    len = kernel_read(filp, buf, sizeof(buf) - 1, &pos);
+    filp_close(filp, NULL);
+    if (len < 0)
+        return len;
+
+    buf[len] = '\0';
+    return kstrtou64(strim(buf), 10, value);
+}
+
+/*
+ * 读取 memory.stat 中的若干项，不存在的项为0
+ * memory.stat 在较新内核上约有60行，一次读入两页的缓冲区
+ */
+int moeai_memcg_read_stat(const char *path, const char * const *keys, u64 *values, int n)
+{
+    struct file *filp;
+    size_t size = 2 * PAGE_SIZE;
+    char *buf, *line, *p;
+    loff_t pos = 0;
+    ssize_t len;
+    int i;
+
+    if (!path || !keys || !values || n <= 0)
+        return -EINVAL;
+
+    buf = kmalloc(size, GFP_KERNEL);
+    if (!buf)
+        return -ENOMEM;
+
+    filp = moeai_memcg_open(path, "memory.stat", O_RDONLY);
+    if (IS_ERR(filp)) {
+        kfree(buf);
+        return PTR_ERR(filp);
+    }
+    len = kernel_read(filp, buf, size - 1, &pos);
+    filp_close(filp, NULL);
+    if (len < 0) {
+        kfree(buf);
+        return len;
+    }
+    buf[len] = '\0';
+
+    memset(values, 0, n * sizeof(*values));
+    p = buf;
+    while ((line = strsep(&p, "\n")) != NULL) {
+        char *val = strchr(line, ' ');
+
+        if (!val)
+            continue;
+        *val++ = '\0';
+        for (i = 0; i < n; i++) {
+            if (strcmp(line, keys[i]) == 0 && kstrtou64(val, 10, &values[i]) == 0)
+                break;
+        }
+    }
+
+    kfree(buf);
+    return 0;
+}
+
+/*
+ * 通过 memory.reclaim (5.19+) 请求内核从指定 cgroup 回收
+ * 回收不足请求量时写入返回 -EAGAIN，已回收的部分仍然有效
+ */
+static int moeai_memcg_write_reclaim(const char *path, u64 bytes, const char *args)
+{
+    struct file *filp;
+    char req[40];
+    loff_t pos = 0;
+    ssize_t ret;
+    int len;
+
+    if (!path || bytes == 0)
+        return -EINVAL;
+
+    filp = moeai_memcg_open(path, "memory.reclaim", O_WRONLY);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+
+    len = snprintf(req, sizeof(req), "%llu%s", bytes, args);
+    ret = kernel_write(filp, req, len, &pos);
+    filp_close(filp, NULL);
+
+    return ret < 0 ? ret : 0;
+}
+
+int moeai_memcg_reclaim(const char *path, u64 bytes)
+{
+    return moeai_memcg_write_reclaim(path, bytes, "");
+}
+
+int moeai_memcg_reclaim_file(const char *path, u64 bytes)
+{
+    return moeai_memcg_write_reclaim(path, bytes, MOEAI_MEMCG_RECLAIM_FILE_ARGS);
+}
+
+void moeai_memcg_start(void)
+{
+    if (!memcg_priv || READ_ONCE(memcg_priv->active))
+        return;
+
+    /* cgroup 文件系统可能在模块加载后才挂载，每次启动时重新检测 */
+    mutex_lock(&memcg_priv->lock);
+    memcg_priv->available = moeai_memcg_detect(memcg_priv);
+    mutex_unlock(&memcg_priv->lock);
+    if (!memcg_priv->available) {
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_MEMCG_UNAVAILABLE), MOEAI_MEMCG_ROOT);
+        return;
+    }
+
+    WRITE_ONCE(memcg_priv->active, true);
+    queue_delayed_work(system_unbound_wq, &memcg_priv->scan_work, 0);
+}
+
+void moeai_memcg_stop(void)
+{
+    if (!memcg_priv)
+        return;
+
+    WRITE_ONCE(memcg_priv->active, false);
+    cancel_delayed_work_sync(&memcg_priv->scan_work);
+}
+
+int moeai_memcg_init(void)
+{
+    memcg_priv = kzalloc(sizeof(*memcg_priv), GFP_KERNEL);
+    if (!memcg_priv)
+        return -ENOMEM;
+
+    memcg_priv->name_buf = kmalloc(PAGE_SIZE, GFP_KERNEL);
+    if (!memcg_priv->name_buf)
+        goto err;
+
+    memcg_priv->config.scan_interval_ms = 1000;    /* 1秒 */
+    memcg_priv->config.scan_batch = 32;
+    memcg_priv->config.top_n = 16;
+    memcg_priv->config.warn_percent = 90;          /* 90% */
+    memcg_priv->config.critical_percent = 95;      /* 95% */
+    memcg_priv->config.psi_threshold_centi = 1000; /* some avg10 10% */
+    memcg_priv->config.max_cgroups = 4096;
+
+    INIT_LIST_HEAD(&memcg_priv->entries);
+    hash_init(memcg_priv->table);
+    mutex_init(&memcg_priv->lock);
+    INIT_DELAYED_WORK(&memcg_priv->scan_work, moeai_memcg_scan_work);
+
+    /* 根 cgroup 常驻队首，不计入跟踪数 */
+    memcg_priv->root = moeai_memcg_add(memcg_priv, "");
+    if (!memcg_priv->root)
+        goto err;
+    memcg_priv->tracked = 0;
+    memcg_priv->cursor = memcg_priv->root;
+    memcg_priv->pass_start = jiffies;
+
+    return 0;
+
+err:
+    kfree(memcg_priv->name_buf);
+    kfree(memcg_priv);
+    memcg_priv = NULL;
+    return -ENOMEM;
+}
+
+void moeai_memcg_exit(void)
+{
+    struct moeai_memcg_entry *e, *tmp;
+
+    if (!memcg_priv)
+        return;
+
+    moeai_memcg_stop();
+    list_for_each_entry_safe(e, tmp, &memcg_priv->entries, node) {
+        hash_del(&e->hash);
+        list_del(&e->node);
+        kfree(e);
+    }
+    kfree(memcg_priv->name_buf);
+    kfree(memcg_priv);
+    memcg_priv = NULL;
+}
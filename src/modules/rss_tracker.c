@@ -0,0 +1,407 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/rss_tracker.c
+ * 描述: 进程RSS排行
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/sched.h>
+#include <linux/sched/mm.h>
+#include <linux/mm.h>
+#include <linux/pid.h>
+#include <linux/pid_namespace.h>
+#include <linux/idr.h>
+#include <linux/rcupdate.h>
+#include <linux/hashtable.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/sort.h>
+#include <linux/math64.h>
+#include "../../include/modules/rss_tracker.h"
+
+/* 模块名称 */
+#define MODULE_NAME "rss_tracker"
+
+/* 进程哈希表大小 (2^10 个桶) */
+#define MOEAI_RSS_HASH_BITS 10
+
+/* 跟踪中的进程 */
+struct moeai_rss_record {
+    struct hlist_node hash;
+    pid_t pid;
+    u64 start_time;                 /* 进程启动时间，用于识别被复用的PID */
+    char comm[TASK_COMM_LEN];
+    unsigned long rss_pages;
+    long growth_kb_s;
+    unsigned long last_seen;        /* 上一次访问的时间 (jiffies) */
+    u64 seen_pass;
+};
+
+/* 在 RCU 读临界区内采集的一个进程 */
+struct moeai_rss_sample {
+    pid_t pid;
+    u64 start_time;
+    char comm[TASK_COMM_LEN];
+    unsigned long rss_pages;
+};
+
+/* 进程RSS排行私有数据 */
+struct moeai_rss_private {
+    struct moeai_rss_config config;
+    DECLARE_HASHTABLE(table, MOEAI_RSS_HASH_BITS);
+    unsigned int tracked;
+    int cursor;                     /* 下一批从这个PID开始 */
+    u64 pass;                       /* 当前遍历轮次 */
+    unsigned long pass_start;       /* 本轮开始时间 (jiffies) */
+    struct moeai_rss_top top;       /* 最近一轮结束时发布的排行 */
+    struct moeai_rss_sample *batch; /* 采集缓冲，容量 MOEAI_RSS_MAX_BATCH */
+    bool active;
+    struct delayed_work scan_work;  /* 遍历放到工作队列中执行，每批只在 RCU 下停留很短时间 */
+    struct mutex lock;              /* 保护进程表与排行 */
+};
+
+static struct moeai_rss_private *rss_priv;
+
+/*
+ * 采集一批进程的RSS，只读取线程组组长，内核线程没有 mm
+ * 按PID顺序续接上一批的位置，遍历期间新建的进程只要PID更大就会在本轮被访问到。
+ * @return 采集到的进程数，*done 表示本轮已遍历到最大PID
+ */
+static unsigned int moeai_rss_collect(struct moeai_rss_private *priv, unsigned int batch,
+                                      bool *done)
+{
+    struct moeai_rss_sample *s;
+    struct task_struct *task;
+    struct pid *pid;
+    unsigned int i, n = 0;
+    int nr = priv->cursor;
+
+    *done = false;
+    rcu_read_lock();
+    for (i = 0; i < batch; i++, nr++) {
+        pid = idr_get_next(&init_pid_ns.idr, &nr);
+        if (!pid) {
+            *done = true;
+            break;
+        }
+
+        task = pid_task(pid, PIDTYPE_TGID);
+        if (!task || (task->flags & PF_KTHREAD))
+            continue;
+
+        s = &priv->batch[n];
+        task_lock(task);
+        if (task->mm) {
+            s->rss_pages = get_mm_rss(task->mm);
+            s->pid = nr;
+            s->start_time = task->start_time;
+            get_task_comm(s->comm, task);
+            n++;
+        }
+        task_unlock(task);
+    }
+    rcu_read_unlock();
+
+    priv->cursor = nr;
+    return n;
+}
+
+static struct moeai_rss_record *moeai_rss_lookup(struct moeai_rss_private *priv, pid_t pid)
+{
+    struct moeai_rss_record *r;
+
+    hash_for_each_possible(priv->table, r, hash, pid) {
+        if (r->pid == pid)
+            return r;
+    }
+    return NULL;
+}
+
+/* 用一批采样更新进程表，调用者持有 lock */
+static void moeai_rss_update(struct moeai_rss_private *priv, const struct moeai_rss_sample *samples,
+                             unsigned int n)
+{
+    const struct moeai_rss_sample *s;
+    struct moeai_rss_record *r;
+    unsigned long now = jiffies;
+    unsigned int i, elapsed_ms;
+    long delta_kb;
+
+    for (i = 0; i < n; i++) {
+        s = &samples[i];
+        r = moeai_rss_lookup(priv, s->pid);
+
+        /* PID 被新进程复用时按新进程处理 */
+        if (r && r->start_time != s->start_time) {
+            r->start_time = s->start_time;
+            r->rss_pages = s->rss_pages;
+            r->growth_kb_s = 0;
+            r->last_seen = now;
+        }
+
+        if (!r) {
+            if (priv->tracked >= priv->config.max_tasks) {
+                priv->top.dropped++;
+                continue;
+            }
+            r = kzalloc(sizeof(*r), GFP_KERNEL);
+            if (!r)
+                break;
+            r->pid = s->pid;
+            r->start_time = s->start_time;
+            r->rss_pages = s->rss_pages;
+            r->last_seen = now;
+            hash_add(priv->table, &r->hash, r->pid);
+            priv->tracked++;
+        }
+
+        elapsed_ms = jiffies_to_msecs(now - r->last_seen);
+        if (elapsed_ms) {
+            delta_kb = ((long)s->rss_pages - (long)r->rss_pages) * (long)(PAGE_SIZE / 1024);
+            r->growth_kb_s = div_s64((s64)delta_kb * MSEC_PER_SEC, elapsed_ms);
+            r->last_seen = now;
+        }
+        r->rss_pages = s->rss_pages;
+        memcpy(r->comm, s->comm, sizeof(r->comm));
+        r->seen_pass = priv->pass;
+    }
+}
+
+typedef long (*moeai_rss_key_t)(const struct moeai_rss_record *r);
+
+static long moeai_rss_key_rss(const struct moeai_rss_record *r)
+{
+    return r->rss_pages;
+}
+
+static long moeai_rss_key_growth(const struct moeai_rss_record *r)
+{
+    return r->growth_kb_s;
+}
+
+/* 有界最小堆: 堆顶是当前排行中最小的一项，新候选只需与堆顶比较 */
+static void moeai_rss_heap_push(struct moeai_rss_record **heap, unsigned int *size, unsigned int k,
+                                struct moeai_rss_record *r, moeai_rss_key_t key)
+{
+    unsigned int i, c;
+
+    if (*size < k) {
+        for (i = (*size)++; i > 0 && key(heap[(i - 1) / 2]) > key(r); i = (i - 1) / 2)
+            heap[i] = heap[(i - 1) / 2];
+        heap[i] = r;
+        return;
+    }
+
+    if (!k || key(r) <= key(heap[0]))
+        return;
+
+    /* 替换堆顶后下沉 */
+    for (i = 0; (c = 2 * i + 1) < *size; i = c) {
+        if (c + 1 < *size && key(heap[c + 1]) < key(heap[c]))
+            c++;
+        if (key(heap[c]) >= key(r))
+            break;
+        heap[i] = heap[c];
+    }
+    heap[i] = r;
+}
+
+static int moeai_rss_cmp_rss(const void *a, const void *b)
+{
+    const struct moeai_rss_entry *x = a, *y = b;
+
+    if (x->rss_kb != y->rss_kb)
+        return x->rss_kb > y->rss_kb ? -1 : 1;
+    return x->pid - y->pid;
+}
+
+static int moeai_rss_cmp_growth(const void *a, const void *b)
+{
+    const struct moeai_rss_entry *x = a, *y = b;
+
+    if (x->growth_kb_s != y->growth_kb_s)
+        return x->growth_kb_s > y->growth_kb_s ? -1 : 1;
+    return x->pid - y->pid;
+}
+
+static void moeai_rss_fill(struct moeai_rss_entry *out, struct moeai_rss_record **heap,
+                           unsigned int n, int (*cmp)(const void *, const void *))
+{
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+        out[i].pid = heap[i]->pid;
+        memcpy(out[i].comm, heap[i]->comm, sizeof(out[i].comm));
+        out[i].rss_kb = heap[i]->rss_pages << (PAGE_SHIFT - 10);
+        out[i].growth_kb_s = heap[i]->growth_kb_s;
+    }
+    sort(out, n, sizeof(*out), cmp, NULL);
+}
+
+/* 结束一轮遍历: 删除已退出的进程，重建并发布排行 */
+static void moeai_rss_end_pass(struct moeai_rss_private *priv)
+{
+    struct moeai_rss_record *by_rss[MOEAI_RSS_MAX_TOP], *by_growth[MOEAI_RSS_MAX_TOP];
+    struct moeai_rss_record *r;
+    struct hlist_node *tmp;
+    unsigned int nr_rss = 0, nr_growth = 0;
+    int bkt;
+
+    mutex_lock(&priv->lock);
+    hash_for_each_safe(priv->table, bkt, tmp, r, hash) {
+        if (r->seen_pass != priv->pass) {
+            hash_del(&r->hash);
+            priv->tracked--;
+            kfree(r);
+            continue;
+        }
+        moeai_rss_heap_push(by_rss, &nr_rss, priv->config.top_k, r, moeai_rss_key_rss);
+        if (r->growth_kb_s > 0)
+            moeai_rss_heap_push(by_growth, &nr_growth, priv->config.top_k, r,
+                                moeai_rss_key_growth);
+    }
+
+    moeai_rss_fill(priv->top.by_rss, by_rss, nr_rss, moeai_rss_cmp_rss);
+    moeai_rss_fill(priv->top.by_growth, by_growth, nr_growth, moeai_rss_cmp_growth);
+    priv->top.nr_rss = nr_rss;
+    priv->top.nr_growth = nr_growth;
+    priv->top.tracked = priv->tracked;
+    priv->top.passes++;
+    priv->top.last_pass_ms = jiffies_to_msecs(jiffies - priv->pass_start);
+
+    priv->pass++;
+    priv->pass_start = jiffies;
+    priv->cursor = 0;
+    mutex_unlock(&priv->lock);
+}
+
+/*
+ * 遍历工作: 每次最多访问 scan_batch 个PID
+ * RCU 读临界区只覆盖采集，分配与排行计算都在临界区之外完成。
+ */
+static void moeai_rss_scan_work(struct work_struct *work)
+{
+    struct moeai_rss_private *priv =
+        container_of(to_delayed_work(work), struct moeai_rss_private, scan_work);
+    unsigned int n;
+    bool done;
+
+    n = moeai_rss_collect(priv, READ_ONCE(priv->config.scan_batch), &done);
+
+    mutex_lock(&priv->lock);
+    moeai_rss_update(priv, priv->batch, n);
+    mutex_unlock(&priv->lock);
+
+    if (done)
+        moeai_rss_end_pass(priv);
+
+    if (READ_ONCE(priv->active))
+        queue_delayed_work(system_unbound_wq, &priv->scan_work,
+                           msecs_to_jiffies(READ_ONCE(priv->config.scan_interval_ms)));
+}
+
+int moeai_rss_get_top(struct moeai_rss_top *top)
+{
+    if (!rss_priv || !top)
+        return -EINVAL;
+
+    mutex_lock(&rss_priv->lock);
+    *top = rss_priv->top;
+    mutex_unlock(&rss_priv->lock);
+    return 0;
+}
+
+int moeai_rss_get_config(struct moeai_rss_config *config)
+{
+    if (!rss_priv || !config)
+        return -EINVAL;
+
+    mutex_lock(&rss_priv->lock);
+    *config = rss_priv->config;
+    mutex_unlock(&rss_priv->lock);
+    return 0;
+}
+
+int moeai_rss_set_config(const struct moeai_rss_config *config)
+{
+    if (!rss_priv || !config)
+        return -EINVAL;
+    if (config->scan_interval_ms == 0 || config->scan_batch == 0 ||
+        config->scan_batch > MOEAI_RSS_MAX_BATCH || config->top_k > MOEAI_RSS_MAX_TOP)
+        return -EINVAL;
+
+    /* 排行长度的变化在下一轮结束时生效 */
+    mutex_lock(&rss_priv->lock);
+    rss_priv->config = *config;
+    mutex_unlock(&rss_priv->lock);
+    return 0;
+}
+
+void moeai_rss_start(void)
+{
+    if (!rss_priv || READ_ONCE(rss_priv->active))
+        return;
+
+    WRITE_ONCE(rss_priv->active, true);
+    queue_delayed_work(system_unbound_wq, &rss_priv->scan_work, 0);
+}
+
+void moeai_rss_stop(void)
+{
+    if (!rss_priv)
+        return;
+
+    WRITE_ONCE(rss_priv->active, false);
+    cancel_delayed_work_sync(&rss_priv->scan_work);
+}
+
+int moeai_rss_init(void)
+{
+    rss_priv = kzalloc(sizeof(*rss_priv), GFP_KERNEL);
+    if (!rss_priv)
+        return -ENOMEM;
+
+    rss_priv->batch = kmalloc_array(MOEAI_RSS_MAX_BATCH, sizeof(*rss_priv->batch), GFP_KERNEL);
+    if (!rss_priv->batch) {
+        kfree(rss_priv);
+        rss_priv = NULL;
+        return -ENOMEM;
+    }
+
+    rss_priv->config.scan_interval_ms = 250;    /* 250毫秒 */
+    rss_priv->config.scan_batch = 128;
+    rss_priv->config.top_k = 10;
+    rss_priv->config.max_tasks = 32768;
+
+    hash_init(rss_priv->table);
+    mutex_init(&rss_priv->lock);
+    INIT_DELAYED_WORK(&rss_priv->scan_work, moeai_rss_scan_work);
+    rss_priv->pass_start = jiffies;
+
+    return 0;
+}
+
+void moeai_rss_exit(void)
+{
+    struct moeai_rss_record *r;
+    struct hlist_node *tmp;
+    int bkt;
+
+    if (!rss_priv)
+        return;
+
+    moeai_rss_stop();
+    hash_for_each_safe(rss_priv->table, bkt, tmp, r, hash) {
+        hash_del(&r->hash);
+        kfree(r);
+    }
+    kfree(rss_priv->batch);
+    kfree(rss_priv);
+    rss_priv = NULL;
+}
@@ -0,0 +1,385 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/stall_trace.c
+ * 描述: 基于 vmscan 跟踪点的直接回收停顿延迟统计
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/sched.h>
+#include <linux/percpu.h>
+#include <linux/spinlock.h>
+#include <linux/atomic.h>
+#include <linux/hash.h>
+#include <linux/jiffies.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <linux/bitops.h>
+#include <linux/string.h>
+#include <linux/tracepoint.h>
+#include "../../include/modules/stall_trace.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "stall_trace"
+
+/* 在途停顿表: 按任务指针散列，冲突时向后探测有限个槽位 */
+#define MOEAI_STALL_INFLIGHT_BITS 8
+#define MOEAI_STALL_INFLIGHT (1U << MOEAI_STALL_INFLIGHT_BITS)
+#define MOEAI_STALL_PROBE 4
+
+/* 每CPU直方图，只由本CPU上的探针写入 */
+struct moeai_stall_cpu {
+    u64 buckets[MOEAI_STALL_BUCKETS];
+    u64 total_ns;
+    u64 max_ns;
+    u64 window_max_ns;              /* 本窗口内的最长停顿，采样时清零 */
+};
+
+/* 正在直接回收的任务及其开始时间 */
+struct moeai_stall_slot {
+    struct task_struct *task;
+    u64 start_ns;
+};
+
+/* 停顿统计私有数据 */
+struct moeai_stall_private {
+    struct moeai_stall_cpu __percpu *cpu;
+    struct moeai_stall_slot inflight[MOEAI_STALL_INFLIGHT];
+    atomic64_t untracked;
+    struct tracepoint *tp_begin;
+    struct tracepoint *tp_end;
+    bool attached;
+    u64 scratch[MOEAI_STALL_BUCKETS];   /* 汇总缓冲，避免占用软中断栈，受 lock 保护 */
+    u64 prev_buckets[MOEAI_STALL_BUCKETS]; /* 上一个窗口结束时的累计直方图 */
+    u64 prev_total_ns;
+    unsigned long prev_sample;          /* 上一个窗口结束时间 (jiffies) */
+    struct moeai_stall_dist window;
+    unsigned int window_ms;
+    spinlock_t lock;
+};
+
+static struct moeai_stall_private *stall_priv;
+
+/* 停顿时长所在的桶 */
+static unsigned int moeai_stall_bucket(u64 ns)
+{
+    u64 us = div_u64(ns, NSEC_PER_USEC);
+
+    return us ? min_t(unsigned int, fls64(us), MOEAI_STALL_BUCKETS - 1) : 0;
+}
+
+/* 累计一次停顿，探针在关抢占的上下文中运行 */
+static void moeai_stall_account(struct moeai_stall_private *priv, u64 ns)
+{
+    struct moeai_stall_cpu *c = get_cpu_ptr(priv->cpu);
+
+    c->buckets[moeai_stall_bucket(ns)]++;
+    c->total_ns += ns;
+    if (ns > c->max_ns)
+        c->max_ns = ns;
+    if (ns > READ_ONCE(c->window_max_ns))
+        WRITE_ONCE(c->window_max_ns, ns);
+    put_cpu_ptr(priv->cpu);
+}
+
+static struct moeai_stall_slot *moeai_stall_slot(struct moeai_stall_private *priv,
+                                                 unsigned int h, unsigned int i)
+{
+    return &priv->inflight[(h + i) & (MOEAI_STALL_INFLIGHT - 1)];
+}
+
+/*
+ * 直接回收开始
+ * 回收过程中任务可能睡眠并迁移到其他CPU，开始时间按任务记录而不是按CPU记录
+ */
+static void moeai_stall_probe_begin(void *data, int order, gfp_t gfp_flags)
+{
+    struct moeai_stall_private *priv = data;
+    unsigned int h = hash_ptr(current, MOEAI_STALL_INFLIGHT_BITS);
+    struct moeai_stall_slot *slot;
+    unsigned int i;
+
+    for (i = 0; i < MOEAI_STALL_PROBE; i++) {
+        slot = moeai_stall_slot(priv, h, i);
+        if (!cmpxchg(&slot->task, NULL, current)) {
+            WRITE_ONCE(slot->start_ns, ktime_get_ns());
+            return;
+        }
+    }
+
+    atomic64_inc(&priv->untracked);
+}
+
+/* 直接回收结束，没有对应开始记录的 (挂接前已开始或表满) 直接忽略 */
+static void moeai_stall_probe_end(void *data, unsigned long nr_reclaimed)
+{
+    struct moeai_stall_private *priv = data;
+    unsigned int h = hash_ptr(current, MOEAI_STALL_INFLIGHT_BITS);
+    struct moeai_stall_slot *slot;
+    unsigned int i;
+    u64 start;
+
+    for (i = 0; i < MOEAI_STALL_PROBE; i++) {
+        slot = moeai_stall_slot(priv, h, i);
+        if (READ_ONCE(slot->task) == current) {
+            start = READ_ONCE(slot->start_ns);
+            smp_store_release(&slot->task, NULL);
+            moeai_stall_account(priv, ktime_get_ns() - start);
+            return;
+        }
+    }
+}
+
+/* 桶的上界 (微秒) */
+static u64 moeai_stall_bucket_limit(unsigned int bucket)
+{
+    return 1ULL << bucket;
+}
+
+/* 直方图的百分位，取所在桶的上界，不超过实测最大值 */
+static u64 moeai_stall_percentile(const u64 *buckets, u64 count, u64 max_us,
+                                  unsigned int percent)
+{
+    u64 target, seen = 0;
+    unsigned int i;
+
+    if (!count)
+        return 0;
+
+    target = div_u64(count * percent + 99, 100);
+    for (i = 0; i < MOEAI_STALL_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= target)
+            return min(moeai_stall_bucket_limit(i), max_us);
+    }
+
+    return max_us;
+}
+
+/* 由直方图填充分布 */
+static void moeai_stall_fill(struct moeai_stall_dist *d, const u64 *buckets,
+                             u64 total_ns, u64 max_ns)
+{
+    unsigned int i;
+
+    d->count = 0;
+    for (i = 0; i < MOEAI_STALL_BUCKETS; i++)
+        d->count += buckets[i];
+    d->total_us = div_u64(total_ns, NSEC_PER_USEC);
+    d->max_us = div_u64(max_ns, NSEC_PER_USEC);
+    d->p50_us = moeai_stall_percentile(buckets, d->count, d->max_us, 50);
+    d->p99_us = moeai_stall_percentile(buckets, d->count, d->max_us, 99);
+}
+
+/* 汇总各CPU直方图到 scratch，调用者持有 lock */
+static void moeai_stall_collect(struct moeai_stall_private *priv, u64 *total_ns,
+                                u64 *max_ns, u64 *window_max_ns, bool reset_window)
+{
+    int cpu;
+    unsigned int i;
+
+    memset(priv->scratch, 0, sizeof(priv->scratch));
+    *total_ns = 0;
+    *max_ns = 0;
+    *window_max_ns = 0;
+
+    for_each_possible_cpu(cpu) {
+        struct moeai_stall_cpu *c = per_cpu_ptr(priv->cpu, cpu);
+        u64 wmax;
+
+        for (i = 0; i < MOEAI_STALL_BUCKETS; i++)
+            priv->scratch[i] += READ_ONCE(c->buckets[i]);
+        *total_ns += READ_ONCE(c->total_ns);
+        *max_ns = max(*max_ns, READ_ONCE(c->max_ns));
+        wmax = reset_window ? xchg(&c->window_max_ns, 0) : READ_ONCE(c->window_max_ns);
+        *window_max_ns = max(*window_max_ns, wmax);
+    }
+}
+
+/**
+ * 结束当前采样窗口
+ */
+void moeai_stall_sample(struct moeai_stall_dist *window)
+{
+    struct moeai_stall_private *priv = stall_priv;
+    u64 total_ns, max_ns, window_max_ns;
+    unsigned int i;
+
+    if (!priv) {
+        if (window)
+            memset(window, 0, sizeof(*window));
+        return;
+    }
+
+    spin_lock_bh(&priv->lock);
+    moeai_stall_collect(priv, &total_ns, &max_ns, &window_max_ns, true);
+    for (i = 0; i < MOEAI_STALL_BUCKETS; i++) {
+        u64 now = priv->scratch[i];
+
+        priv->scratch[i] = now - priv->prev_buckets[i];
+        priv->prev_buckets[i] = now;
+    }
+    moeai_stall_fill(&priv->window, priv->scratch, total_ns - priv->prev_total_ns,
+                     window_max_ns);
+    priv->prev_total_ns = total_ns;
+    priv->window_ms = jiffies_to_msecs(jiffies - priv->prev_sample);
+    priv->prev_sample = jiffies;
+    if (window)
+        *window = priv->window;
+    spin_unlock_bh(&priv->lock);
+}
+
+/**
+ * 获取停顿统计概况
+ */
+int moeai_stall_get_summary(struct moeai_stall_summary *summary)
+{
+    struct moeai_stall_private *priv = stall_priv;
+    u64 total_ns, max_ns, window_max_ns;
+
+    if (!priv || !summary)
+        return -EINVAL;
+
+    spin_lock_bh(&priv->lock);
+    moeai_stall_collect(priv, &total_ns, &max_ns, &window_max_ns, false);
+    memcpy(summary->buckets, priv->scratch, sizeof(summary->buckets));
+    moeai_stall_fill(&summary->total, priv->scratch, total_ns, max_ns);
+    summary->window = priv->window;
+    summary->window_ms = priv->window_ms;
+    summary->attached = priv->attached;
+    spin_unlock_bh(&priv->lock);
+    summary->untracked = atomic64_read(&priv->untracked);
+
+    return 0;
+}
+
+/* 按名称查找跟踪点 */
+struct moeai_stall_lookup {
+    const char *name;
+    struct tracepoint *tp;
+};
+
+static void moeai_stall_find_tp(struct tracepoint *tp, void *data)
+{
+    struct moeai_stall_lookup *lookup = data;
+
+    if (!lookup->tp && strcmp(tp->name, lookup->name) == 0)
+        lookup->tp = tp;
+}
+
+static struct tracepoint *moeai_stall_lookup_tp(const char *name)
+{
+    struct moeai_stall_lookup lookup = { .name = name };
+
+    for_each_kernel_tracepoint(moeai_stall_find_tp, &lookup);
+    return lookup.tp;
+}
+
+/**
+ * 挂接到 vmscan 跟踪点
+ * 这两个跟踪点没有导出给模块，只能按名称在内核跟踪点中查找
+ */
+int moeai_stall_start(void)
+{
+    struct moeai_stall_private *priv = stall_priv;
+    int ret;
+
+    if (!priv)
+        return -EINVAL;
+    if (priv->attached)
+        return 0;
+
+    priv->tp_begin = moeai_stall_lookup_tp("mm_vmscan_direct_reclaim_begin");
+    priv->tp_end = moeai_stall_lookup_tp("mm_vmscan_direct_reclaim_end");
+    if (!priv->tp_begin || !priv->tp_end) {
+        MOEAI_WARN(MODULE_NAME, lang_get(LANG_STALL_TP_MISSING));
+        return -ENOENT;
+    }
+
+    /* 上次卸下时仍在回收的任务不会再有结束事件，清空在途表 */
+    memset(priv->inflight, 0, sizeof(priv->inflight));
+
+    /* 先挂接结束探针，保证每个被记录的开始都能被结算 */
+    ret = tracepoint_probe_register(priv->tp_end, moeai_stall_probe_end, priv);
+    if (ret)
+        goto err;
+    ret = tracepoint_probe_register(priv->tp_begin, moeai_stall_probe_begin, priv);
+    if (ret) {
+        tracepoint_probe_unregister(priv->tp_end, moeai_stall_probe_end, priv);
+        tracepoint_synchronize_unregister();
+        goto err;
+    }
+
+    spin_lock_bh(&priv->lock);
+    priv->attached = true;
+    priv->prev_sample = jiffies;
+    spin_unlock_bh(&priv->lock);
+
+    MOEAI_INFO(MODULE_NAME, lang_get(LANG_STALL_ATTACHED));
+    return 0;
+
+err:
+    MOEAI_WARN(MODULE_NAME, lang_get(LANG_STALL_ATTACH_FAILED), ret);
+    return ret;
+}
+
+/**
+ * 卸下跟踪点探针
+ */
+void moeai_stall_stop(void)
+{
+    struct moeai_stall_private *priv = stall_priv;
+
+    if (!priv || !priv->attached)
+        return;
+
+    tracepoint_probe_unregister(priv->tp_begin, moeai_stall_probe_begin, priv);
+    tracepoint_probe_unregister(priv->tp_end, moeai_stall_probe_end, priv);
+    tracepoint_synchronize_unregister();
+
+    spin_lock_bh(&priv->lock);
+    priv->attached = false;
+    spin_unlock_bh(&priv->lock);
+}
+
+/**
+ * 初始化停顿统计
+ */
+int moeai_stall_init(void)
+{
+    stall_priv = kzalloc(sizeof(*stall_priv), GFP_KERNEL);
+    if (!stall_priv)
+        return -ENOMEM;
+
+    stall_priv->cpu = alloc_percpu(struct moeai_stall_cpu);
+    if (!stall_priv->cpu) {
+        kfree(stall_priv);
+        stall_priv = NULL;
+        return -ENOMEM;
+    }
+
+    atomic64_set(&stall_priv->untracked, 0);
+    spin_lock_init(&stall_priv->lock);
+    stall_priv->prev_sample = jiffies;
+    return 0;
+}
+
+/**
+ * 清理停顿统计
+ */
+void moeai_stall_exit(void)
+{
+    if (!stall_priv)
+        return;
+
+    moeai_stall_stop();
+    free_percpu(stall_priv->cpu);
+    kfree(stall_priv);
+    stall_priv = NULL;
+}
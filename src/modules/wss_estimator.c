@@ -0,0 +1,649 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/modules/wss_estimator.c
+ * 描述: 基于空闲页跟踪的工作集估算
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/mmzone.h>
+#include <linux/memory_hotplug.h>
+#include <linux/memcontrol.h>
+#include <linux/cgroup.h>
+#include <linux/rcupdate.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
+#include <linux/jiffies.h>
+#include <linux/string.h>
+#include <linux/bitops.h>
+#include "../../include/modules/wss_estimator.h"
+#include "../../include/modules/memcg_monitor.h"
+#include "../../include/utils/logger.h"
+#include "../../include/utils/lang.h"
+
+/* 模块名称 */
+#define MODULE_NAME "wss"
+
+/*
+ * 空闲页跟踪的位图接口 (CONFIG_IDLE_PAGE_TRACKING)
+ * 读取时内核会先清除映射该页的 PTE 访问位，因此能发现只通过页表访问的页；
+ * 写入1把页标记为空闲。模块无法直接调用 rmap 遍历，只能经由这个文件。
+ */
+#define MOEAI_WSS_BITMAP "/sys/kernel/mm/page_idle/bitmap"
+
+/* 每个位图字覆盖的页数 */
+#define MOEAI_WSS_WORD_PAGES 64
+
+/*
+ * 年龄表按块分配，每块覆盖的页帧数 (每页帧1字节)
+ * 物理地址空间可能有很大的空洞，块在第一次遇到空闲的在线页时才分配，
+ * 年龄表的大小因此与实际内存成正比 (约1/4096)，空洞只占块指针表。
+ */
+#define MOEAI_WSS_CHUNK_PAGES 32768
+
+/* 选中的 cgroup 及本轮扫描的累计值 (页数) */
+struct moeai_wss_target {
+    struct moeai_wss_target_stats stats; /* 最近一轮完整扫描的结果 */
+    unsigned long ino;              /* cgroup 目录的 inode 号 */
+    bool all;                       /* 统计所有页面 */
+    bool used;
+    unsigned long scanned;
+    unsigned long idle;
+    unsigned long cold;
+    unsigned long anon[MOEAI_WSS_AGE_BUCKETS];
+    unsigned long file[MOEAI_WSS_AGE_BUCKETS];
+};
+
+/* 工作集估算私有数据 */
+struct moeai_wss_private {
+    struct moeai_wss_config config;
+    struct moeai_wss_target targets[MOEAI_WSS_MAX_TARGETS];
+    unsigned int nr_targets;
+    u8 **ages;                      /* 按块分配的每页帧连续空闲轮数，饱和于255，未分配的块全为0 */
+    unsigned long nr_chunks;
+    unsigned long start_pfn;
+    unsigned long end_pfn;
+    unsigned long cursor;           /* 下一批的起始页帧 */
+    u64 *bitmap;                    /* 一批的空闲位 */
+    unsigned int cold_passes;
+    u64 passes;
+    unsigned long pass_start;       /* 本轮开始时间 (jiffies) */
+    unsigned int last_pass_ms;
+    unsigned long cold_total_kb;    /* 供定时器上下文读取，用 READ_ONCE 访问 */
+    bool cold_valid;
+    bool available;
+    bool active;
+    struct delayed_work scan_work;  /* 读写位图会睡眠，扫描放到工作队列中执行 */
+    struct mutex lock;              /* 保护配置、选中列表与扫描状态 */
+};
+
+static struct moeai_wss_private *wss_priv;
+
+/* 页帧在年龄表中的位置，块未分配时 alloc 为真则分配，否则返回 NULL (年龄为0) */
+static u8 *moeai_wss_age(struct moeai_wss_private *priv, unsigned long pfn, bool alloc)
+{
+    unsigned long off = pfn - priv->start_pfn;
+    u8 **chunk = &priv->ages[off / MOEAI_WSS_CHUNK_PAGES];
+
+    if (!*chunk && alloc)
+        *chunk = kvzalloc(MOEAI_WSS_CHUNK_PAGES, GFP_KERNEL);
+    return *chunk ? *chunk + off % MOEAI_WSS_CHUNK_PAGES : NULL;
+}
+
+static void moeai_wss_free_ages(struct moeai_wss_private *priv)
+{
+    unsigned long i;
+
+    if (!priv->ages)
+        return;
+    for (i = 0; i < priv->nr_chunks; i++)
+        kvfree(priv->ages[i]);
+    kvfree(priv->ages);
+    priv->ages = NULL;
+    priv->nr_chunks = 0;
+}
+
+/* 连续空闲轮数所在的桶 */
+static unsigned int moeai_wss_bucket(u8 age)
+{
+    return min_t(unsigned int, fls(age) - 1, MOEAI_WSS_AGE_BUCKETS - 1);
+}
+
+/* 页所属 memory cgroup 的 inode 号，未计费的页返回0 */
+static unsigned long moeai_wss_page_ino(struct folio *folio)
+{
+    struct mem_cgroup *memcg;
+    unsigned long ino = 0;
+
+    rcu_read_lock();
+    memcg = folio_memcg_check(folio);
+    if (memcg)
+        ino = cgroup_ino(memcg->css.cgroup);
+    rcu_read_unlock();
+
+    return ino;
+}
+
+/*
+ * 统计一个页帧
+ * 与 /proc/kpageflags 一样不持有页引用，读到的是近似值；只统计可回收的 LRU 页。
+ */
+static void moeai_wss_account(struct moeai_wss_private *priv, unsigned long pfn, bool idle)
+{
+    struct moeai_wss_target *t;
+    struct folio *folio;
+    struct page *page;
+    unsigned long ino;
+    unsigned int i, b, a = 0;
+    bool anon;
+    u8 *age;
+
+    page = pfn_to_online_page(pfn);
+    folio = page ? page_folio(page) : NULL;
+    if (!folio || !folio_test_lru(folio) || folio_test_unevictable(folio)) {
+        age = moeai_wss_age(priv, pfn, false);
+        if (age)
+            *age = 0;
+        return;
+    }
+
+    /* 块分配失败时该页按非空闲统计 */
+    age = moeai_wss_age(priv, pfn, idle);
+    if (age) {
+        *age = idle ? min_t(unsigned int, *age + 1, U8_MAX) : 0;
+        a = *age;
+    }
+    anon = folio_test_anon(folio);
+    ino = moeai_wss_page_ino(folio);
+
+    for (i = 0; i < MOEAI_WSS_MAX_TARGETS; i++) {
+        t = &priv->targets[i];
+        if (!t->used || (!t->all && t->ino != ino))
+            continue;
+        t->scanned++;
+        if (!a)
+            continue;
+        b = moeai_wss_bucket(a);
+        t->idle++;
+        if (anon)
+            t->anon[b]++;
+        else
+            t->file[b]++;
+        if (a >= priv->cold_passes)
+            t->cold++;
+    }
+}
+
+/* 根据轮次耗时换算冷内存对应的连续空闲轮数，调用者持有 lock */
+static void moeai_wss_update_cold_passes(struct moeai_wss_private *priv)
+{
+    unsigned long batches;
+    unsigned int pass_ms = priv->last_pass_ms;
+
+    /* 第一轮结束前按扫描速率估算轮次耗时 */
+    if (!priv->passes) {
+        batches = DIV_ROUND_UP(priv->end_pfn - priv->start_pfn, priv->config.scan_batch);
+        pass_ms = min_t(unsigned long, batches * priv->config.scan_interval_ms, UINT_MAX);
+    }
+    priv->cold_passes = clamp_t(unsigned int,
+                                DIV_ROUND_UP(priv->config.cold_age_ms, max(pass_ms, 1U)),
+                                1, U8_MAX);
+}
+
+/* 公布一轮完整扫描的结果并开始下一轮，调用者持有 lock */
+static void moeai_wss_end_pass(struct moeai_wss_private *priv)
+{
+    const unsigned long kb = PAGE_SIZE / 1024;
+    struct moeai_wss_target *t;
+    unsigned long cold_total = 0, cold_all = 0;
+    bool has_all = false;
+    unsigned int i, b;
+
+    priv->passes++;
+    priv->last_pass_ms = jiffies_to_msecs(jiffies - priv->pass_start);
+    priv->pass_start = jiffies;
+    priv->cursor = priv->start_pfn;
+
+    for (i = 0; i < MOEAI_WSS_MAX_TARGETS; i++) {
+        t = &priv->targets[i];
+        if (!t->used)
+            continue;
+        t->stats.scanned_kb = t->scanned * kb;
+        t->stats.wss_kb = (t->scanned - t->idle) * kb;
+        t->stats.cold_kb = t->cold * kb;
+        for (b = 0; b < MOEAI_WSS_AGE_BUCKETS; b++) {
+            t->stats.anon_kb[b] = t->anon[b] * kb;
+            t->stats.file_kb[b] = t->file[b] * kb;
+        }
+        if (t->all) {
+            has_all = true;
+            cold_all = t->stats.cold_kb;
+        }
+        cold_total += t->stats.cold_kb;
+
+        t->scanned = t->idle = t->cold = 0;
+        memset(t->anon, 0, sizeof(t->anon));
+        memset(t->file, 0, sizeof(t->file));
+    }
+
+    /* 第一轮只是把页面标记为空闲，从第二轮起结果才有意义 */
+    WRITE_ONCE(priv->cold_total_kb, has_all ? cold_all : cold_total);
+    WRITE_ONCE(priv->cold_valid, priv->passes >= 2);
+    moeai_wss_update_cold_passes(priv);
+}
+
+/*
+ * 扫描一批页帧，调用者持有 lock
+ * 先读出上次标记以来仍空闲的位，再把整批重新标记为空闲
+ */
+static int moeai_wss_scan_batch(struct moeai_wss_private *priv)
+{
+    unsigned long pfn = priv->cursor;
+    unsigned long end = min(pfn + priv->config.scan_batch, priv->end_pfn);
+    size_t len = DIV_ROUND_UP(end - pfn, MOEAI_WSS_WORD_PAGES) * sizeof(u64);
+    struct file *filp;
+    loff_t pos;
+    ssize_t n;
+    unsigned long i;
+
+    filp = filp_open(MOEAI_WSS_BITMAP, O_RDWR, 0);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+
+    pos = pfn / MOEAI_WSS_WORD_PAGES * sizeof(u64);
+    n = kernel_read(filp, priv->bitmap, len, &pos);
+    if (n < 0) {
+        filp_close(filp, NULL);
+        return n;
+    }
+    /* 超出最大页帧的部分读不到，视为非空闲 */
+    if (n < len)
+        memset((char *)priv->bitmap + n, 0, len - n);
+
+    for (i = 0; pfn + i < end; i++) {
+        moeai_wss_account(priv, pfn + i,
+                          priv->bitmap[i / MOEAI_WSS_WORD_PAGES] &
+                          BIT_ULL(i % MOEAI_WSS_WORD_PAGES));
+        if (i % MOEAI_WSS_WORD_PAGES == MOEAI_WSS_WORD_PAGES - 1)
+            cond_resched();
+    }
+
+    memset(priv->bitmap, 0xff, len);
+    pos = pfn / MOEAI_WSS_WORD_PAGES * sizeof(u64);
+    n = kernel_write(filp, priv->bitmap, len, &pos);
+    filp_close(filp, NULL);
+    if (n < 0)
+        return n;
+
+    priv->cursor = end;
+    if (priv->cursor >= priv->end_pfn)
+        moeai_wss_end_pass(priv);
+
+    return 0;
+}
+
+/* 每隔 scan_interval_ms 扫描一批，扫描速率上限为 scan_batch / scan_interval_ms */
+static void moeai_wss_scan_work(struct work_struct *work)
+{
+    struct moeai_wss_private *priv =
+        container_of(to_delayed_work(work), struct moeai_wss_private, scan_work);
+    unsigned int interval;
+    bool again;
+    int ret;
+
+    mutex_lock(&priv->lock);
+    if (priv->available && priv->nr_targets) {
+        ret = moeai_wss_scan_batch(priv);
+        if (ret) {
+            MOEAI_WARN(MODULE_NAME, lang_get(LANG_WSS_SCAN_FAILED), ret);
+            priv->available = false;
+            WRITE_ONCE(priv->cold_valid, false);
+        }
+    }
+    again = priv->available && priv->nr_targets;
+    interval = priv->config.scan_interval_ms;
+    mutex_unlock(&priv->lock);
+
+    if (again && READ_ONCE(priv->active))
+        queue_delayed_work(system_unbound_wq, &priv->scan_work, msecs_to_jiffies(interval));
+}
+
+/* 所有在线节点覆盖的页帧范围，按位图字对齐 */
+static void moeai_wss_pfn_range(unsigned long *start, unsigned long *end)
+{
+    int nid;
+
+    *start = ULONG_MAX;
+    *end = 0;
+    for_each_online_node(nid) {
+        *start = min(*start, NODE_DATA(nid)->node_start_pfn);
+        *end = max(*end, pgdat_end_pfn(NODE_DATA(nid)));
+    }
+    if (*start > *end)
+        *start = *end;
+    *start = round_down(*start, MOEAI_WSS_WORD_PAGES);
+    *end = round_up(*end, MOEAI_WSS_WORD_PAGES);
+}
+
+/* 检测空闲页跟踪，并按当前页帧范围准备年龄表，调用者持有 lock */
+static bool moeai_wss_prepare(struct moeai_wss_private *priv)
+{
+    unsigned long start, end;
+    struct file *filp;
+
+    filp = filp_open(MOEAI_WSS_BITMAP, O_RDWR, 0);
+    if (IS_ERR(filp))
+        return false;
+    filp_close(filp, NULL);
+
+    /* 内存热插拔后范围可能变化，重新分配并从头开始 */
+    moeai_wss_pfn_range(&start, &end);
+    if (!priv->ages || start != priv->start_pfn || end != priv->end_pfn) {
+        moeai_wss_free_ages(priv);
+        priv->ages = kvcalloc(DIV_ROUND_UP(end - start, MOEAI_WSS_CHUNK_PAGES),
+                              sizeof(*priv->ages), GFP_KERNEL);
+        if (!priv->ages)
+            return false;
+        priv->nr_chunks = DIV_ROUND_UP(end - start, MOEAI_WSS_CHUNK_PAGES);
+        priv->start_pfn = start;
+        priv->end_pfn = end;
+        priv->passes = 0;
+        WRITE_ONCE(priv->cold_valid, false);
+    }
+
+    priv->cursor = priv->start_pfn;
+    priv->pass_start = jiffies;
+    moeai_wss_update_cold_passes(priv);
+    return true;
+}
+
+static struct moeai_wss_target *moeai_wss_find(struct moeai_wss_private *priv, const char *path)
+{
+    int i;
+
+    for (i = 0; i < MOEAI_WSS_MAX_TARGETS; i++) {
+        if (priv->targets[i].used && strcmp(priv->targets[i].stats.path, path) == 0)
+            return &priv->targets[i];
+    }
+    return NULL;
+}
+
+/* 取 cgroup 目录的 inode 号，与 folio 所属 memcg 的 cgroup_ino 对应 */
+static int moeai_wss_lookup_ino(const char *path, unsigned long *ino)
+{
+    struct file *filp;
+    char *dir;
+
+    dir = kasprintf(GFP_KERNEL, MOEAI_MEMCG_ROOT "%s", path);
+    if (!dir)
+        return -ENOMEM;
+    filp = filp_open(dir, O_RDONLY | O_DIRECTORY, 0);
+    kfree(dir);
+    if (IS_ERR(filp))
+        return PTR_ERR(filp);
+
+    *ino = file_inode(filp)->i_ino;
+    filp_close(filp, NULL);
+    return 0;
+}
+
+int moeai_wss_set_target(const char *path, bool enable)
+{
+    struct moeai_wss_target *t;
+    unsigned long ino = 0;
+    bool all;
+    int i, ret = 0;
+
+    if (!wss_priv || !path || path[0] != '/' || strlen(path) >= MOEAI_MEMCG_PATH_LEN)
+        return -EINVAL;
+
+    all = strcmp(path, "/") == 0;
+    if (enable && !all) {
+        ret = moeai_wss_lookup_ino(path, &ino);
+        if (ret)
+            return ret;
+    }
+
+    mutex_lock(&wss_priv->lock);
+    t = moeai_wss_find(wss_priv, path);
+    if (!enable) {
+        if (t) {
+            t->used = false;
+            wss_priv->nr_targets--;
+        }
+    } else if (!t) {
+        for (i = 0; !t && i < MOEAI_WSS_MAX_TARGETS; i++) {
+            if (!wss_priv->targets[i].used)
+                t = &wss_priv->targets[i];
+        }
+        if (t) {
+            /* 新选中的 cgroup 从下一轮完整扫描开始才有结果 */
+            memset(t, 0, sizeof(*t));
+            strscpy(t->stats.path, path, sizeof(t->stats.path));
+            t->ino = ino;
+            t->all = all;
+            t->used = true;
+            wss_priv->nr_targets++;
+        } else {
+            ret = -ENOSPC;
+        }
+    }
+    mutex_unlock(&wss_priv->lock);
+
+    if (!ret && enable && READ_ONCE(wss_priv->active))
+        queue_delayed_work(system_unbound_wq, &wss_priv->scan_work, 0);
+
+    return ret;
+}
+
+int moeai_wss_get_targets(struct moeai_wss_target_stats *out, int max)
+{
+    int i, count = 0;
+
+    if (!wss_priv || !out || max <= 0)
+        return -EINVAL;
+
+    mutex_lock(&wss_priv->lock);
+    for (i = 0; i < MOEAI_WSS_MAX_TARGETS && count < max; i++) {
+        if (wss_priv->targets[i].used)
+            out[count++] = wss_priv->targets[i].stats;
+    }
+    mutex_unlock(&wss_priv->lock);
+
+    return count;
+}
+
+int moeai_wss_get_summary(struct moeai_wss_summary *summary)
+{
+    if (!wss_priv || !summary)
+        return -EINVAL;
+
+    mutex_lock(&wss_priv->lock);
+    summary->available = wss_priv->available;
+    summary->nr_targets = wss_priv->nr_targets;
+    summary->passes = wss_priv->passes;
+    summary->last_pass_ms = wss_priv->last_pass_ms;
+    summary->cold_passes = wss_priv->cold_passes;
+    summary->nr_pfns = wss_priv->end_pfn - wss_priv->start_pfn;
+    mutex_unlock(&wss_priv->lock);
+
+    return 0;
+}
+
+bool moeai_wss_target_cold_kb(const char *path, unsigned long *cold_kb)
+{
+    struct moeai_wss_target *t;
+    bool found = false;
+
+    if (!wss_priv || !path || !READ_ONCE(wss_priv->cold_valid))
+        return false;
+
+    mutex_lock(&wss_priv->lock);
+    t = moeai_wss_find(wss_priv, path);
+    if (t && wss_priv->passes >= 2) {
+        *cold_kb = t->stats.cold_kb;
+        found = true;
+    }
+    mutex_unlock(&wss_priv->lock);
+
+    return found;
+}
+
+bool moeai_wss_cold_kb(unsigned long *cold_kb)
+{
+    if (!wss_priv || !READ_ONCE(wss_priv->cold_valid))
+        return false;
+
+    *cold_kb = READ_ONCE(wss_priv->cold_total_kb);
+    return true;
+}
+
+/* cgroup 当前用量 (字节)，根 cgroup 没有 memory.current，用全局已用内存代替 */
+static int moeai_wss_usage(const char *path, u64 *bytes)
+{
+    if (strcmp(path, "/") == 0) {
+        *bytes = (u64)(totalram_pages() - global_zone_page_state(NR_FREE_PAGES)) << PAGE_SHIFT;
+        return 0;
+    }
+    return moeai_memcg_read_value(path, "memory.current", bytes);
+}
+
+/*
+ * 从各选中 cgroup 回收冷内存
+ * memory.reclaim 按 LRU 顺序回收，不能指定页面；把回收量限制在冷内存大小，
+ * 最先被回收的就是这些最久未访问的页，工作集不受影响。
+ * 回收不足请求量 (-EAGAIN) 很常见，效果按回收前后用量的实际减少量计算。
+ */
+long moeai_wss_reclaim_cold(void)
+{
+    struct moeai_wss_target_stats *targets;
+    u64 before, after;
+    long total = 0;
+    int i, n, ret, err = 0;
+    bool done = false;
+
+    if (!wss_priv || !READ_ONCE(wss_priv->cold_valid))
+        return -ENODATA;
+
+    targets = kmalloc_array(MOEAI_WSS_MAX_TARGETS, sizeof(*targets), GFP_KERNEL);
+    if (!targets)
+        return -ENOMEM;
+
+    n = moeai_wss_get_targets(targets, MOEAI_WSS_MAX_TARGETS);
+    for (i = 0; i < n; i++) {
+        if (!targets[i].cold_kb)
+            continue;
+        ret = moeai_wss_usage(targets[i].path, &before);
+        if (!ret)
+            ret = moeai_memcg_reclaim(targets[i].path, (u64)targets[i].cold_kb * 1024);
+        MOEAI_DEBUG(MODULE_NAME, lang_get(LANG_WSS_RECLAIM_COLD),
+                    targets[i].path, targets[i].cold_kb, ret);
+        if (ret && ret != -EAGAIN) {
+            err = ret;
+            continue;
+        }
+        done = true;
+        if (!moeai_wss_usage(targets[i].path, &after) && before > after)
+            total += (before - after) >> 10;
+    }
+    kfree(targets);
+
+    /* 所有 cgroup 都回收失败时返回错误，由调用者改用其他方式回收 */
+    return done || !err ? total : err;
+}
+
+int moeai_wss_get_config(struct moeai_wss_config *config)
+{
+    if (!wss_priv || !config)
+        return -EINVAL;
+
+    mutex_lock(&wss_priv->lock);
+    *config = wss_priv->config;
+    mutex_unlock(&wss_priv->lock);
+    return 0;
+}
+
+int moeai_wss_set_config(const struct moeai_wss_config *config)
+{
+    if (!wss_priv || !config)
+        return -EINVAL;
+    if (config->scan_interval_ms == 0 || config->scan_batch < MOEAI_WSS_WORD_PAGES ||
+        config->scan_batch > MOEAI_WSS_MAX_BATCH)
+        return -EINVAL;
+
+    mutex_lock(&wss_priv->lock);
+    wss_priv->config = *config;
+    wss_priv->config.scan_batch = round_down(config->scan_batch, MOEAI_WSS_WORD_PAGES);
+    moeai_wss_update_cold_passes(wss_priv);
+    mutex_unlock(&wss_priv->lock);
+    return 0;
+}
+
+void moeai_wss_start(void)
+{
+    bool ok;
+
+    if (!wss_priv || READ_ONCE(wss_priv->active))
+        return;
+
+    mutex_lock(&wss_priv->lock);
+    ok = wss_priv->available = moeai_wss_prepare(wss_priv);
+    mutex_unlock(&wss_priv->lock);
+    if (!ok) {
+        MOEAI_INFO(MODULE_NAME, lang_get(LANG_WSS_UNAVAILABLE), MOEAI_WSS_BITMAP);
+        return;
+    }
+
+    WRITE_ONCE(wss_priv->active, true);
+    queue_delayed_work(system_unbound_wq, &wss_priv->scan_work, 0);
+}
+
+void moeai_wss_stop(void)
+{
+    if (!wss_priv)
+        return;
+
+    WRITE_ONCE(wss_priv->active, false);
+    cancel_delayed_work_sync(&wss_priv->scan_work);
+}
+
+int moeai_wss_init(void)
+{
+    wss_priv = kzalloc(sizeof(*wss_priv), GFP_KERNEL);
+    if (!wss_priv)
+        return -ENOMEM;
+
+    wss_priv->bitmap = kmalloc(MOEAI_WSS_MAX_BATCH / 8, GFP_KERNEL);
+    if (!wss_priv->bitmap) {
+        kfree(wss_priv);
+        wss_priv = NULL;
+        return -ENOMEM;
+    }
+
+    wss_priv->config.scan_interval_ms = 100;   /* 100毫秒 */
+    wss_priv->config.scan_batch = 4096;        /* 每秒最多约160MB (4K页) */
+    wss_priv->config.cold_age_ms = 120000;     /* 2分钟 */
+
+    mutex_init(&wss_priv->lock);
+    INIT_DELAYED_WORK(&wss_priv->scan_work, moeai_wss_scan_work);
+    return 0;
+}
+
+void moeai_wss_exit(void)
+{
+    if (!wss_priv)
+        return;
+
+    moeai_wss_stop();
+    moeai_wss_free_ages(wss_priv);
+    kfree(wss_priv->bitmap);
+    kfree(wss_priv);
+    wss_priv = NULL;
+}
@@ -0,0 +1,203 @@
+/**
+ * MoeAI-C - 智能内核助手模块
+ *
+ * 文件: src/utils/bench.c
+ * 描述: 微基准测试运行器实现
+ *
+ * 版权所有 © 2025 @ydzat
+ */
+
+#include <linux/kernel.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/sched.h>
+#include <linux/timekeeping.h>
+#include <linux/kthread.h>
+#include <linux/cpumask.h>
+#include <linux/completion.h>
+#include <linux/wait.h>
+#include <linux/atomic.h>
+#include <linux/math64.h>
+#include "../../include/utils/bench.h"
+
+static int moeai_bench_cmp(const void *a, const void *b)
+{
+    u64 x = *(const u64 *)a, y = *(const u64 *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+int moeai_bench_run(const struct moeai_bench_case *bc, void *arg,
+                    struct moeai_bench_result *res)
+{
+    unsigned int warmup, n, i;
+    u64 *samples;
+    u64 start;
+
+    if (!bc || !bc->run || !res)
+        return -EINVAL;
+
+    warmup = bc->warmup ?: MOEAI_BENCH_WARMUP;
+    n = bc->iterations ?: MOEAI_BENCH_ITERATIONS;
+
+    samples = kvmalloc_array(n, sizeof(*samples), GFP_KERNEL);
+    if (!samples)
+        return -ENOMEM;
+
+    /* 预热缓存和分支预测，结果丢弃 */
+    for (i = 0; i < warmup; i++) {
+        if (bc->prepare)
+            bc->prepare(arg);
+        bc->run(arg);
+    }
+
+    /* 每次迭代单独计时，ktime_get_ns 为单调时钟，不受系统时间调整影响 */
+    for (i = 0; i < n; i++) {
+        if (bc->prepare)
+            bc->prepare(arg);
+        start = ktime_get_ns();
+        bc->run(arg);
+        samples[i] = ktime_get_ns() - start;
+        cond_resched();
+    }
+
+    sort(samples, n, sizeof(*samples), moeai_bench_cmp, NULL);
+
+    res->iterations = n;
+    res->min_ns = samples[0];
+    res->median_ns = samples[n / 2];
+    res->p99_ns = samples[DIV_ROUND_UP(n * 99, 100) - 1];
+    res->max_ns = samples[n - 1];
+
+    kvfree(samples);
+    return 0;
+}
+
+/* 每检查一次截止时间执行的操作数，减少读时钟的开销 */
+#define MOEAI_BENCH_PARALLEL_CHUNK 64
+
+/* 并行基准测试各线程共享的状态 */
+struct moeai_bench_sync {
+    void (*run)(void *arg);
+    void *arg;
+    atomic_t ready;                 /* 已就绪的线程数 */
+    atomic_t remaining;             /* 尚未结束的线程数 */
+    bool go;                        /* 开始信号 */
+    u64 deadline_ns;
+    wait_queue_head_t wait;         /* 等待就绪和开始信号 */
+    struct completion done;         /* 所有线程都已结束 */
+};
+
+struct moeai_bench_worker {
+    struct task_struct *task;
+    struct moeai_bench_sync *sync;
+    u64 ops;
+};
+
+static int moeai_bench_worker_fn(void *data)
+{
+    struct moeai_bench_worker *w = data;
+    struct moeai_bench_sync *sync = w->sync;
+    int i;
+
+    atomic_inc(&sync->ready);
+    wake_up_all(&sync->wait);
+    wait_event(sync->wait, smp_load_acquire(&sync->go) || kthread_should_stop());
+
+    if (smp_load_acquire(&sync->go)) {
+        while (ktime_get_ns() < sync->deadline_ns) {
+            for (i = 0; i < MOEAI_BENCH_PARALLEL_CHUNK; i++)
+                sync->run(sync->arg);
+            w->ops += MOEAI_BENCH_PARALLEL_CHUNK;
+            cond_resched();
+        }
+        if (atomic_dec_and_test(&sync->remaining))
+            complete(&sync->done);
+    }
+
+    /* 等待 kthread_stop 回收，避免线程先退出 */
+    while (!kthread_should_stop()) {
+        set_current_state(TASK_INTERRUPTIBLE);
+        if (kthread_should_stop())
+            break;
+        schedule();
+    }
+    __set_current_state(TASK_RUNNING);
+    return 0;
+}
+
+int moeai_bench_parallel(void (*run)(void *arg), void *arg, unsigned int nr_threads,
+                         unsigned int duration_ms, struct moeai_bench_parallel_result *res)
+{
+    struct moeai_bench_worker *workers;
+    struct moeai_bench_sync sync;
+    unsigned int started = 0, i;
+    int cpu, ret = 0;
+    u64 start;
+
+    if (!run || !res || nr_threads == 0 || duration_ms == 0)
+        return -EINVAL;
+
+    workers = kcalloc(nr_threads, sizeof(*workers), GFP_KERNEL);
+    if (!workers)
+        return -ENOMEM;
+
+    memset(&sync, 0, sizeof(sync));
+    sync.run = run;
+    sync.arg = arg;
+    init_waitqueue_head(&sync.wait);
+    init_completion(&sync.done);
+
+    /* CPU 热插拔期间在线 CPU 可能变化，持有读锁直到线程绑定完成 */
+    cpus_read_lock();
+    for_each_online_cpu(cpu) {
+        struct moeai_bench_worker *w;
+
+        if (started == nr_threads)
+            break;
+        w = &workers[started];
+        w->sync = &sync;
+        w->task = kthread_create(moeai_bench_worker_fn, w, "moeai_bench/%d", cpu);
+        if (IS_ERR(w->task)) {
+            ret = PTR_ERR(w->task);
+            w->task = NULL;
+            break;
+        }
+        kthread_bind(w->task, cpu);
+        started++;
+    }
+    cpus_read_unlock();
+
+    if (ret == 0 && started < nr_threads)
+        ret = -EINVAL;
+
+    if (ret == 0) {
+        atomic_set(&sync.remaining, started);
+        for (i = 0; i < started; i++)
+            wake_up_process(workers[i].task);
+        wait_event(sync.wait, atomic_read(&sync.ready) == started);
+
+        start = ktime_get_ns();
+        sync.deadline_ns = start + (u64)duration_ms * NSEC_PER_MSEC;
+        smp_store_release(&sync.go, true);
+        wake_up_all(&sync.wait);
+        wait_for_completion(&sync.done);
+        res->duration_ns = ktime_get_ns() - start;
+    }
+
+    /* 未启动的线程由 kthread_stop 直接回收，不会运行 */
+    res->ops = 0;
+    for (i = 0; i < started; i++) {
+        kthread_stop(workers[i].task);
+        res->ops += workers[i].ops;
+    }
+    kfree(workers);
+
+    if (ret)
+        return ret;
+
+    res->nr_threads = started;
+    res->ops_per_sec = res->duration_ns ?
+        div64_u64(res->ops * NSEC_PER_SEC, res->duration_ns) : 0;
+    return 0;
+}
@@ -14,9 +14,14 @@
 #include <linux/time.h>
 #include <linux/string.h>
 #include <linux/stdarg.h>
+#include <linux/atomic.h>
+#include <linux/percpu.h>
+#include <linux/cpumask.h>
+#include <linux/build_bug.h>
 #include "../../include/utils/logger.h"
 #include "../../include/utils/ring_buffer.h"
 #include "../../include/utils/lang.h"
+#include "../../include/core/event_loop.h"
 
 /* 日志缓冲区大小 */
 #define MOEAI_LOG_BUFFER_SIZE 100
@@ -26,11 +31,26 @@ struct moeai_logger_context {
     struct moeai_logger_config config;
     struct moeai_ring_buffer *log_buffer;
     spinlock_t buffer_lock;
+    atomic_long_t contended;    /* 写入缓冲区时需要等待锁的次数 */
 };
 
 /* 全局日志上下文 */
 static struct moeai_logger_context moeai_logger_ctx;
 
+/* 按级别的日志计数，每个 CPU 一份，避免日志路径上的共享写 */
+struct moeai_logger_counters {
+    unsigned long messages[MOEAI_LOG_LEVELS];
+    unsigned long filtered;
+};
+static DEFINE_PER_CPU(struct moeai_logger_counters, moeai_logger_counters);
+
+/* 固定的英文级别名，供指标标签和事件等机器可读的输出使用 */
+static const char * const moeai_log_level_keys[] = {
+    "debug", "info", "warn", "error", "fatal",
+};
+
+static_assert(ARRAY_SIZE(moeai_log_level_keys) == MOEAI_LOG_LEVELS);
+
 /**
  * 初始化日志系统
  * @debug_mode: 是否启用调试模式
@@ -79,6 +99,32 @@ void moeai_logger_exit(void)
     pr_info("%s\n", lang_get(LANG_LOG_EXIT_COMPLETE));
 }
 
+/* 格式化一条日志条目 */
+static void moeai_log_fill(struct moeai_log_entry *entry, enum moeai_log_level level,
+                           const char *module, const char *fmt, va_list args)
+{
+    entry->timestamp = ktime_get_real_ns();
+    entry->level = level;
+    strscpy(entry->module, module, sizeof(entry->module));
+    vsnprintf(entry->message, sizeof(entry->message), fmt, args);
+}
+
+/* 在 lock 保护下写入环形缓冲区，需要等待锁时计入 contended */
+static int moeai_log_buffer_write(struct moeai_ring_buffer *rb, spinlock_t *lock,
+                                  atomic_long_t *contended, const struct moeai_log_entry *entry)
+{
+    int ret;
+
+    /* 检查定时器和突发采样定时器在软中断中记录日志，持锁时须关闭下半部 */
+    if (!spin_trylock_bh(lock)) {
+        atomic_long_inc(contended);
+        spin_lock_bh(lock);
+    }
+    ret = moeai_ring_buffer_write(rb, entry);
+    spin_unlock_bh(lock);
+    return ret;
+}
+
 /**
  * 记录一条日志
  * @level: 日志级别
@@ -90,26 +136,21 @@ void moeai_log(enum moeai_log_level level, const char *module, const char *fmt,
 {
     va_list args;
     struct moeai_log_entry entry;
-    char message[256];
     int ret;
     
     /* 检查日志级别 */
-    if (level < moeai_logger_ctx.config.min_level)
+    if (level < moeai_logger_ctx.config.min_level) {
+        this_cpu_inc(moeai_logger_counters.filtered);
         return;
+    }
+    if (level < MOEAI_LOG_LEVELS)
+        this_cpu_inc(moeai_logger_counters.messages[level]);
         
-    /* 格式化消息 */
+    /* 格式化消息并填充日志条目 */
     va_start(args, fmt);
-    vsnprintf(message, sizeof(message), fmt, args);
+    moeai_log_fill(&entry, level, module, fmt, args);
     va_end(args);
     
-    /* 填充日志条目 */
-    entry.timestamp = ktime_get_real_ns();
-    entry.level = level;
-    strncpy(entry.module, module, sizeof(entry.module) - 1);
-    entry.module[sizeof(entry.module) - 1] = '\0';
-    strncpy(entry.message, message, sizeof(entry.message) - 1);
-    entry.message[sizeof(entry.message) - 1] = '\0';
-    
     /* 输出到内核日志 */
     if (moeai_logger_ctx.config.console_output) {
         const char *level_str;
@@ -135,18 +176,63 @@ void moeai_log(enum moeai_log_level level, const char *module, const char *fmt,
             break;
         }
         
-        printk("%s: MoeAI-C [%s] %s\n", level_str, module, message);
+        printk("%s: MoeAI-C [%s] %s\n", level_str, module, entry.message);
     }
     
     /* 写入环形缓冲区 */
     if (moeai_logger_ctx.config.buffer_output && moeai_logger_ctx.log_buffer) {
-        spin_lock(&moeai_logger_ctx.buffer_lock);
-        ret = moeai_ring_buffer_write(moeai_logger_ctx.log_buffer, &entry);
-        spin_unlock(&moeai_logger_ctx.buffer_lock);
-        
+        ret = moeai_log_buffer_write(moeai_logger_ctx.log_buffer, &moeai_logger_ctx.buffer_lock,
+                                     &moeai_logger_ctx.contended, &entry);
         if (ret)
             printk(KERN_WARNING "%s: %d\n", lang_get(LANG_LOG_BUFFER_WRITE_FAILED), ret);
     }
+    
+    /* 警告及以上级别通知事件中心，订阅者据此去读日志；两种输出都关闭时无处可读，不通知 */
+    if (level >= MOEAI_LOG_WARN &&
+        (moeai_logger_ctx.config.console_output || moeai_logger_ctx.config.buffer_output))
+        moeai_event_hub_publish(MOEAI_HUB_LOG_WARN, level, 0, 0);
+}
+
+/**
+ * 初始化私有日志输出目标
+ * @sink: 输出目标
+ * @min_level: 最小日志级别
+ * @buffer: 写入的环形缓冲区，NULL 表示只过滤和格式化，由调用者创建和销毁
+ */
+void moeai_log_sink_init(struct moeai_log_sink *sink, enum moeai_log_level min_level,
+                         struct moeai_ring_buffer *buffer)
+{
+    sink->min_level = min_level;
+    sink->buffer = buffer;
+    spin_lock_init(&sink->lock);
+    atomic_long_set(&sink->contended, 0);
+}
+
+/**
+ * 向私有输出目标记录一条日志
+ * 与 moeai_log 走相同的过滤、格式化和加锁写入路径，但不输出到控制台、
+ * 不计入日志计数、也不通知事件中心
+ * @sink: 输出目标
+ * @level: 日志级别
+ * @module: 模块名称
+ * @fmt: 格式化字符串
+ * @...: 变长参数
+ */
+void moeai_log_to(struct moeai_log_sink *sink, enum moeai_log_level level,
+                  const char *module, const char *fmt, ...)
+{
+    va_list args;
+    struct moeai_log_entry entry;
+
+    if (level < sink->min_level)
+        return;
+
+    va_start(args, fmt);
+    moeai_log_fill(&entry, level, module, fmt, args);
+    va_end(args);
+
+    if (sink->buffer)
+        moeai_log_buffer_write(sink->buffer, &sink->lock, &sink->contended, &entry);
 }
 
 /**
@@ -166,9 +252,9 @@ int moeai_logger_get_recent_logs(struct moeai_log_entry *entries, size_t max_ent
     if (!moeai_logger_ctx.log_buffer)
         return -EINVAL;
     
-    spin_lock(&moeai_logger_ctx.buffer_lock);
+    spin_lock_bh(&moeai_logger_ctx.buffer_lock);
     ret = moeai_ring_buffer_read_batch(moeai_logger_ctx.log_buffer, entries, max_entries, count);
-    spin_unlock(&moeai_logger_ctx.buffer_lock);
+    spin_unlock_bh(&moeai_logger_ctx.buffer_lock);
     
     return ret;
 }
@@ -180,36 +266,36 @@ int moeai_logger_get_recent_logs(struct moeai_log_entry *entries, size_t max_ent
  */
 int moeai_logger_set_config(const struct moeai_logger_config *config)
 {
+    struct moeai_ring_buffer *new_buffer = NULL;
+    struct moeai_ring_buffer *old_buffer = NULL;
+
     if (!config)
         return -EINVAL;
     
-    spin_lock(&moeai_logger_ctx.buffer_lock);
-    
-    /* 检查缓冲区大小是否改变 */
-    if (config->buffer_size != moeai_logger_ctx.config.buffer_size && 
+    /* 缓冲区大小改变时在锁外创建新缓冲区，分配可能睡眠 */
+    if (config->buffer_size != READ_ONCE(moeai_logger_ctx.config.buffer_size) &&
         config->buffer_output) {
-        struct moeai_ring_buffer *new_buffer;
-        
-        /* 创建新的缓冲区 */
         new_buffer = moeai_ring_buffer_create(config->buffer_size, 
                                             sizeof(struct moeai_log_entry));
-        if (!new_buffer) {
-            spin_unlock(&moeai_logger_ctx.buffer_lock);
+        if (!new_buffer)
             return -ENOMEM;
-        }
-        
-        /* 替换旧的缓冲区 */
-        if (moeai_logger_ctx.log_buffer) {
-            moeai_ring_buffer_destroy(moeai_logger_ctx.log_buffer);
-        }
-        
+    }
+    
+    spin_lock_bh(&moeai_logger_ctx.buffer_lock);
+    
+    /* 替换旧的缓冲区 */
+    if (new_buffer) {
+        old_buffer = moeai_logger_ctx.log_buffer;
         moeai_logger_ctx.log_buffer = new_buffer;
     }
     
     /* 更新配置 */
     moeai_logger_ctx.config = *config;
     
-    spin_unlock(&moeai_logger_ctx.buffer_lock);
+    spin_unlock_bh(&moeai_logger_ctx.buffer_lock);
+    
+    if (old_buffer)
+        moeai_ring_buffer_destroy(old_buffer);
     
     return 0;
 }
@@ -224,9 +310,40 @@ int moeai_logger_get_config(struct moeai_logger_config *config)
     if (!config)
         return -EINVAL;
     
-    spin_lock(&moeai_logger_ctx.buffer_lock);
+    spin_lock_bh(&moeai_logger_ctx.buffer_lock);
     *config = moeai_logger_ctx.config;
-    spin_unlock(&moeai_logger_ctx.buffer_lock);
+    spin_unlock_bh(&moeai_logger_ctx.buffer_lock);
     
     return 0;
 }
+
+/**
+ * 获取日志系统计数
+ * @stats: 输出，汇总所有 CPU 的计数
+ */
+void moeai_logger_get_stats(struct moeai_logger_stats *stats)
+{
+    int cpu, i;
+
+    memset(stats, 0, sizeof(*stats));
+    for_each_possible_cpu(cpu) {
+        const struct moeai_logger_counters *c = per_cpu_ptr(&moeai_logger_counters, cpu);
+
+        for (i = 0; i < MOEAI_LOG_LEVELS; i++)
+            stats->messages[i] += READ_ONCE(c->messages[i]);
+        stats->filtered += READ_ONCE(c->filtered);
+    }
+    stats->contended = atomic_long_read(&moeai_logger_ctx.contended);
+}
+
+/**
+ * 获取日志级别的英文键名
+ * @level: 日志级别
+ * 返回值: 不随界面语言变化的级别名
+ */
+const char *moeai_log_level_key(enum moeai_log_level level)
+{
+    if (level < 0 || level >= MOEAI_LOG_LEVELS)
+        return "unknown";
+    return moeai_log_level_keys[level];
+}
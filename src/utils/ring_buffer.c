@@ -10,6 +10,7 @@
 #include <linux/kernel.h>
 #include <linux/slab.h>
 #include <linux/spinlock.h>
+#include <linux/atomic.h>
 #include "../../include/utils/ring_buffer.h"
 
 /* 环形缓冲区结构定义 */
@@ -21,8 +22,18 @@ struct moeai_ring_buffer {
     size_t tail;            /* 尾部索引 */
     size_t count;           /* 当前项数 */
     spinlock_t lock;        /* 自旋锁保护 */
+    atomic_long_t contended; /* 获取锁时需要等待的次数 */
 };
 
+/* 获取锁，先尝试一次，失败时记录一次争用再等待 */
+#define moeai_ring_buffer_lock(rb, flags)                    \
+    do {                                                    \
+        if (!spin_trylock_irqsave(&(rb)->lock, flags)) {    \
+            atomic_long_inc(&(rb)->contended);              \
+            spin_lock_irqsave(&(rb)->lock, flags);          \
+        }                                                   \
+    } while (0)
+
 /**
  * 创建新的环形缓冲区
  * @capacity: 缓冲区可以容纳的项数
@@ -54,6 +65,7 @@ struct moeai_ring_buffer *moeai_ring_buffer_create(size_t capacity, size_t item_
     rb->tail = 0;
     rb->count = 0;
     spin_lock_init(&rb->lock);
+    atomic_long_set(&rb->contended, 0);
     
     return rb;
 }
@@ -87,7 +99,7 @@ int moeai_ring_buffer_write(struct moeai_ring_buffer *rb, const void *item)
     if (!rb || !item)
         return -EINVAL;
     
-    spin_lock_irqsave(&rb->lock, flags);
+    moeai_ring_buffer_lock(rb, flags);
     
     /* 如果缓冲区已满，覆盖最旧的数据 */
     if (rb->count == rb->capacity) {
@@ -126,7 +138,7 @@ int moeai_ring_buffer_read(struct moeai_ring_buffer *rb, void *item)
     if (!rb || !item)
         return -EINVAL;
     
-    spin_lock_irqsave(&rb->lock, flags);
+    moeai_ring_buffer_lock(rb, flags);
     
     if (rb->count == 0) {
         spin_unlock_irqrestore(&rb->lock, flags);
@@ -163,7 +175,7 @@ int moeai_ring_buffer_read_batch(struct moeai_ring_buffer *rb, void *items,
     if (!rb || !items || !actual_items)
         return -EINVAL;
     
-    spin_lock_irqsave(&rb->lock, flags);
+    moeai_ring_buffer_lock(rb, flags);
     
     /* 确定可读取的项数 */
     available = (max_items < rb->count) ? max_items : rb->count;
@@ -250,4 +262,14 @@ bool moeai_ring_buffer_is_full(struct moeai_ring_buffer *rb)
     spin_unlock_irqrestore(&rb->lock, flags);
     
     return is_full;
-}
\ No newline at end of file
+}
+
+/**
+ * 获取锁争用次数
+ * @rb: 环形缓冲区
+ * 返回值: 创建以来读写时需要等待锁的次数
+ */
+unsigned long moeai_ring_buffer_contended(struct moeai_ring_buffer *rb)
+{
+    return rb ? atomic_long_read(&rb->contended) : 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * MoeAI-C - Intelligent Kernel Assistant Module
+ *
+ * File: test/test_control.c
+ * Description: Control command parser and configuration transaction unit test
+ *
+ * Copyright © 2025 @ydzat
+ */
+
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+
+#include "../include/ipc/control.h"
+#include "../include/modules/mem_monitor.h"
+#include "../include/modules/mem_policy.h"
+#include "../include/utils/logger.h"
+#include "../include/utils/lang.h"
+
+/* moeai_control_run() modifies the batch, run a writable copy */
+static int test_control_run(const char *batch, char *result, unsigned int *interval_ms)
+{
+    struct moeai_mem_monitor_config config;
+    char *copy;
+    int ret;
+
+    copy = kstrdup(batch, GFP_KERNEL);
+    if (!copy)
+        return -ENOMEM;
+    ret = moeai_control_run(copy, result, MOEAI_CTL_RESULT_LEN, NULL);
+    kfree(copy);
+
+    *interval_ms = 0;
+    if (moeai_mem_monitor_get_config(&config) == 0)
+        *interval_ms = config.check_interval_ms;
+    return ret;
+}
+
+/* Test environment initialization function */
+static int __init test_control_init(void)
+{
+    struct moeai_mem_policy_config policy;
+    unsigned int interval;
+    char *result;
+    int ret;
+
+    pr_info("%s", lang_get(LANG_TEST_CTL_START));
+
+    ret = moeai_logger_init(true);
+    if (ret != 0) {
+        pr_err(lang_get(LANG_TEST_MEM_LOG_INIT_FAILED), ret);
+        return ret;
+    }
+
+    ret = moeai_mem_monitor_init();
+    if (ret != 0) {
+        pr_err(lang_get(LANG_TEST_MEM_INIT_FAILED), ret);
+        goto err_mem;
+    }
+
+    ret = moeai_control_init();
+    if (ret != 0) {
+        pr_err(lang_get(LANG_TEST_CTL_INIT_FAILED), ret);
+        goto err_control;
+    }
+
+    result = kmalloc(MOEAI_CTL_RESULT_LEN, GFP_KERNEL);
+    if (!result) {
+        ret = -ENOMEM;
+        goto err_result;
+    }
+
+    /* Test 1: Comments and blank lines are skipped, the last value for a field wins */
+    ret = test_control_run("# comment\n\nset interval 5000\n  set interval 7000  \n",
+                           result, &interval);
+    if (ret != 0 || interval != 7000) {
+        pr_err(lang_get(LANG_TEST_CTL_APPLY_FAILED), ret, interval);
+        goto err_test;
+    }
+    pr_info("%s", lang_get(LANG_TEST_CTL_APPLY_PASSED));
+
+    /* Test 2: An unknown command, a bad argument or a wrong count rejects the whole batch */
+    ret = test_control_run("set interval 8000\nbogus command\n", result, &interval);
+    if (ret == 0 || interval != 7000) {
+        pr_err(lang_get(LANG_TEST_CTL_REJECT_FAILED), ret, interval);
+        goto err_test;
+    }
+    ret = test_control_run("set interval 8000\nset interval abc\n", result, &interval);
+    if (ret == 0 || interval != 7000) {
+        pr_err(lang_get(LANG_TEST_CTL_REJECT_FAILED), ret, interval);
+        goto err_test;
+    }
+    ret = test_control_run("set interval 8000\nset cooldown gentle\n", result, &interval);
+    if (ret == 0 || interval != 7000) {
+        pr_err(lang_get(LANG_TEST_CTL_REJECT_FAILED), ret, interval);
+        goto err_test;
+    }
+    ret = test_control_run("set interval 8000\nset cooldown lazy 1000\n", result, &interval);
+    if (ret == 0 || interval != 7000) {
+        pr_err(lang_get(LANG_TEST_CTL_REJECT_FAILED), ret, interval);
+        goto err_test;
+    }
+    pr_info("%s", lang_get(LANG_TEST_CTL_REJECT_PASSED));
+
+    /*
+     * Test 3: The memory monitor commits first; when the policy module then rejects
+     * an out of range target the monitor is restored to its previous config
+     */
+    ret = test_control_run("set interval 9000\nset policy target 150\n", result, &interval);
+    if (ret != -EINVAL || interval != 7000 ||
+        moeai_mem_policy_get_config(&policy) || policy.target_percent > 100) {
+        pr_err(lang_get(LANG_TEST_CTL_ROLLBACK_FAILED), ret, interval);
+        goto err_test;
+    }
+    pr_info("%s", lang_get(LANG_TEST_CTL_ROLLBACK_PASSED));
+
+    kfree(result);
+    pr_info("%s", lang_get(LANG_TEST_CTL_ALL_PASSED));
+    return 0;
+
+err_test:
+    ret = -EINVAL;
+    kfree(result);
+err_result:
+    moeai_control_exit();
+err_control:
+    moeai_mem_monitor_exit();
+err_mem:
+    moeai_logger_exit();
+    return ret;
+}
+
+/* Test environment cleanup function */
+static void __exit test_control_exit(void)
+{
+    moeai_control_exit();
+    moeai_mem_monitor_exit();
+    moeai_logger_exit();
+}
+
+module_init(test_control_init);
+module_exit(test_control_exit);
+
+MODULE_LICENSE("MIT");
+MODULE_AUTHOR("@ydzat");
+MODULE_DESCRIPTION("MoeAI-C Control Command Test Module");
+MODULE_VERSION("0.1");
@@ -0,0 +1,130 @@
+/**
+ * MoeAI-C - Intelligent Kernel Assistant Module
+ *
+ * File: test/test_history.c
+ * Description: Fixed-point Holt trend forecast unit test
+ *
+ * Copyright © 2025 @ydzat
+ */
+
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/errno.h>
+
+#include "../include/data/history.h"
+#include "../include/utils/lang.h"
+
+/* Smoothing factors used by the memory monitor forecast */
+#define TEST_HOLT_ALPHA (MOEAI_FP_ONE / 2)
+#define TEST_HOLT_BETA  (MOEAI_FP_ONE * 3 / 10)
+
+/* Samples fed to a series, enough for the smoothed trend to converge */
+#define TEST_HOLT_SAMPLES 40
+
+/* Allowed error: 1% of the expected value */
+static bool test_holt_close(s64 value, s64 expected)
+{
+    s64 diff = value - expected;
+    s64 tol = max_t(s64, abs(expected) / 100, 1);
+
+    return diff >= -tol && diff <= tol;
+}
+
+/* Test environment initialization function */
+static int __init test_history_init(void)
+{
+    struct moeai_history h;
+    unsigned int ms, i;
+    s64 expected;
+    int ret;
+
+    pr_info("%s", lang_get(LANG_TEST_HOLT_START));
+
+    /* Test 1: A constant series keeps its level exactly with zero trend */
+    moeai_history_init(&h, TEST_HOLT_ALPHA, TEST_HOLT_BETA);
+    for (i = 0; i < TEST_HOLT_SAMPLES; i++)
+        moeai_history_add(&h, MOEAI_FP(60), 1000);
+    if (h.level != MOEAI_FP(60) || h.trend != 0) {
+        pr_err(lang_get(LANG_TEST_HOLT_CONST_FAILED), h.level, h.trend);
+        return -EINVAL;
+    }
+    pr_info("%s", lang_get(LANG_TEST_HOLT_CONST_PASSED));
+
+    /* Test 2: A linear ramp of 1% per second, sampled every 500 ms */
+    moeai_history_init(&h, TEST_HOLT_ALPHA, TEST_HOLT_BETA);
+    for (i = 0; i < TEST_HOLT_SAMPLES; i++)
+        moeai_history_add(&h, MOEAI_FP(20) + i * MOEAI_FP_ONE / 2, 500);
+    expected = MOEAI_FP(20) + (TEST_HOLT_SAMPLES - 1) * MOEAI_FP_ONE / 2;
+    if (!test_holt_close(h.trend, MOEAI_FP_ONE) ||
+        !test_holt_close(h.level, expected) ||
+        !test_holt_close(moeai_history_forecast(&h, 1000), expected + MOEAI_FP_ONE)) {
+        pr_err(lang_get(LANG_TEST_HOLT_RAMP_FAILED), h.trend, (s64)MOEAI_FP_ONE);
+        return -EINVAL;
+    }
+    pr_info("%s", lang_get(LANG_TEST_HOLT_RAMP_PASSED));
+
+    /* Test 3: 10% above the level at 1% per second is about 10 seconds away */
+    ret = moeai_history_time_to(&h, h.level + MOEAI_FP(10), &ms);
+    if (ret || !test_holt_close(ms, 10000)) {
+        pr_err(lang_get(LANG_TEST_HOLT_TIME_TO_FAILED), ms, ret, 10000U);
+        return -EINVAL;
+    }
+    ret = moeai_history_time_to(&h, h.level - MOEAI_FP(1), &ms);
+    if (ret || ms != 0) {
+        pr_err(lang_get(LANG_TEST_HOLT_TIME_TO_FAILED), ms, ret, 0U);
+        return -EINVAL;
+    }
+    pr_info("%s", lang_get(LANG_TEST_HOLT_TIME_TO_PASSED));
+
+    /* Test 4: Falling and single-sample series never reach a higher threshold */
+    moeai_history_init(&h, TEST_HOLT_ALPHA, TEST_HOLT_BETA);
+    moeai_history_add(&h, MOEAI_FP(50), 1000);
+    ret = moeai_history_time_to(&h, MOEAI_FP(90), &ms);
+    if (ret != -ERANGE) {
+        pr_err(lang_get(LANG_TEST_HOLT_FALLING_FAILED), ret);
+        return -EINVAL;
+    }
+    for (i = 1; i < TEST_HOLT_SAMPLES; i++)
+        moeai_history_add(&h, MOEAI_FP(50) - i * MOEAI_FP_ONE / 2, 1000);
+    ret = moeai_history_time_to(&h, MOEAI_FP(90), &ms);
+    if (ret != -ERANGE || h.trend >= 0) {
+        pr_err(lang_get(LANG_TEST_HOLT_FALLING_FAILED), ret);
+        return -EINVAL;
+    }
+    pr_info("%s", lang_get(LANG_TEST_HOLT_FALLING_PASSED));
+
+    /* Test 5: The history wraps after MOEAI_HISTORY_LEN samples, a zero interval is tolerated */
+    moeai_history_init(&h, TEST_HOLT_ALPHA, TEST_HOLT_BETA);
+    for (i = 0; i < MOEAI_HISTORY_LEN + 5; i++)
+        moeai_history_add(&h, MOEAI_FP(i), 0);
+    if (h.count != MOEAI_HISTORY_LEN ||
+        moeai_history_get(&h, 0) != MOEAI_FP(MOEAI_HISTORY_LEN + 4) ||
+        moeai_history_get(&h, MOEAI_HISTORY_LEN - 1) != MOEAI_FP(5) ||
+        moeai_history_get(&h, MOEAI_HISTORY_LEN) != 0) {
+        pr_err(lang_get(LANG_TEST_HOLT_RING_FAILED), h.count, moeai_history_get(&h, 0));
+        return -EINVAL;
+    }
+    moeai_history_reset(&h);
+    if (h.count != 0 || h.alpha != TEST_HOLT_ALPHA || h.beta != TEST_HOLT_BETA) {
+        pr_err(lang_get(LANG_TEST_HOLT_RING_FAILED), h.count, moeai_history_get(&h, 0));
+        return -EINVAL;
+    }
+    pr_info("%s", lang_get(LANG_TEST_HOLT_RING_PASSED));
+
+    pr_info("%s", lang_get(LANG_TEST_HOLT_ALL_PASSED));
+    return 0;
+}
+
+/* Test environment cleanup function */
+static void __exit test_history_exit(void)
+{
+}
+
+module_init(test_history_init);
+module_exit(test_history_exit);
+
+MODULE_LICENSE("MIT");
+MODULE_AUTHOR("@ydzat");
+MODULE_DESCRIPTION("MoeAI-C Trend Forecast Test Module");
+MODULE_VERSION("0.1");
@@ -30,7 +30,7 @@ static int __init test_mem_monitor_init(void)
     /* Test 1: Initialize logger system */
     ret = moeai_logger_init(true);
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_LOG_INIT_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_LOG_INIT_FAILED), ret);
         return ret;
     }
     pr_info("%s", lang_get(LANG_TEST_MEM_LOG_INIT_PASSED));
@@ -38,7 +38,7 @@ static int __init test_mem_monitor_init(void)
     /* Test 2: Initialize memory monitor */
     ret = moeai_mem_monitor_init();
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_INIT_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_INIT_FAILED), ret);
         moeai_logger_exit();
         return ret;
     }
@@ -47,26 +47,26 @@ static int __init test_mem_monitor_init(void)
     /* Test 3: Get memory stats */
     ret = moeai_mem_monitor_get_stats(&stats);
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_GET_STATS_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_GET_STATS_FAILED), ret);
         moeai_mem_monitor_exit();
         moeai_logger_exit();
         return ret;
     }
     
-    pr_info("%s", lang_get(LANG_TEST_MEM_STATS_FORMAT),
+    pr_info(lang_get(LANG_TEST_MEM_STATS_FORMAT),
            stats.total_ram, stats.available_ram, stats.mem_usage_percent);
     pr_info("%s", lang_get(LANG_TEST_MEM_GET_STATS_PASSED));
     
     /* Test 4: Get default config */
     ret = moeai_mem_monitor_get_config(&config);
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_GET_CONFIG_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_GET_CONFIG_FAILED), ret);
         moeai_mem_monitor_exit();
         moeai_logger_exit();
         return ret;
     }
     
-    pr_info("%s", lang_get(LANG_TEST_MEM_CONFIG_FORMAT),
+    pr_info(lang_get(LANG_TEST_MEM_CONFIG_FORMAT),
            config.check_interval_ms, config.warn_threshold, 
            config.critical_threshold, config.emergency_threshold,
            config.auto_reclaim ? lang_get(LANG_PROCFS_AUTO_RECLAIM_ON) : 
@@ -82,7 +82,7 @@ static int __init test_mem_monitor_init(void)
     
     ret = moeai_mem_monitor_set_config(&new_config);
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_SET_CONFIG_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_SET_CONFIG_FAILED), ret);
         moeai_mem_monitor_exit();
         moeai_logger_exit();
         return ret;
@@ -100,10 +100,52 @@ static int __init test_mem_monitor_init(void)
     }
     pr_info("%s", lang_get(LANG_TEST_MEM_SET_CONFIG_PASSED));
     
+    /* Test 5b: State machine starts in NORMAL and exit thresholds stay below entry thresholds */
+    {
+        struct moeai_mem_state_info state;
+        
+        ret = moeai_mem_monitor_get_state(&state);
+        if (ret != 0 || state.state != MOEAI_STATE_NORMAL || state.transitions != 0 ||
+            config.warn_exit_threshold >= config.warn_threshold ||
+            config.critical_exit_threshold >= config.critical_threshold ||
+            config.emergency_exit_threshold >= config.emergency_threshold) {
+            pr_err(lang_get(LANG_TEST_MEM_STATE_FAILED),
+                   state.state, config.warn_exit_threshold);
+            moeai_mem_monitor_exit();
+            moeai_logger_exit();
+            return -EINVAL;
+        }
+        pr_info("%s", lang_get(LANG_TEST_MEM_STATE_PASSED));
+    }
+    
+    /* Test 5c: Per-node statistics cover at least one online node */
+    {
+        struct moeai_mem_node_stats *nodes;
+        int nr_nodes;
+        
+        nodes = kcalloc(MOEAI_MEM_MAX_NODES, sizeof(*nodes), GFP_KERNEL);
+        if (!nodes) {
+            moeai_mem_monitor_exit();
+            moeai_logger_exit();
+            return -ENOMEM;
+        }
+        nr_nodes = moeai_mem_monitor_get_node_stats(nodes, MOEAI_MEM_MAX_NODES);
+        if (nr_nodes <= 0 || nodes[0].total_ram == 0 ||
+            nodes[0].free_ram > nodes[0].total_ram) {
+            pr_err(lang_get(LANG_TEST_MEM_NODE_FAILED), nr_nodes);
+            kfree(nodes);
+            moeai_mem_monitor_exit();
+            moeai_logger_exit();
+            return -EINVAL;
+        }
+        pr_info(lang_get(LANG_TEST_MEM_NODE_PASSED), nr_nodes);
+        kfree(nodes);
+    }
+    
     /* Test 6: Start memory monitor */
     ret = moeai_mem_monitor_start();
     if (ret != 0) {
-        pr_err("%s", lang_get(LANG_TEST_MEM_START_FAILED), ret);
+        pr_err(lang_get(LANG_TEST_MEM_START_FAILED), ret);
         moeai_mem_monitor_exit();
         moeai_logger_exit();
         return ret;
@@ -118,14 +160,13 @@ static int __init test_mem_monitor_init(void)
         reclaimed = reclaim_fn(MOEAI_MEM_RECLAIM_GENTLE);
     }
     if (reclaimed < 0) {
-        int err = (int)reclaimed;
-        pr_err("%s", lang_get(LANG_TEST_MEM_RECLAIM_FAILED), err);
+        pr_err(lang_get(LANG_TEST_MEM_RECLAIM_FAILED), reclaimed);
         moeai_mem_monitor_stop();
         moeai_mem_monitor_exit();
         moeai_logger_exit();
-        return err;
+        return (int)reclaimed;
     }
-    pr_info("%s", lang_get(LANG_TEST_MEM_RECLAIM_PASSED), (int)reclaimed);
+    pr_info(lang_get(LANG_TEST_MEM_RECLAIM_PASSED), reclaimed);
     
     /* Test 8: Stop memory monitor */
     moeai_mem_monitor_stop();
@@ -0,0 +1,172 @@
+/**
+ * MoeAI-C - Intelligent Kernel Assistant Module
+ *
+ * File: test/test_mem_policy.c
+ * Description: Reclaim policy selection (confidence bound bandit) unit test
+ *
+ * Copyright © 2025 @ydzat
+ */
+
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/slab.h>
+
+#include "../include/modules/mem_policy.h"
+#include "../include/utils/logger.h"
+#include "../include/utils/lang.h"
+
+/* Check that an arm's confidence interval is well formed */
+static bool test_policy_arm_ok(const struct moeai_mem_policy_arm *arm)
+{
+    return arm->lower_percent <= arm->success_percent &&
+           arm->success_percent <= arm->upper_percent &&
+           arm->upper_percent <= 100;
+}
+
+static void test_policy_record(int ctx, int policy, unsigned int successes, unsigned int failures)
+{
+    unsigned int i;
+
+    for (i = 0; i < successes; i++)
+        moeai_mem_policy_record_outcome(ctx, policy, true);
+    for (i = 0; i < failures; i++)
+        moeai_mem_policy_record_outcome(ctx, policy, false);
+}
+
+/* Test environment initialization function */
+static int __init test_mem_policy_init(void)
+{
+    const int warn = moeai_mem_policy_ctx(MOEAI_STATE_WARNING);
+    const int crit = moeai_mem_policy_ctx(MOEAI_STATE_CRITICAL);
+    const int emerg = moeai_mem_policy_ctx(MOEAI_STATE_EMERGENCY);
+    struct moeai_mem_policy_stats *stats;
+    struct moeai_mem_policy_config config;
+    const struct moeai_mem_policy_arm *arm;
+    unsigned int width;
+    int ret, choice, p;
+
+    pr_info("%s", lang_get(LANG_TEST_POLICY_START));
+
+    ret = moeai_logger_init(true);
+    if (ret != 0) {
+        pr_err(lang_get(LANG_TEST_MEM_LOG_INIT_FAILED), ret);
+        return ret;
+    }
+
+    ret = moeai_mem_policy_init();
+    if (ret != 0) {
+        pr_err(lang_get(LANG_TEST_POLICY_INIT_FAILED), ret);
+        moeai_logger_exit();
+        return ret;
+    }
+
+    stats = kcalloc(MOEAI_MEM_RECLAIM_MAX, sizeof(*stats), GFP_KERNEL);
+    if (!stats) {
+        ret = -ENOMEM;
+        goto out;
+    }
+    ret = -EINVAL;
+
+    /* Test 1: Without data every interval is [0, 100] and the default policy wins */
+    moeai_mem_policy_get_stats(stats);
+    for (p = 0; p < MOEAI_MEM_RECLAIM_MAX; p++) {
+        arm = &stats[p].arms[warn];
+        if (arm->trials || arm->lower_percent != 0 || arm->upper_percent != 100) {
+            pr_err(lang_get(LANG_TEST_POLICY_BOUNDS_FAILED), arm->success_percent,
+                   arm->lower_percent, arm->upper_percent);
+            goto out;
+        }
+    }
+    for (p = 0; p < MOEAI_MEM_RECLAIM_MAX; p++) {
+        choice = moeai_mem_policy_select(warn, p);
+        if (choice != p) {
+            pr_err(lang_get(LANG_TEST_POLICY_DEFAULT_FAILED), p, choice);
+            goto out;
+        }
+    }
+    pr_info("%s", lang_get(LANG_TEST_POLICY_DEFAULT_PASSED));
+
+    /* Test 2: The interval contains the observed rate and narrows as trials accumulate */
+    test_policy_record(crit, MOEAI_MEM_RECLAIM_GENTLE, 7, 3);
+    moeai_mem_policy_get_stats(stats);
+    arm = &stats[MOEAI_MEM_RECLAIM_GENTLE].arms[crit];
+    if (arm->trials != 10 || arm->successes != 7 || arm->success_percent != 70 ||
+        !test_policy_arm_ok(arm)) {
+        pr_err(lang_get(LANG_TEST_POLICY_BOUNDS_FAILED), arm->success_percent,
+               arm->lower_percent, arm->upper_percent);
+        goto out;
+    }
+    width = arm->upper_percent - arm->lower_percent;
+
+    test_policy_record(crit, MOEAI_MEM_RECLAIM_GENTLE, 70, 30);
+    moeai_mem_policy_get_stats(stats);
+    arm = &stats[MOEAI_MEM_RECLAIM_GENTLE].arms[crit];
+    if (arm->success_percent != 70 || !test_policy_arm_ok(arm) ||
+        arm->upper_percent - arm->lower_percent >= width) {
+        pr_err(lang_get(LANG_TEST_POLICY_BOUNDS_FAILED), arm->success_percent,
+               arm->lower_percent, arm->upper_percent);
+        goto out;
+    }
+    pr_info("%s", lang_get(LANG_TEST_POLICY_BOUNDS_PASSED));
+
+    /* Test 3: Once the cheapest policy is proven reliable it replaces a costlier default */
+    test_policy_record(warn, MOEAI_MEM_RECLAIM_GENTLE, 64, 0);
+    choice = moeai_mem_policy_select(warn, MOEAI_MEM_RECLAIM_AGGRESSIVE);
+    if (choice != MOEAI_MEM_RECLAIM_GENTLE) {
+        pr_err(lang_get(LANG_TEST_POLICY_RELIABLE_FAILED), MOEAI_MEM_RECLAIM_GENTLE, choice);
+        goto out;
+    }
+    pr_info("%s", lang_get(LANG_TEST_POLICY_RELIABLE_PASSED));
+
+    /* Test 4: A policy that failed every trial loses to untried ones */
+    test_policy_record(emerg, MOEAI_MEM_RECLAIM_MODERATE, 0, 20);
+    choice = moeai_mem_policy_select(emerg, MOEAI_MEM_RECLAIM_MODERATE);
+    if (choice == MOEAI_MEM_RECLAIM_MODERATE) {
+        pr_err(lang_get(LANG_TEST_POLICY_AVOID_FAILED), choice);
+        goto out;
+    }
+    pr_info("%s", lang_get(LANG_TEST_POLICY_AVOID_PASSED));
+
+    /* Test 5: Non-adaptive mode uses the fixed mapping; out of range targets are rejected */
+    moeai_mem_policy_get_config(&config);
+    config.adaptive = false;
+    moeai_mem_policy_set_config(&config);
+    choice = moeai_mem_policy_select(warn, MOEAI_MEM_RECLAIM_AGGRESSIVE);
+    if (choice != MOEAI_MEM_RECLAIM_AGGRESSIVE) {
+        pr_err(lang_get(LANG_TEST_POLICY_CONFIG_FAILED), choice);
+        goto out;
+    }
+    config.target_percent = 101;
+    if (moeai_mem_policy_set_config(&config) != -EINVAL) {
+        pr_err(lang_get(LANG_TEST_POLICY_CONFIG_FAILED), -EINVAL);
+        goto out;
+    }
+    pr_info("%s", lang_get(LANG_TEST_POLICY_CONFIG_PASSED));
+
+    pr_info("%s", lang_get(LANG_TEST_POLICY_ALL_PASSED));
+    ret = 0;
+
+out:
+    kfree(stats);
+    if (ret) {
+        moeai_mem_policy_exit();
+        moeai_logger_exit();
+    }
+    return ret;
+}
+
+/* Test environment cleanup function */
+static void __exit test_mem_policy_exit(void)
+{
+    moeai_mem_policy_exit();
+    moeai_logger_exit();
+}
+
+module_init(test_mem_policy_init);
+module_exit(test_mem_policy_exit);
+
+MODULE_LICENSE("MIT");
+MODULE_AUTHOR("@ydzat");
+MODULE_DESCRIPTION("MoeAI-C Reclaim Policy Selection Test Module");
+MODULE_VERSION("0.1");
@@ -0,0 +1,123 @@
+/**
+ * MoeAI-C - Intelligent Kernel Assistant Module
+ *
+ * File: test/test_node_reclaim.c
+ * Description: Node-targeted reclaim unit test
+ *
+ * Copyright © 2025 @ydzat
+ */
+
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/mm.h>
+#include <linux/mmzone.h>
+#include <linux/vmstat.h>
+#include <linux/nodemask.h>
+
+#include "../include/modules/mem_monitor.h"
+#include "../include/utils/logger.h"
+#include "../include/utils/lang.h"
+
+/* Requested per reclaim; any node with page cache can give back this much */
+#define TEST_NODE_RECLAIM_KB (64 * 1024)
+
+/* Free memory on a node, read directly instead of through the monitor */
+static unsigned long test_node_free_kb(int nid)
+{
+    struct pglist_data *pgdat = NODE_DATA(nid);
+    unsigned long free = 0;
+    int i;
+
+    for (i = 0; i < MAX_NR_ZONES; i++) {
+        struct zone *zone = &pgdat->node_zones[i];
+
+        if (populated_zone(zone))
+            free += zone_page_state(zone, NR_FREE_PAGES);
+    }
+    return free * (PAGE_SIZE / 1024);
+}
+
+/* Test environment initialization function */
+static int __init test_node_reclaim_init(void)
+{
+    int nid = first_online_node;
+    unsigned long before, after;
+    long ret;
+    int err;
+
+    pr_info("%s", lang_get(LANG_TEST_NODE_START));
+
+    err = moeai_logger_init(true);
+    if (err != 0) {
+        pr_err(lang_get(LANG_TEST_MEM_LOG_INIT_FAILED), err);
+        return err;
+    }
+
+    err = moeai_mem_monitor_init();
+    if (err != 0) {
+        pr_err(lang_get(LANG_TEST_MEM_INIT_FAILED), err);
+        moeai_logger_exit();
+        return err;
+    }
+    err = -EINVAL;
+
+    /* Test 1: Offline or out of range nodes and a zero target are rejected */
+    ret = moeai_mem_reclaim_node(-1, TEST_NODE_RECLAIM_KB);
+    if (ret != -EINVAL)
+        goto err_args;
+    ret = moeai_mem_reclaim_node(MAX_NUMNODES, TEST_NODE_RECLAIM_KB);
+    if (ret != -EINVAL)
+        goto err_args;
+    ret = moeai_mem_reclaim_node(nid, 0);
+    if (ret != -EINVAL)
+        goto err_args;
+    pr_info("%s", lang_get(LANG_TEST_NODE_ARGS_PASSED));
+
+    /* Test 2: Without the per-node interface nothing is reclaimed and the caller is told so */
+    if (!moeai_mem_node_reclaim_supported()) {
+        ret = moeai_mem_reclaim_node(nid, TEST_NODE_RECLAIM_KB);
+        if (ret != -EOPNOTSUPP) {
+            pr_err(lang_get(LANG_TEST_NODE_UNSUPPORTED_FAILED), ret);
+            goto err_test;
+        }
+        pr_info(lang_get(LANG_TEST_NODE_UNSUPPORTED_PASSED), nid);
+        goto done;
+    }
+
+    /* Test 3: Reclaiming on a node raises that node's free memory */
+    before = test_node_free_kb(nid);
+    ret = moeai_mem_reclaim_node(nid, TEST_NODE_RECLAIM_KB);
+    after = test_node_free_kb(nid);
+    if (ret <= 0 || after <= before) {
+        pr_err(lang_get(LANG_TEST_NODE_FREE_FAILED), nid, before, after, ret);
+        goto err_test;
+    }
+    pr_info(lang_get(LANG_TEST_NODE_FREE_PASSED), nid, before, after);
+
+done:
+    pr_info("%s", lang_get(LANG_TEST_NODE_ALL_PASSED));
+    return 0;
+
+err_args:
+    pr_err(lang_get(LANG_TEST_NODE_ARGS_FAILED), ret);
+err_test:
+    moeai_mem_monitor_exit();
+    moeai_logger_exit();
+    return err;
+}
+
+/* Test environment cleanup function */
+static void __exit test_node_reclaim_exit(void)
+{
+    moeai_mem_monitor_exit();
+    moeai_logger_exit();
+}
+
+module_init(test_node_reclaim_init);
+module_exit(test_node_reclaim_exit);
+
+MODULE_LICENSE("MIT");
+MODULE_AUTHOR("@ydzat");
+MODULE_DESCRIPTION("MoeAI-C Node-Targeted Reclaim Test Module");
+MODULE_VERSION("0.1");